@@ -135,6 +135,8 @@ bool	UPopcornFXFile::_ImportFile(const FString &inFilePath, bool bIsReimport)
 	// the PopcornFXFile's source is the source .pkfx, but inFileDataPath is the baked effect (contained in project's Saved/PopcornFX/..)
 	// this workflow ensures auto import works ok, UE assets points to the source effect
 	// But the import data needs to be baked data
+	if (g_FsController != null)
+		g_FsController->GameThread_UnregisterFile(this);
 	const bool	ok = FFileHelper::LoadFileToArray(m_FileData, *bakedFilePath);
 	if (ok)
 	{
@@ -568,6 +570,10 @@ void	UPopcornFXFile::PostLoad()
 
 	if (!CacheIsUpToDate())
 		CacheAsset();
+
+	// Resident from now on: can be opened by effects and resources loading on worker threads
+	if (g_FsController != null)
+		g_FsController->GameThread_RegisterFile(this);
 }
 
 //----------------------------------------------------------------------------
@@ -699,13 +705,40 @@ const TArray<UAssetUserData*>	*UPopcornFXFile::GetAssetUserDataArray() const
 void	UPopcornFXFile::BeginDestroy()
 {
 	UnloadFile();
+	if (g_FsController != null) // OnFileUnload() can be overriden without calling Super
+		g_FsController->GameThread_UnregisterFile(this);
 	Super::BeginDestroy();
 }
 
+//----------------------------------------------------------------------------
+#if WITH_EDITOR
+
+void	UPopcornFXFile::PreEditUndo()
+{
+	// Undo/redo restores the file data in place, without going through OnFileUnload()
+	if (g_FsController != null)
+		g_FsController->GameThread_UnregisterFile(this);
+	Super::PreEditUndo();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXFile::PostEditUndo()
+{
+	Super::PostEditUndo();
+	if (g_FsController != null)
+		g_FsController->GameThread_RegisterFile(this);
+}
+
+#endif // WITH_EDITOR
 //----------------------------------------------------------------------------
 
 void	UPopcornFXFile::OnFileUnload()
 {
+	// File data is about to change or go away, streams opened from workers keep reading the old data
+	if (g_FsController != null)
+		g_FsController->GameThread_UnregisterFile(this);
+
 	// Make sure GPU sim tasks associated with this effect are properly flushed before unloading the effect
 	// otherwise, we can have zombie pending tasks executed during the next rendered frame
 	FlushRenderingCommands();
@@ -719,6 +752,8 @@ void	UPopcornFXFile::OnFileUnload()
 
 void	UPopcornFXFile::OnFileLoad()
 {
+	if (g_FsController != null)
+		g_FsController->GameThread_RegisterFile(this);
 }
 
 //----------------------------------------------------------------------------
@@ -154,6 +154,7 @@ void	UPopcornFXMesh::BeginDestroy()
 {
 	Super::BeginDestroy();
 	m_ResourceMesh = null;
+	m_SkinningResourceMeshes.Empty();
 }
 
 //----------------------------------------------------------------------------
@@ -228,6 +229,28 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::LoadResourceMeshIFN(bool editorBuildIFN
 	return m_ResourceMesh.Get();
 }
 
+//----------------------------------------------------------------------------
+
+PopcornFX::PResourceMesh	UPopcornFXMesh::LoadSkinningResourceMeshIFN(uint32 lodIndex, uint32 triangleStride)
+{
+	PK_ASSERT(IsInGameThread());
+
+	triangleStride = FMath::Max(triangleStride, 1U);
+	if (lodIndex == 0 && triangleStride == 1)
+		return LoadResourceMeshIFN(true);
+	if (!PK_VERIFY(SkeletalMesh != null))
+		return null;
+
+	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerMesh_UE::LoadSkinningResourceMeshIFN", POPCORNFX_UE_PROFILER_COLOR);
+
+	// Failed builds are cached as well, no need to retry each time a sampler asks for it
+	const uint32				key = (lodIndex << 16) | (triangleStride & 0xFFFF);
+	PopcornFX::PResourceMesh	*resMesh = m_SkinningResourceMeshes.Find(key);
+	if (resMesh != null)
+		return *resMesh;
+	return m_SkinningResourceMeshes.Add(key, NewResourceMesh(SkeletalMesh, lodIndex, triangleStride));
+}
+
 //----------------------------------------------------------------------------
 #if WITH_EDITOR
 //----------------------------------------------------------------------------
@@ -260,6 +283,7 @@ void	UPopcornFXMesh::PostEditChangeProperty(FPropertyChangedEvent& PropertyChang
 void	UPopcornFXMesh::PreReimport_Clean()
 {
 	m_ResourceMesh = null;
+	m_SkinningResourceMeshes.Empty();
 	Super::PreReimport_Clean();
 }
 
@@ -350,17 +374,22 @@ bool	UPopcornFXMesh::BuildMeshFromSource()
 		return BuildMesh(SkeletalMesh);
 	return false;
 }
+#endif // WITH_EDITOR
 
 //----------------------------------------------------------------------------
 
 namespace
 {
+	const u32	kDroppedVertex = ~0U;
+
+	// 'vertexRemap' maps LOD vertices to mesh vertices (kDroppedVertex if unused), identity if empty
 	template<typename _IndexType>
 	void	_FillSkelMeshBuffers(	const FSkeletalMeshLODRenderData	&LODRenderData,
 									PopcornFX::CMeshVStream				&vstream,
 									PopcornFX::TMemoryView<float>		boneWeights,
 									PopcornFX::TMemoryView<u8>			boneIndices,
-									u32									maxInfluenceCount)
+									u32									maxInfluenceCount,
+									PopcornFX::TMemoryView<const u32>	vertexRemap)
 	{
 		float		* __restrict _boneWeights = boneWeights.Data();
 		_IndexType	* __restrict _boneIndices = reinterpret_cast<_IndexType*>(boneIndices.Data());
@@ -371,7 +400,7 @@ namespace
 		const PopcornFX::TStridedMemoryView<CFloat4>	srcColorsView = vstream.Colors();
 
 		const bool	hasColors = !srcColorsView.Empty();
-		const u32	totalVertexCount = LODRenderData.GetNumVertices();
+		const u32	totalVertexCount = srcPositionsView.Count();
 		const u32	totalUVCount = LODRenderData.GetNumTexCoords();
 
 		PK_STACKSTRIDEDMEMORYVIEW(PopcornFX::TStridedMemoryView<CFloat2>, srcUVsView, totalUVCount);
@@ -387,7 +416,6 @@ namespace
 			PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::FillBuffers (Build section)", POPCORNFX_UE_PROFILER_COLOR);
 
 			const FSkelMeshRenderSection	&section = LODRenderData.RenderSections[iSection];
-			PK_ONLY_IF_ASSERTS(const u32 numSectionVertices = section.GetNumVertices());
 
 			const u32	sectionOffset = section.BaseVertexIndex;
 			const u32	numVertices = section.GetNumVertices();
@@ -398,21 +426,24 @@ namespace
 
 			for (u32 iVertex = 0; iVertex < numVertices; ++iVertex)
 			{
-				const u32	vertexIndex = sectionOffset + iVertex;
+				const u32	lodVertexIndex = sectionOffset + iVertex;
+				const u32	vertexIndex = vertexRemap.Empty() ? lodVertexIndex : vertexRemap[lodVertexIndex];
+				if (vertexIndex == kDroppedVertex)
+					continue;
 				PK_ASSERT(vertexIndex < totalVertexCount);
 
-				srcPositionsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(vertexIndex)) * invScale;
-				srcNormalsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(vertexIndex)).xyz();
+				srcPositionsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.PositionVertexBuffer.VertexPosition(lodVertexIndex)) * invScale;
+				srcNormalsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentZ(lodVertexIndex)).xyz();
 
 				{
-					const FVector3f	tangent = LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(vertexIndex);
+					const FVector3f	tangent = LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.VertexTangentX(lodVertexIndex);
 					srcTangentsView[vertexIndex] = ToPk(tangent);
 				}
-				PK_RELEASE_ASSERT(!hasColors || vertexIndex < LODRenderData.StaticVertexBuffers.ColorVertexBuffer.GetNumVertices());
+				PK_RELEASE_ASSERT(!hasColors || lodVertexIndex < LODRenderData.StaticVertexBuffers.ColorVertexBuffer.GetNumVertices());
 				if (hasColors)
-					srcColorsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.ColorVertexBuffer.VertexColor(vertexIndex));
+					srcColorsView[vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.ColorVertexBuffer.VertexColor(lodVertexIndex));
 				for (u32 iUV = 0; iUV < totalUVCount; ++iUV)
-					srcUVsView[iUV][vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(vertexIndex, iUV));
+					srcUVsView[iUV][vertexIndex] = ToPk(LODRenderData.StaticVertexBuffers.StaticMeshVertexBuffer.GetVertexUV(lodVertexIndex, iUV));
 
 				PK_ONLY_IF_ASSERTS(float	weightsSum = 0.0f);
 				{
@@ -420,14 +451,14 @@ namespace
 					PK_ASSERT(offsetInfluences + maxInfluenceCount <= boneWeights.Count());
 					for (u32 iInfluence = 0; iInfluence < sectionInfluenceCount; ++iInfluence)
 					{
-						const float	localBoneWeight = LODRenderData.SkinWeightVertexBuffer.GetBoneWeight(vertexIndex, iInfluence);
+						const float	localBoneWeight = LODRenderData.SkinWeightVertexBuffer.GetBoneWeight(lodVertexIndex, iInfluence);
 						const float	boneWeight = localBoneWeight * boneWeightNormalizer;
 
 						PK_ONLY_IF_ASSERTS(weightsSum += boneWeight);
 						_boneWeights[offsetInfluences + iInfluence] = boneWeight;
 						PK_ASSERT(_boneWeights[offsetInfluences + iInfluence] >= 0.0f && _boneWeights[offsetInfluences + iInfluence] <= 1.0f);
 
-						const u32	localBoneIndex = LODRenderData.SkinWeightVertexBuffer.GetBoneIndex(vertexIndex, iInfluence);
+						const u32	localBoneIndex = LODRenderData.SkinWeightVertexBuffer.GetBoneIndex(lodVertexIndex, iInfluence);
 						_boneIndices[offsetInfluences + iInfluence] = section.BoneMap[localBoneIndex];
 
 						// We can stop copying data, weights are sorted
@@ -436,8 +467,8 @@ namespace
 					}
 					PK_ASSERT(weightsSum > 0.0f);
 				}
+				PK_ONLY_IF_ASSERTS(++totalVertices);
 			}
-			PK_ONLY_IF_ASSERTS(totalVertices += numSectionVertices);
 		}
 		PK_ASSERT(totalVertices == totalVertexCount);
 	}
@@ -464,6 +495,8 @@ namespace
 
 } // namespace
 
+//----------------------------------------------------------------------------
+#if WITH_EDITOR
 //----------------------------------------------------------------------------
 
 PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(UStaticMesh *staticMesh)
@@ -748,9 +781,11 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(UStaticMesh *staticMesh
 	return resMesh;
 }
 
+//----------------------------------------------------------------------------
+#endif // WITH_EDITOR
 //----------------------------------------------------------------------------
 
-PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletalMesh)
+PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletalMesh, uint32 lodIndex, uint32 triangleStride)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerMesh_UE::NewResourceMesh (Skeletal)", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -761,17 +796,26 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 		return resMesh;
 
 	const FSkeletalMeshRenderData	*skelMeshRenderData = skeletalMesh->GetResourceForRendering();
-	if (!PK_VERIFY(skelMeshRenderData != null && skelMeshRenderData->LODRenderData.Num() > 0))
+	if (!PK_VERIFY(skelMeshRenderData != null && skelMeshRenderData->LODRenderData.Num() > 0) ||
+		!PK_VERIFY(lodIndex < (uint32)skelMeshRenderData->LODRenderData.Num()))
 		return resMesh;
 
-	const FSkeletalMeshLODRenderData	&LODRenderData = skelMeshRenderData->LODRenderData[0];
-	const u32							totalVertexCount = LODRenderData.GetNumVertices();
+	const FSkeletalMeshLODRenderData	&LODRenderData = skelMeshRenderData->LODRenderData[lodIndex];
+	const u32							lodVertexCount = LODRenderData.GetNumVertices();
 	const u32							totalUVCount = LODRenderData.GetNumTexCoords();
 	if (!PK_VERIFY(LODRenderData.RequiredBones.Num() > 0) ||
-		!PK_VERIFY(totalVertexCount > 0))
+		!PK_VERIFY(lodVertexCount > 0))
 		return resMesh;
 
-	const u32	totalBoneCount = LODRenderData.RequiredBones.Num();
+	// Runtime builds read back the vertex buffers
+	if (!GIsEditor && !LODRenderData.StaticVertexBuffers.PositionVertexBuffer.GetAllowCPUAccess())
+	{
+		UE_LOG(LogPopcornMesh, Warning, TEXT("Couldn't build LOD %d of '%s' for sampling: enable 'Allow CPU Access' on this LOD"), lodIndex, *skeletalMesh->GetName());
+		return null;
+	}
+
+	// Bone indices reference the whole skeleton, regardless of the LOD
+	const u32	totalBoneCount = skelMeshRenderData->LODRenderData[0].RequiredBones.Num();
 	if (!PK_VERIFY(totalBoneCount > 0))
 		return resMesh;
 
@@ -782,6 +826,8 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 	PopcornFX::CMeshVStream			&vstream = triBatch.m_VStream;
 	PopcornFX::CMeshIStream			&istream = triBatch.m_IStream;
 
+	u32						totalVertexCount = lodVertexCount;
+	PopcornFX::TArray<u32>	vertexRemap;
 	{
 		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildMeshIndices", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -794,16 +840,50 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 		PK_ASSERT(indexSizeInBytes == sizeof(u16) || indexSizeInBytes == sizeof(u32));
 
 		istream.SetPrimitiveType(PopcornFX::CMeshIStream::Triangles);
-		istream.Reformat((PopcornFX::CMeshIStream::EFormat)indexSizeInBytes);
-		if (!PK_VERIFY(istream.Resize(totalIndexCount)))
-			return resMesh;
 
-		// .. The interface doesn't expose a const GetPointerTo() method
-		// - We do this to workaround the extremely expensive MultiSizeIndexContainer.GetIndexBuffer() -
-		FRawStaticIndexBuffer16or32Interface	*bufferForReading = const_cast<FRawStaticIndexBuffer16or32Interface*>(iBuffer);
+		if (triangleStride <= 1)
+		{
+			istream.Reformat((PopcornFX::CMeshIStream::EFormat)indexSizeInBytes);
+			if (!PK_VERIFY(istream.Resize(totalIndexCount)))
+				return resMesh;
+
+			// .. The interface doesn't expose a const GetPointerTo() method
+			// - We do this to workaround the extremely expensive MultiSizeIndexContainer.GetIndexBuffer() -
+			FRawStaticIndexBuffer16or32Interface	*bufferForReading = const_cast<FRawStaticIndexBuffer16or32Interface*>(iBuffer);
 
-		PK_ASSERT(istream.IndexByteWidth() == indexSizeInBytes);
-		PopcornFX::Mem::Copy(istream.RawStreamForWriting(), bufferForReading->GetPointerTo(0), totalIndexCount * indexSizeInBytes);
+			PK_ASSERT(istream.IndexByteWidth() == indexSizeInBytes);
+			PopcornFX::Mem::Copy(istream.RawStreamForWriting(), bufferForReading->GetPointerTo(0), totalIndexCount * indexSizeInBytes);
+		}
+		else
+		{
+			// Subsampled mesh: keep one triangle out of 'triangleStride', and only the vertices they reference (in order of appearance)
+			const u32	srcTriangleCount = totalIndexCount / 3;
+			const u32	triangleCount = (srcTriangleCount + triangleStride - 1) / triangleStride;
+			if (!PK_VERIFY(triangleCount > 0) ||
+				!PK_VERIFY(vertexRemap.Resize(lodVertexCount)))
+				return resMesh;
+			PopcornFX::Mem::Fill32(vertexRemap.RawDataPointer(), kDroppedVertex, lodVertexCount);
+
+			istream.Reformat((PopcornFX::CMeshIStream::EFormat)sizeof(u32));
+			if (!PK_VERIFY(istream.Resize(triangleCount * 3)))
+				return resMesh;
+
+			u32		*dstIndices = reinterpret_cast<u32*>(istream.RawStreamForWriting());
+			u32		dstIndex = 0;
+			totalVertexCount = 0;
+			for (u32 iTriangle = 0; iTriangle < srcTriangleCount; iTriangle += triangleStride)
+			{
+				for (u32 iCorner = 0; iCorner < 3; ++iCorner)
+				{
+					const u32	lodVertexIndex = iBuffer->Get(iTriangle * 3 + iCorner);
+					PK_ASSERT(lodVertexIndex < lodVertexCount);
+					if (vertexRemap[lodVertexIndex] == kDroppedVertex)
+						vertexRemap[lodVertexIndex] = totalVertexCount++;
+					dstIndices[dstIndex++] = vertexRemap[lodVertexIndex];
+				}
+			}
+			PK_ASSERT(dstIndex == triangleCount * 3);
+		}
 	}
 	PopcornFX::SVertexDeclaration	decl;
 
@@ -813,7 +893,7 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 	for (u32 iUV = 0; iUV < totalUVCount; ++iUV)
 		decl.AddStreamCodeIFN(PopcornFX::SVStreamCode(PopcornFX::CVStreamSemanticDictionnary::UvStreamToOrdinal(iUV), PopcornFX::SVStreamCode::Element_Float2));
 
-	const bool	hasColors = LODRenderData.StaticVertexBuffers.ColorVertexBuffer.GetNumVertices() == totalVertexCount;
+	const bool	hasColors = LODRenderData.StaticVertexBuffers.ColorVertexBuffer.GetNumVertices() == lodVertexCount;
 	if (hasColors)
 		decl.AddStreamCodeIFN(PopcornFX::SVStreamCode(PopcornFX::CVStreamSemanticDictionnary::Ordinal_Color, PopcornFX::SVStreamCode::Element_Float4, PopcornFX::SVStreamCode::SIMD_Friendly));
 
@@ -856,18 +936,23 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 	PopcornFX::CBaseSkinningStreams	*skinningStreams = null;
 	if (smallBoneIndices)
 	{
-		_FillSkelMeshBuffers<u8>(LODRenderData, vstream, boneWeights, boneIndices, maxInfluenceCount);
+		_FillSkelMeshBuffers<u8>(LODRenderData, vstream, boneWeights, boneIndices, maxInfluenceCount, vertexRemap);
 		skinningStreams = PopcornFX::CBaseSkinningStreams::BuildFromUnpackedStreams(totalVertexCount, boneWeights, boneIndices);
 	}
 	else
 	{
-		_FillSkelMeshBuffers<u16>(LODRenderData, vstream, boneWeights, boneIndices, maxInfluenceCount);
+		_FillSkelMeshBuffers<u16>(LODRenderData, vstream, boneWeights, boneIndices, maxInfluenceCount, vertexRemap);
 
 		PopcornFX::TMemoryView<const u16>	view(reinterpret_cast<const u16*>(boneIndices.RawDataPointer()), boneIndices.Count() / 2);
 		skinningStreams = PopcornFX::CBaseSkinningStreams::BuildFromUnpackedStreams(totalVertexCount, boneWeights, view);
 	}
 
-	_FinalSetupMeshNew(meshNew, false, bBuildUVToPCoordAccelStructs); // we don't need kd tree for skeletal meshes
+#if WITH_EDITORONLY_DATA
+	const bool	buildUVToPCoordAccelStructs = bBuildUVToPCoordAccelStructs != 0;
+#else
+	const bool	buildUVToPCoordAccelStructs = false; // Runtime builds (see LoadSkinningResourceMeshIFN) stay lean
+#endif // WITH_EDITORONLY_DATA
+	_FinalSetupMeshNew(meshNew, false, buildUVToPCoordAccelStructs); // we don't need kd tree for skeletal meshes
 
 	if (!PK_VERIFY(skinningStreams != null) ||
 		!PK_VERIFY(resMesh->AddBatch("SkinnedMeshMerged", meshNew).Valid()))
@@ -879,6 +964,8 @@ PopcornFX::PResourceMesh	UPopcornFXMesh::NewResourceMesh(USkeletalMesh *skeletal
 	return resMesh;
 }
 
+//----------------------------------------------------------------------------
+#if WITH_EDITOR
 //----------------------------------------------------------------------------
 
 template <typename _AssetType>
@@ -901,6 +988,7 @@ bool	UPopcornFXMesh::BuildMesh(_AssetType *mesh)
 	m_ResourceMesh->m_OnReloading(m_ResourceMesh.Get());
 
 	m_ResourceMesh->Swap(*newResource);
+	m_SkinningResourceMeshes.Empty();
 
 #if WITH_EDITOR
 	const UAssetImportData	*assetImportData = mesh->GetAssetImportData();
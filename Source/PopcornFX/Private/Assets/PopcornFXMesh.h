@@ -66,6 +66,11 @@ public:
 
 	PopcornFX::PResourceMesh	LoadResourceMeshIFN(bool editorBuildIFN);
 
+	/** Skeletal meshes only: mesh of the given LOD, keeping one triangle out of 'triangleStride'.
+	* Built at runtime from the render data (requires CPU access on that LOD), LOD 0 without subsampling is LoadResourceMeshIFN().
+	*/
+	PopcornFX::PResourceMesh	LoadSkinningResourceMeshIFN(uint32 lodIndex, uint32 triangleStride);
+
 #if WITH_EDITOR
 	virtual void				PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual void				PreReimport_Clean() override;
@@ -88,7 +93,6 @@ protected:
 private:
 #if WITH_EDITOR
 	PopcornFX::PResourceMesh	NewResourceMesh(UStaticMesh *staticMesh);
-	PopcornFX::PResourceMesh	NewResourceMesh(USkeletalMesh *skeletalMesh);
 
 	bool						BuildMeshFromSource();
 
@@ -96,7 +100,9 @@ private:
 	bool						BuildMesh(_AssetType *mesh);
 	void						WriteMesh();
 #endif // WITH_EDITOR
+	PopcornFX::PResourceMesh	NewResourceMesh(USkeletalMesh *skeletalMesh, uint32 lodIndex = 0, uint32 triangleStride = 1);
 
 private:
 	PopcornFX::PResourceMesh	m_ResourceMesh;
+	TMap<uint32, PopcornFX::PResourceMesh>	m_SkinningResourceMeshes; // See LoadSkinningResourceMeshIFN, not serialized
 };
@@ -5,7 +5,392 @@
 
 #include "Assets/PopcornFXSimulationCache.h"
 
+#include "Render/SimulationCacheRecorder.h"
+#include "PopcornFXEmitterComponent.h"
+
+#include "Engine/World.h"
+#include "Algo/BinarySearch.h"
+
+#include "PopcornFXSDK.h"
+
+//----------------------------------------------------------------------------
+
+DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXSimulationCache, Log, All);
+
+//----------------------------------------------------------------------------
+//
+//	Frame data layout, for each track of a frame:
+//		u32			particle count
+//		if the particle count isn't 0:
+//			FVector3f	positions min, FVector3f positions extent
+//			u16 x 3		positions, quantized in [min, min + extent]
+//			float		size min, float size max
+//			u16			sizes, quantized in [size min, size max]
+//			u16			rotations, quantized in [0, 2PI[
+//			FFloat16 x 4	colors
+//
+//----------------------------------------------------------------------------
+
+namespace
+{
+	const float	kQuantizationMax = 65535.0f;
+
+	template <typename _Type>
+	void	_Write(TArray<uint8> &data, const _Type &value)
+	{
+		const int32	offset = data.AddUninitialized(sizeof(_Type));
+		FMemory::Memcpy(data.GetData() + offset, &value, sizeof(_Type));
+	}
+
+	uint16	_Quantize(float value, float min, float rcpExtent)
+	{
+		return uint16(FMath::Clamp(FMath::RoundToInt((value - min) * rcpExtent * kQuantizationMax), 0, 0xFFFF));
+	}
+
+	//----------------------------------------------------------------------------
+
+	class	FFrameReader
+	{
+	public:
+		FFrameReader(const uint8 *data, uint32 size) : m_Data(data), m_Size(size) { }
+
+		template <typename _Type>
+		bool	Read(_Type &outValue)
+		{
+			if (m_Offset + sizeof(_Type) > m_Size)
+				return false;
+			FMemory::Memcpy(&outValue, m_Data + m_Offset, sizeof(_Type));
+			m_Offset += sizeof(_Type);
+			return true;
+		}
+
+		bool	CanRead(uint64 byteCount) const { return m_Offset + byteCount <= m_Size; }
+
+	private:
+		const uint8	*m_Data;
+		uint64		m_Size;
+		uint64		m_Offset = 0;
+	};
+
+	//----------------------------------------------------------------------------
+
+	void	_EncodeTrack(TArray<uint8> &data, const FPopcornFXSimulationCacheDecodedTrack &track, FBox &outBounds)
+	{
+		const uint32	count = track.Positions.Num();
+		PK_ASSERT(track.Sizes.Num() == count && track.Rotations.Num() == count && track.Colors.Num() == count);
+		_Write(data, count);
+		if (count == 0)
+			return;
+
+		FBox3f	positionBounds(ForceInit);
+		float	sizeMin = TNumericLimits<float>::Max();
+		float	sizeMax = TNumericLimits<float>::Lowest();
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			positionBounds += track.Positions[parti];
+			sizeMin = FMath::Min(sizeMin, track.Sizes[parti]);
+			sizeMax = FMath::Max(sizeMax, track.Sizes[parti]);
+			outBounds += FBox(FVector(track.Positions[parti]) - track.Sizes[parti], FVector(track.Positions[parti]) + track.Sizes[parti]);
+		}
+		const FVector3f	extent = positionBounds.Max - positionBounds.Min;
+		const FVector3f	rcpExtent(	extent.X > 0.0f ? 1.0f / extent.X : 0.0f,
+									extent.Y > 0.0f ? 1.0f / extent.Y : 0.0f,
+									extent.Z > 0.0f ? 1.0f / extent.Z : 0.0f);
+		const float		rcpSizeExtent = sizeMax > sizeMin ? 1.0f / (sizeMax - sizeMin) : 0.0f;
+		const float		rcpTwoPi = 1.0f / UE_TWO_PI;
+
+		data.Reserve(data.Num() + sizeof(FVector3f) * 2 + sizeof(float) * 2 + count * (sizeof(uint16) * 5 + sizeof(FFloat16) * 4));
+		_Write(data, positionBounds.Min);
+		_Write(data, extent);
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			const FVector3f	&position = track.Positions[parti];
+			_Write(data, _Quantize(position.X, positionBounds.Min.X, rcpExtent.X));
+			_Write(data, _Quantize(position.Y, positionBounds.Min.Y, rcpExtent.Y));
+			_Write(data, _Quantize(position.Z, positionBounds.Min.Z, rcpExtent.Z));
+		}
+		_Write(data, sizeMin);
+		_Write(data, sizeMax);
+		for (uint32 parti = 0; parti < count; ++parti)
+			_Write(data, _Quantize(track.Sizes[parti], sizeMin, rcpSizeExtent));
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			// Wraps around: 0xFFFF + 1 is 2PI
+			const float	turns = FMath::Frac(track.Rotations[parti] * rcpTwoPi);
+			_Write(data, uint16(FMath::Clamp(FMath::FloorToInt(turns * 65536.0f + 0.5f), 0, 65536) & 0xFFFF));
+		}
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			const FLinearColor	&color = track.Colors[parti];
+			_Write(data, FFloat16(color.R));
+			_Write(data, FFloat16(color.G));
+			_Write(data, FFloat16(color.B));
+			_Write(data, FFloat16(color.A));
+		}
+	}
+
+	//----------------------------------------------------------------------------
+
+	bool	_DecodeTrack(FFrameReader &reader, FPopcornFXSimulationCacheDecodedTrack &outTrack)
+	{
+		uint32	count = 0;
+		if (!reader.Read(count))
+			return false;
+		outTrack.Positions.SetNumUninitialized(0, EAllowShrinking::No);
+		outTrack.Sizes.SetNumUninitialized(0, EAllowShrinking::No);
+		outTrack.Rotations.SetNumUninitialized(0, EAllowShrinking::No);
+		outTrack.Colors.SetNumUninitialized(0, EAllowShrinking::No);
+		if (count == 0)
+			return true;
+
+		FVector3f	min;
+		FVector3f	extent;
+		float		sizeMin = 0.0f;
+		float		sizeMax = 0.0f;
+		if (!reader.Read(min) ||
+			!reader.Read(extent) ||
+			!reader.CanRead(uint64(count) * (sizeof(uint16) * 5 + sizeof(FFloat16) * 4) + sizeof(float) * 2))
+			return false;
+
+		const FVector3f	scale = extent / kQuantizationMax;
+		outTrack.Positions.SetNumUninitialized(count);
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			uint16	x, y, z;
+			reader.Read(x);
+			reader.Read(y);
+			reader.Read(z);
+			outTrack.Positions[parti] = min + FVector3f(x, y, z) * scale;
+		}
+
+		reader.Read(sizeMin);
+		reader.Read(sizeMax);
+		const float	sizeScale = (sizeMax - sizeMin) / kQuantizationMax;
+		outTrack.Sizes.SetNumUninitialized(count);
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			uint16	size;
+			reader.Read(size);
+			outTrack.Sizes[parti] = sizeMin + size * sizeScale;
+		}
+
+		const float	rotationScale = UE_TWO_PI / 65536.0f;
+		outTrack.Rotations.SetNumUninitialized(count);
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			uint16	rotation;
+			reader.Read(rotation);
+			outTrack.Rotations[parti] = rotation * rotationScale;
+		}
+
+		outTrack.Colors.SetNumUninitialized(count);
+		for (uint32 parti = 0; parti < count; ++parti)
+		{
+			FFloat16	r, g, b, a;
+			reader.Read(r);
+			reader.Read(g);
+			reader.Read(b);
+			reader.Read(a);
+			outTrack.Colors[parti] = FLinearColor(r.GetFloat(), g.GetFloat(), b.GetFloat(), a.GetFloat());
+		}
+		return true;
+	}
+}
+
+//----------------------------------------------------------------------------
+
 UPopcornFXSimulationCache::UPopcornFXSimulationCache(const FObjectInitializer& PCIP)
 	: Super(PCIP)
 {
 }
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXSimulationCache::StartRecording(UPopcornFXEmitterComponent *Emitter, float FrameRate, float Duration)
+{
+	check(IsInGameThread());
+
+	if (IsRecording())
+	{
+		UE_LOG(LogPopcornFXSimulationCache, Warning, TEXT("'%s' is already recording"), *GetName());
+		return false;
+	}
+	if (Emitter == null || FrameRate <= 0.0f || Duration <= 0.0f)
+	{
+		UE_LOG(LogPopcornFXSimulationCache, Warning, TEXT("Couldn't start recording '%s': invalid emitter, frame rate or duration"), *GetName());
+		return false;
+	}
+
+	TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe>	recorder = MakeShared<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe>();
+	TArray<FPopcornFXSimulationCacheTrack>								tracks;
+	if (!recorder->Setup(Emitter, FrameRate, Duration, tracks))
+		return false;
+
+	Tracks = MoveTemp(tracks);
+	Frames.Empty();
+	FrameData.Empty();
+	++m_LayoutRevision;
+
+	m_Recorder = recorder;
+	FPopcornFXSimulationCacheRecorder::Register(m_Recorder);
+
+	TWeakObjectPtr<UPopcornFXSimulationCache>	weakThis(this);
+	m_RecorderTickHandle = FWorldDelegates::OnWorldPostActorTick.AddLambda([weakThis](UWorld *world, ELevelTick tickType, float deltaSeconds)
+	{
+		UPopcornFXSimulationCache	*self = weakThis.Get();
+		if (self == null || !self->m_Recorder.IsValid())
+			return;
+		UWorld	*recordedWorld = self->m_Recorder->World();
+		if (recordedWorld == null) // World torn down while recording
+		{
+			self->StopRecording();
+			return;
+		}
+		if (world != recordedWorld)
+			return;
+
+		const float	time = float(world->GetTimeSeconds() - self->m_Recorder->StartTime());
+		if (time > self->m_Recorder->Duration())
+			self->StopRecording();
+		else
+			self->m_Recorder->GameThread_SetTime(time);
+	});
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXSimulationCache::StopRecording()
+{
+	check(IsInGameThread());
+
+	if (!IsRecording())
+		return false;
+
+	FWorldDelegates::OnWorldPostActorTick.Remove(m_RecorderTickHandle);
+	m_RecorderTickHandle.Reset();
+
+	// The render thread might still hold a reference while capturing, Stop() syncs with it
+	FPopcornFXSimulationCacheRecorder::Unregister(m_Recorder.Get());
+	_StoreRecordedFrames();
+	m_Recorder.Reset();
+	++m_LayoutRevision;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCache::_StoreRecordedFrames()
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXSimulationCache::_StoreRecordedFrames", POPCORNFX_UE_PROFILER_COLOR);
+
+	TArray<FPopcornFXSimulationCacheRecorder::SRecordedFrame>	recordedFrames;
+	m_Recorder->Stop(recordedFrames);
+
+	Frames.Empty(recordedFrames.Num());
+	FrameData.Empty();
+	const float	firstTime = recordedFrames.IsEmpty() ? 0.0f : recordedFrames[0].m_Time;
+	for (const FPopcornFXSimulationCacheRecorder::SRecordedFrame &recordedFrame : recordedFrames)
+	{
+		if (!PK_VERIFY(recordedFrame.m_Tracks.Num() == Tracks.Num()))
+			continue;
+		FPopcornFXSimulationCacheFrame	&frame = Frames.AddDefaulted_GetRef();
+		frame.Time = recordedFrame.m_Time - firstTime;
+		frame.DataOffset = FrameData.Num();
+		for (const FPopcornFXSimulationCacheDecodedTrack &track : recordedFrame.m_Tracks)
+			_EncodeTrack(FrameData, track, frame.Bounds);
+		frame.DataSize = FrameData.Num() - frame.DataOffset;
+	}
+	FrameData.Shrink();
+
+	UE_LOG(LogPopcornFXSimulationCache, Log, TEXT("'%s': recorded %d frames (%.2fs, %d bytes)"), *GetName(), Frames.Num(), GetDuration(), FrameData.Num());
+	MarkPackageDirty();
+}
+
+//----------------------------------------------------------------------------
+
+int32	UPopcornFXSimulationCache::FindFrame(float time) const
+{
+	if (Frames.IsEmpty())
+		return -1;
+	// First frame after 'time', minus one
+	const int32	next = Algo::UpperBoundBy(Frames, time, &FPopcornFXSimulationCacheFrame::Time);
+	return FMath::Max(next - 1, 0);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXSimulationCache::DecodeFrame(int32 frameIndex, FPopcornFXSimulationCacheDecodedFrame &outFrame) const
+{
+	TConstArrayView<uint8>	frameData = GetFrameData(frameIndex);
+	if (frameData.IsEmpty())
+		return false;
+	if (!DecodeFrameData(frameData, Tracks.Num(), outFrame))
+	{
+		UE_LOG(LogPopcornFXSimulationCache, Warning, TEXT("'%s': frame %d is corrupted"), *GetName(), frameIndex);
+		return false;
+	}
+	outFrame.FrameIndex = frameIndex;
+	outFrame.Bounds = Frames[frameIndex].Bounds;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+TConstArrayView<uint8>	UPopcornFXSimulationCache::GetFrameData(int32 frameIndex) const
+{
+	if (!Frames.IsValidIndex(frameIndex))
+		return TConstArrayView<uint8>();
+	const FPopcornFXSimulationCacheFrame	&frame = Frames[frameIndex];
+	if (uint64(frame.DataOffset) + frame.DataSize > uint64(FrameData.Num()))
+	{
+		UE_LOG(LogPopcornFXSimulationCache, Warning, TEXT("'%s': frame %d is out of the recorded data"), *GetName(), frameIndex);
+		return TConstArrayView<uint8>();
+	}
+	return TConstArrayView<uint8>(FrameData.GetData() + frame.DataOffset, frame.DataSize);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXSimulationCache::DecodeFrameData(TConstArrayView<uint8> frameData, int32 trackCount, FPopcornFXSimulationCacheDecodedFrame &outFrame)
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXSimulationCache::DecodeFrameData", POPCORNFX_UE_PROFILER_COLOR);
+
+	FFrameReader	reader(frameData.GetData(), frameData.Num());
+	outFrame.FrameIndex = -1;
+	outFrame.Bounds = FBox(ForceInit);
+	outFrame.Tracks.SetNum(trackCount);
+	for (FPopcornFXSimulationCacheDecodedTrack &track : outFrame.Tracks)
+	{
+		if (!_DecodeTrack(reader, track))
+			return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCache::BeginDestroy()
+{
+	if (m_Recorder.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(m_RecorderTickHandle);
+		m_RecorderTickHandle.Reset();
+		FPopcornFXSimulationCacheRecorder::Unregister(m_Recorder.Get());
+		m_Recorder.Reset();
+	}
+	Super::BeginDestroy();
+}
+
+//----------------------------------------------------------------------------
+
+#if WITH_EDITOR
+void	UPopcornFXSimulationCache::PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent)
+{
+	// Track materials edited, or undo/redo: components rebuild their scene proxy
+	++m_LayoutRevision;
+	Super::PostEditChangeProperty(propertyChangedEvent);
+}
+#endif // WITH_EDITOR
+
+//----------------------------------------------------------------------------
@@ -8,6 +8,8 @@
 #include "PopcornFXPlugin.h"
 #include "PopcornFXEmitterComponent.h"
 #include "PopcornFXAttributeList.h"
+#include "Assets/PopcornFXEffect.h"
+#include "Assets/PopcornFXEffectPriv.h"
 #include "Engine/World.h"
 
 #include "PopcornFXSDK.h"
@@ -217,6 +219,98 @@ int32	UPopcornFXAttributeFunctions::FindAttributeIndex(const UPopcornFXEmitterCo
 
 //----------------------------------------------------------------------------
 
+void	UPopcornFXAttributeFunctions::FindAttributeIndices(const UPopcornFXEmitterComponent *Emitter, const TArray<FString> &InAttributeNames, TArray<int32> &OutAttributeIndices)
+{
+	OutAttributeIndices.Init(-1, InAttributeNames.Num());
+	if (!PK_VERIFY(Emitter != null) || !PK_VERIFY(Emitter->Effect != null))
+		return;
+	const UWorld	*world = Emitter->GetWorld();
+	if (!FApp::CanEverRender() || (world != null && world->IsNetMode(NM_DedicatedServer)))
+		return;
+	const UPopcornFXAttributeList	*attrList = Emitter->GetAttributeListIFP();
+	if (!PK_VERIFY(attrList != null))
+		return;
+	for (int32 namei = 0; namei < InAttributeNames.Num(); ++namei)
+		OutAttributeIndices[namei] = attrList->FindAttributeIndex(InAttributeNames[namei]);
+}
+
+//----------------------------------------------------------------------------
+
+int32	UPopcornFXAttributeFunctions::SetAttributesBatched(UPopcornFXEmitterComponent *Emitter, const TArray<FPopcornFXAttributeBatchValue> &InValues, bool InApplyGlobalScale)
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeFunctions::SetAttributesBatched", POPCORNFX_UE_PROFILER_COLOR);
+
+	if (!PK_VERIFY(Emitter != null) || !PK_VERIFY(Emitter->Effect != null))
+		return 0;
+	const UWorld	*world = Emitter->GetWorld();
+	if (!FApp::CanEverRender() || (world != null && world->IsNetMode(NM_DedicatedServer)))
+		return InValues.Num();
+	UPopcornFXAttributeList		*attrList = Emitter->GetAttributeList();
+	if (!PK_VERIFY(attrList != null))
+		return 0;
+
+	// Validate the attribute list once for the whole batch, instead of once per value (see GetAttributeDeclaration)
+	UPopcornFXEffect	*effect = Emitter->Effect;
+	if (attrList->GetDefaultAttributeList(effect) == null)
+		return 0;
+	const PopcornFX::CParticleAttributeList	*effectAttrList = effect->Effect()->AttributeList().Get();
+	if (!PK_VERIFY(effectAttrList != null))
+		return 0;
+	const PopcornFX::TMemoryView<PopcornFX::CParticleAttributeDeclaration const *const>	decls = effectAttrList->UniqueAttributeList();
+	if (!PK_VERIFY(decls.Count() == attrList->AttributeCount()))
+		return 0;
+
+	const float	scale = InApplyGlobalScale ? FPopcornFXPlugin::GlobalScaleRcp() : 1.0f;
+	int32		stagedCount = 0;
+	for (const FPopcornFXAttributeBatchValue &value : InValues)
+	{
+		const u32	attri(value.AttributeIndex);
+		if (attri >= decls.Count())
+		{
+			UE_LOG(LogPopcornFXAttributeFunctions, Warning, TEXT("SetAttributesBatched: invalid AttributeIndex %d (%s)"), value.AttributeIndex, *(Emitter->GetPathName()));
+			continue;
+		}
+		const PopcornFX::CParticleAttributeDeclaration	*decl = decls[attri];
+		if (!PK_VERIFY(decl != null))
+			continue;
+
+		const PopcornFX::CBaseTypeTraits	&traits = PopcornFX::CBaseTypeTraits::Traits((PopcornFX::EBaseTypeID)decl->ExportedType());
+		const u32							dim = PopcornFX::PKMin(u32(traits.VectorDimension), 4U);
+
+		PopcornFX::SAttributesContainer_SAttrib	attribValue;
+		attribValue.m_Data32u[0] = 0;
+		attribValue.m_Data32u[1] = 0;
+		attribValue.m_Data32u[2] = 0;
+		attribValue.m_Data32u[3] = 0;
+		if (traits.ScalarType == PopcornFX::BaseType_Bool)
+		{
+			bool	*dst = reinterpret_cast<bool*>(&attribValue);
+			for (u32 d = 0; d < dim; ++d)
+				dst[d] = value.Value[d] != 0.0;
+		}
+		else if (traits.IsFp)
+		{
+			for (u32 d = 0; d < dim; ++d)
+				attribValue.m_Data32f[d] = float(value.Value[d]) * scale;
+			decl->ClampToRangeIFN(attribValue);
+		}
+		else
+		{
+			s32		*dst = reinterpret_cast<s32*>(&attribValue);
+			for (u32 d = 0; d < dim; ++d)
+				dst[d] = s32(value.Value[d]);
+			decl->ClampToRangeIFN(attribValue);
+		}
+
+		// Ugly cast, so PopcornFXAttributeList.h is a public header to satisfy UE nativization bugs. To refactor some day
+		attrList->StageAttribute(attri, *reinterpret_cast<FPopcornFXAttributeValue*>(&attribValue));
+		++stagedCount;
+	}
+	return stagedCount;
+}
+
+//----------------------------------------------------------------------------
+
 bool	UPopcornFXAttributeFunctions::ResetToDefaultValue(UPopcornFXEmitterComponent *Emitter, int32 InAttributeIndex)
 {
 	return _ResetAttribute(Emitter, InAttributeIndex);
@@ -419,6 +419,7 @@ void	UPopcornFXAttributeList::Clean()
 	m_Attributes.Empty(m_Attributes.Num());
 	m_Samplers.Empty(m_Samplers.Num());
 	m_AttributesRawData.Empty(m_AttributesRawData.Num());
+	_OnLayoutChanged();
 	PK_ASSERT(CheckDataIntegrity());
 
 #if WITH_EDITOR
@@ -428,15 +429,65 @@ void	UPopcornFXAttributeList::Clean()
 
 //----------------------------------------------------------------------------
 
-int32	UPopcornFXAttributeList::FindAttributeIndex(const FString &name) const
+const UPopcornFXAttributeList	*UPopcornFXAttributeList::_NameIndicesSource() const
 {
-	PK_ASSERT(CheckDataIntegrity());
-	for (int32 attri = 0; attri < m_Attributes.Num(); ++attri)
+	// Emitter lists are prepared from their effect's default list: while both match, share its lookups
+	if (m_Effect != null && m_FileVersionId == m_Effect->FileVersionId())
 	{
-		if (m_Attributes[attri].m_AttributeName == name)
-			return attri;
+		const UPopcornFXAttributeList	*defAttribs = m_Effect->DefaultAttributeList;
+		if (defAttribs != null &&
+			defAttribs->m_FileVersionId == m_FileVersionId &&
+			defAttribs->m_Attributes.Num() == m_Attributes.Num() &&
+			defAttribs->m_Samplers.Num() == m_Samplers.Num())
+			return defAttribs;
 	}
-	return -1;
+	return this;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeList::_BuildNameIndicesIFN() const
+{
+	if (m_NameIndicesBuilt)
+		return;
+	PK_ASSERT(IsInGameThread());
+
+	// FString keys hash and compare case-insensitively, same as FString::operator==
+	// On duplicate names, the first one wins
+	m_AttributeIndices.Reset();
+	m_AttributeIndices.Reserve(m_Attributes.Num());
+	for (int32 attri = 0; attri < m_Attributes.Num(); ++attri)
+		m_AttributeIndices.FindOrAdd(m_Attributes[attri].m_AttributeName, attri);
+
+	m_SamplerIndices.Reset();
+	m_SamplerIndices.Reserve(m_Samplers.Num());
+	for (int32 sampleri = 0; sampleri < m_Samplers.Num(); ++sampleri)
+		m_SamplerIndices.FindOrAdd(m_Samplers[sampleri].m_SamplerName, sampleri);
+
+	m_NameIndicesBuilt = true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeList::_OnLayoutChanged()
+{
+	m_NameIndicesBuilt = false;
+	m_AttributeIndices.Reset();
+	m_SamplerIndices.Reset();
+
+	m_StagedAttributes.Empty();
+	m_HasStagedAttributes = false;
+}
+
+//----------------------------------------------------------------------------
+
+int32	UPopcornFXAttributeList::FindAttributeIndex(const FString &name) const
+{
+	PK_ASSERT(CheckDataIntegrity());
+	const UPopcornFXAttributeList	*source = _NameIndicesSource();
+	source->_BuildNameIndicesIFN();
+	const int32	*attri = source->m_AttributeIndices.Find(name);
+	return attri != null ? *attri : -1;
 }
 
 //----------------------------------------------------------------------------
@@ -444,12 +495,10 @@ int32	UPopcornFXAttributeList::FindAttributeIndex(const FString &name) const
 int32	UPopcornFXAttributeList::FindSamplerIndex(const FString &name) const
 {
 	PK_ASSERT(CheckDataIntegrity());
-	for (int32 sampleri = 0; sampleri < m_Samplers.Num(); ++sampleri)
-	{
-		if (m_Samplers[sampleri].m_SamplerName == name)
-			return sampleri;
-	}
-	return -1;
+	const UPopcornFXAttributeList	*source = _NameIndicesSource();
+	source->_BuildNameIndicesIFN();
+	const int32	*sampleri = source->m_SamplerIndices.Find(name);
+	return sampleri != null ? *sampleri : -1;
 }
 
 //----------------------------------------------------------------------------
@@ -615,6 +664,7 @@ void	UPopcornFXAttributeList::SetupDefault(UPopcornFXEffect *effect, bool force)
 	if (attribBytes > 0 && (oldAttributesCount != attrCount))
 		PopcornFX::Mem::Copy(m_AttributesRawData.GetData(), defContainer->Attributes().Data(), attribBytes);
 
+	_OnLayoutChanged();
 	PK_ASSERT(CheckDataIntegrity());
 }
 
@@ -889,6 +939,7 @@ bool	UPopcornFXAttributeList::Prepare(UPopcornFXEffect *effect, bool force)
 	bool	samplersChanged = false;
 	samplersChanged |= PrepareSamplers(&m_Samplers, &refAttrList->m_Samplers);
 
+	_OnLayoutChanged();
 	PK_ASSERT(CheckDataIntegrity());
 
 #if WITH_EDITOR
@@ -924,6 +975,7 @@ void	UPopcornFXAttributeList::CopyFrom(const UPopcornFXAttributeList *other, AAc
 	m_Attributes = other->m_Attributes;
 	m_Samplers = other->m_Samplers;
 	m_AttributesRawData = other->m_AttributesRawData;
+	_OnLayoutChanged();
 
 	if (patchParentActor != null)
 	{
@@ -1089,6 +1141,9 @@ void	UPopcornFXAttributeList::Serialize(FArchive &Ar)
 	// Restore old state
 	Ar.ArNoDelta = arNoDeltaPrev;
 
+	if (Ar.IsLoading())
+		_OnLayoutChanged();
+
 	Ar.UsingCustomVersion(FPopcornFXCustomVersion::GUID);
 
 	//UE_LOG(LogPopcornFXAttributeList, Log, TEXT("--- ATTRLIST Serizalie save %p %s --- %s"), this, (Ar.IsSaving() ? "saving" : "restoring"), *GetFullName());
@@ -1141,6 +1196,7 @@ void	UPopcornFXAttributeList::BeginDestroy()
 
 void	UPopcornFXAttributeList::PostEditUndo()
 {
+	_OnLayoutChanged();
 	if (m_Owner != null)
 		_RefreshAttributes(m_Owner.Get());
 	Super::PostEditUndo();
@@ -1158,6 +1214,8 @@ void	UPopcornFXAttributeList::Scene_PreUpdate(UPopcornFXEmitterComponent *emitte
 	PK_ASSERT(!m_Owner.IsValid() || emitter == m_Owner);
 	m_Owner = emitter;
 
+	FlushStagedAttributes();
+
 	for (int32 sampleri = 0; sampleri < m_Samplers.Num(); ++sampleri)
 	{
 		FPopcornFXSamplerDesc			&desc = m_Samplers[sampleri];
@@ -1223,8 +1281,10 @@ void	UPopcornFXAttributeList::GetAttribute(uint32 attributeId, FPopcornFXAttribu
 #endif
 	PopcornFX::SAttributesContainer_SAttrib	&_outAttribute = *reinterpret_cast<PopcornFX::SAttributesContainer_SAttrib*>(&outAttribute);
 
+	// Staged values didn't reach the effect instance yet
+	const bool						staged = m_HasStagedAttributes && m_StagedAttributes.IsValidIndex(attributeId) && m_StagedAttributes[attributeId];
 	const PopcornFX::EBaseTypeID	typeID = (PopcornFX::EBaseTypeID)m_Attributes[attributeId].AttributeBaseTypeID();
-	if (m_Owner.IsValid() && m_Owner->IsEmitterStarted())
+	if (!staged && m_Owner.IsValid() && m_Owner->IsEmitterStarted())
 	{
 		PopcornFX::CParticleEffectInstance	*effectInstance = m_Owner->_GetEffectInstance();
 
@@ -1271,6 +1331,55 @@ void	UPopcornFXAttributeList::SetAttribute(uint32 attributeId, const FPopcornFXA
 
 //----------------------------------------------------------------------------
 
+void	UPopcornFXAttributeList::StageAttribute(uint32 attributeId, const FPopcornFXAttributeValue &value)
+{
+#if WITH_EDITOR
+	if (!PK_VERIFY(attributeId < (u32)m_Attributes.Num()))
+		return;
+	if (m_Attributes[attributeId].m_IsPrivate)
+		return;
+#else
+	check(attributeId < (u32)m_Attributes.Num());
+#endif
+	AttributeRawDataAttributes(this)[attributeId] = *reinterpret_cast<const PopcornFX::SAttributesContainer_SAttrib*>(&value);
+
+	if (m_StagedAttributes.Num() != m_Attributes.Num())
+		m_StagedAttributes.Init(false, m_Attributes.Num());
+	m_StagedAttributes[attributeId] = true;
+	m_HasStagedAttributes = true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeList::FlushStagedAttributes()
+{
+	if (!m_HasStagedAttributes)
+		return;
+
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeList::FlushStagedAttributes", POPCORNFX_UE_PROFILER_COLOR);
+
+	m_HasStagedAttributes = false;
+
+	// If the emitter isn't started, the whole raw data is sent when it starts (see _RefreshAttributes)
+	PopcornFX::CParticleEffectInstance	*effectInstance = (m_Owner.IsValid() && m_Owner->IsEmitterStarted()) ? m_Owner->_GetEffectInstance() : null;
+	if (effectInstance != null && PK_VERIFY(m_StagedAttributes.Num() == m_Attributes.Num()))
+	{
+		const PopcornFX::TMemoryView<const PopcornFX::SAttributesContainer_SAttrib>	attrValues = AttributeRawDataAttributesConst(this);
+		for (TConstSetBitIterator<> attrIt(m_StagedAttributes); attrIt; ++attrIt)
+		{
+			const int32						attri = attrIt.GetIndex();
+			const FPopcornFXAttributeDesc	&attrDesc = m_Attributes[attri];
+			if (!PK_VERIFY(effectInstance->SetRawAttribute(attri, (PopcornFX::EBaseTypeID)attrDesc.AttributeBaseTypeID(), &attrValues[attri], true)))
+			{
+				UE_LOG(LogPopcornFXAttributeList, Warning, TEXT("Couldn't set attribute %s on effect instance %p"), *attrDesc.m_AttributeName, effectInstance);
+			}
+		}
+	}
+	m_StagedAttributes.Init(false, m_Attributes.Num());
+}
+
+//----------------------------------------------------------------------------
+
 #if WITH_EDITOR
 
 template<typename _Scalar>
@@ -1464,6 +1573,13 @@ void	UPopcornFXAttributeList::_RefreshAttributes(const UPopcornFXEmitterComponen
 			UE_LOG(LogPopcornFXAttributeList, Warning, TEXT("Couldn't set attribute %s on effect instance %p"), *attrDesc.m_AttributeName, effectInstance);
 		}
 	}
+
+	// Everything was just sent, staged values included
+	if (m_HasStagedAttributes)
+	{
+		m_HasStagedAttributes = false;
+		m_StagedAttributes.Init(false, m_Attributes.Num());
+	}
 }
 
 //----------------------------------------------------------------------------
@@ -17,6 +17,8 @@
 #include "Curves/CurveVector.h"
 #include "Curves/CurveLinearColor.h"
 #include "Curves/RichCurve.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/CoreDelegates.h"
 
 //----------------------------------------------------------------------------
 
@@ -31,6 +33,92 @@ DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXAttributeSamplerCurve, Log, All);
 
 #define CURVE_MINIMUM_DELTA	0.01f
 
+//----------------------------------------------------------------------------
+//
+// Baked curves: curve samplers sharing the same UCurve only convert its keys once per revision
+//
+//----------------------------------------------------------------------------
+
+struct FPopcornFXBakedCurve
+{
+	TWeakObjectPtr<UCurveBase>		m_Curve;
+	TArray<FRichCurve>				m_Sources; // Copy of the source channels the curve was baked from, a mismatch means the asset changed
+	bool							m_Valid = false;
+	PopcornFX::CCurveDescriptor		m_Curve0;
+};
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Stale entries are pruned past this count
+	const int32		kMaxBakedCurves = 256;
+
+	PopcornFX::Threads::CCriticalSection							g_BakedCurvesLock;
+	TMap<TObjectKey<UCurveBase>, TUniquePtr<FPopcornFXBakedCurve>>	g_BakedCurves;
+	FDelegateHandle													g_BakedCurvesPreExitHandle;
+
+	bool	_IsSameRevision(const FPopcornFXBakedCurve &baked, const TArray<FRichCurveEditInfo> &curves)
+	{
+		if (baked.m_Sources.Num() != curves.Num())
+			return false;
+		for (int32 i = 0; i < curves.Num(); ++i)
+		{
+			const FRichCurve	*fcurve = static_cast<const FRichCurve *>(curves[i].CurveToEdit);
+			PK_ASSERT(fcurve != null);
+			if (!(baked.m_Sources[i] == *fcurve))
+				return false;
+		}
+		return true;
+	}
+
+	void	_PruneBakedCurves()
+	{
+		for (auto it = g_BakedCurves.CreateIterator(); it; ++it)
+		{
+			if (!it.Value()->m_Curve.IsValid())
+				it.RemoveCurrent();
+		}
+		if (g_BakedCurves.Num() >= kMaxBakedCurves)
+			g_BakedCurves.Empty(); // Still too many live curves: rebake them on demand
+	}
+
+	bool	_CopyCurve(PopcornFX::CCurveDescriptor *dst, const PopcornFX::CCurveDescriptor &src)
+	{
+		const u32	keyCount = src.m_Times.Count();
+		dst->m_Order = src.m_Order;
+		dst->m_Interpolator = src.m_Interpolator;
+		if (dst->m_Times.Count() != keyCount)
+		{
+			if (!PK_VERIFY(dst->Resize(keyCount)))
+				return false;
+		}
+		PK_ASSERT(dst->m_FloatValues.Count() == src.m_FloatValues.Count());
+		PK_ASSERT(dst->m_FloatTangents.Count() == src.m_FloatTangents.Count());
+		PopcornFX::Mem::Copy(dst->m_Times.RawDataPointer(), src.m_Times.RawDataPointer(), keyCount * sizeof(float));
+		PopcornFX::Mem::Copy(dst->m_FloatValues.RawDataPointer(), src.m_FloatValues.RawDataPointer(), src.m_FloatValues.Count() * sizeof(float));
+		PopcornFX::Mem::Copy(dst->m_FloatTangents.RawDataPointer(), src.m_FloatTangents.RawDataPointer(), src.m_FloatTangents.Count() * sizeof(float));
+		dst->m_MinEvalLimits = src.m_MinEvalLimits;
+		dst->m_MaxEvalLimits = src.m_MaxEvalLimits;
+		return true;
+	}
+
+#if UE_BUILD_DEBUG
+	bool	_IsSameCurve(const PopcornFX::CCurveDescriptor &a, const PopcornFX::CCurveDescriptor &b)
+	{
+		return	a.m_Order == b.m_Order &&
+				a.m_Times.Count() == b.m_Times.Count() &&
+				a.m_FloatValues.Count() == b.m_FloatValues.Count() &&
+				a.m_FloatTangents.Count() == b.m_FloatTangents.Count() &&
+				FMemory::Memcmp(a.m_Times.RawDataPointer(), b.m_Times.RawDataPointer(), a.m_Times.Count() * sizeof(float)) == 0 &&
+				FMemory::Memcmp(a.m_FloatValues.RawDataPointer(), b.m_FloatValues.RawDataPointer(), a.m_FloatValues.Count() * sizeof(float)) == 0 &&
+				FMemory::Memcmp(a.m_FloatTangents.RawDataPointer(), b.m_FloatTangents.RawDataPointer(), a.m_FloatTangents.Count() * sizeof(float)) == 0 &&
+				a.m_MinEvalLimits == b.m_MinEvalLimits &&
+				a.m_MaxEvalLimits == b.m_MaxEvalLimits;
+	}
+#endif // UE_BUILD_DEBUG
+} // namespace
+
 //----------------------------------------------------------------------------
 
 struct FAttributeSamplerCurveData
@@ -338,11 +426,63 @@ void	UPopcornFXAttributeSamplerCurve::GetAssociatedCurves(UCurveBase *&curve0, U
 //----------------------------------------------------------------------------
 
 bool	UPopcornFXAttributeSamplerCurve::SetupCurve(PopcornFX::CCurveDescriptor *curveDescriptor, UCurveBase *curve)
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerCurve::SetupCurve", POPCORNFX_UE_PROFILER_COLOR);
+
+	TArray<FRichCurveEditInfo>	curves = curve->GetCurves();
+	if (!PK_VERIFY(curves.Num() == Properties.CurveDimension))
+		return false;
+
+	PK_SCOPEDLOCK(g_BakedCurvesLock);
+	if (!g_BakedCurvesPreExitHandle.IsValid())
+	{
+		// Baked curves are allocated by the PopcornFX runtime, don't keep them past it
+		g_BakedCurvesPreExitHandle = FCoreDelegates::OnEnginePreExit.AddLambda([]()
+		{
+			PK_SCOPEDLOCK(g_BakedCurvesLock);
+			g_BakedCurves.Empty();
+		});
+	}
+
+	const TObjectKey<UCurveBase>	curveKey(curve);
+	if (!g_BakedCurves.Contains(curveKey) && g_BakedCurves.Num() >= kMaxBakedCurves)
+		_PruneBakedCurves();
+
+	TUniquePtr<FPopcornFXBakedCurve>	&baked = g_BakedCurves.FindOrAdd(curveKey);
+	if (baked == null)
+	{
+		baked = MakeUnique<FPopcornFXBakedCurve>();
+		baked->m_Curve = curve;
+	}
+	if (!_IsSameRevision(*baked, curves))
+	{
+		// New curve or the asset was modified since it was baked
+		baked->m_Sources.Reset(curves.Num());
+		for (const FRichCurveEditInfo &editInfo : curves)
+			baked->m_Sources.Add(*static_cast<const FRichCurve *>(editInfo.CurveToEdit));
+		baked->m_Valid = BakeCurve(&baked->m_Curve0, curves);
+	}
+#if UE_BUILD_DEBUG
+	else if (baked->m_Valid)
+	{
+		// The baked curve must match a conversion from scratch
+		PopcornFX::CCurveDescriptor	reference;
+		PK_VERIFY(BakeCurve(&reference, curves));
+		PK_ASSERT(_IsSameCurve(reference, baked->m_Curve0));
+	}
+#endif // UE_BUILD_DEBUG
+	if (!baked->m_Valid)
+		return false;
+	return _CopyCurve(curveDescriptor, baked->m_Curve0);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurve::BakeCurve(PopcornFX::CCurveDescriptor *curveDescriptor, const TArray<FRichCurveEditInfo> &curves)
 {
 	static const float	kMaximumKey = 1.0f - CURVE_MINIMUM_DELTA;
 	static const float	kMinimumKey = CURVE_MINIMUM_DELTA;
 
-	TArray<FRichCurveEditInfo>	curves = curve->GetCurves();
 	if (!PK_VERIFY(curves.Num() == Properties.CurveDimension))
 		return false;
 
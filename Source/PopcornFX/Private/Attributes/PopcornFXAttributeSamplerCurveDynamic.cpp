@@ -22,6 +22,19 @@ DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXAttributeSamplerCurveDynamic, Log, All);
 //
 //----------------------------------------------------------------------------
 
+namespace
+{
+	// Past this, dirty key ranges are merged into a single one
+	const u32	kMaxDirtyKeyRanges = 8;
+
+	// UE5 vectors are doubles, curve values are floats
+	void	_ToFloats(const float &value, float *dst) { dst[0] = value; }
+	void	_ToFloats(const FVector &value, float *dst) { dst[0] = value.X; dst[1] = value.Y; dst[2] = value.Z; }
+	void	_ToFloats(const FLinearColor &value, float *dst) { dst[0] = value.R; dst[1] = value.G; dst[2] = value.B; dst[3] = value.A; }
+}
+
+//----------------------------------------------------------------------------
+
 struct FAttributeSamplerCurveDynamicData
 {
 	PopcornFX::PParticleSamplerDescriptor_Curve_Default	m_Desc;
@@ -30,7 +43,43 @@ struct FAttributeSamplerCurveDynamicData
 	PopcornFX::TArray<float>	m_Times;
 	PopcornFX::TArray<float>	m_Tangents;
 	PopcornFX::TArray<float>	m_Values;
-	bool						m_DirtyValues;
+	bool						m_UserTimes = false;	// false: m_Times are generated from the value count
+	bool						m_DirtyValues = false;	// The whole curve needs to be copied (key count changed, new curve)
+	PopcornFX::TArray<CUint2>	m_DirtyKeyRanges;		// Otherwise, the [x, y[ key ranges to patch into the curve
+
+	void	MarkKeysDirty(u32 firstKey, u32 keyCount)
+	{
+		if (m_DirtyValues || keyCount == 0) // The whole curve is copied anyway
+			return;
+		CUint2	range(firstKey, firstKey + keyCount);
+		for (u32 iRange = 0; iRange < m_DirtyKeyRanges.Count(); )
+		{
+			const CUint2	&other = m_DirtyKeyRanges[iRange];
+			if (range.x() <= other.y() && other.x() <= range.y()) // Overlapping or contiguous
+			{
+				range = CUint2(PopcornFX::PKMin(range.x(), other.x()), PopcornFX::PKMax(range.y(), other.y()));
+				m_DirtyKeyRanges.Remove(iRange);
+			}
+			else
+				++iRange;
+		}
+		if (m_DirtyKeyRanges.Count() >= kMaxDirtyKeyRanges)
+		{
+			for (const CUint2 &other : m_DirtyKeyRanges)
+				range = CUint2(PopcornFX::PKMin(range.x(), other.x()), PopcornFX::PKMax(range.y(), other.y()));
+			m_DirtyKeyRanges.Clear();
+		}
+		if (!m_DirtyKeyRanges.PushBack(range).Valid())
+			m_DirtyValues = true;
+	}
+
+	void	MarkAllDirty()
+	{
+		m_DirtyValues = true;
+		m_DirtyKeyRanges.Clear();
+	}
+
+	bool	IsDirty() const { return m_DirtyValues || !m_DirtyKeyRanges.Empty(); }
 
 	~FAttributeSamplerCurveDynamicData()
 	{
@@ -79,7 +128,7 @@ bool	UPopcornFXAttributeSamplerCurveDynamic::CreateCurveIFN()
 		m_Data->m_Curve0 = PK_NEW(PopcornFX::CCurveDescriptor());
 		if (PK_VERIFY(m_Data->m_Curve0 != null))
 		{
-			m_Data->m_DirtyValues = true;
+			m_Data->MarkAllDirty();
 			m_Data->m_Curve0->m_Order = (u32)CurveDimension;
 			m_Data->m_Curve0->m_Interpolator = CurveInterpolator == ECurveDynamicInterpolator::Linear ?
 				PopcornFX::CInterpolableVectorArray::Interpolator_Linear :
@@ -102,13 +151,26 @@ bool	UPopcornFXAttributeSamplerCurveDynamic::SetValuesGeneric(const TArray<_Type
 		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetValues, Values should contain at least 2 items."));
 		return false;
 	}
-	if ((m_Data->m_Values.Count() / (u32)CurveDimension) != values.Num())
+	const u32	dim = (u32)CurveDimension;
+	if ((m_Data->m_Values.Count() / dim) != valueCount)
 	{
-		if (!PK_VERIFY(m_Data->m_Values.Resize(valueCount * (u32)CurveDimension)))
+		if (!PK_VERIFY(m_Data->m_Values.Resize(valueCount * dim)))
 			return false;
+		m_Data->MarkAllDirty();
+	}
+
+	// Only the keys that actually changed are patched into the curve
+	float	*dstValues = m_Data->m_Values.RawDataPointer();
+	for (u32 iValue = 0; iValue < valueCount; ++iValue, dstValues += dim)
+	{
+		float	value[4];
+		_ToFloats(values[iValue], value);
+		if (FMemory::Memcmp(dstValues, value, sizeof(float) * dim) != 0)
+		{
+			PopcornFX::Mem::Copy(dstValues, value, sizeof(float) * dim);
+			m_Data->MarkKeysDirty(iValue, 1);
+		}
 	}
-	PopcornFX::Mem::Copy(m_Data->m_Values.RawDataPointer(), values.GetData(), sizeof(float) * (u32)CurveDimension * valueCount);
-	m_Data->m_DirtyValues = true;
 	return true;
 }
 
@@ -133,19 +195,67 @@ bool	UPopcornFXAttributeSamplerCurveDynamic::SetTangentsGeneric(const TArray<_Ty
 	{
 		if (!PK_VERIFY(m_Data->m_Tangents.Resize(tangentCount * dim * 2)))
 			return false;
+		m_Data->MarkAllDirty();
+	}
+
+	float	*dstTangents = m_Data->m_Tangents.RawDataPointer();
+	for (u32 iTangent = 0; iTangent < tangentCount; ++iTangent, dstTangents += dim * 2)
+	{
+		float	tangents[8];
+		_ToFloats(arriveTangents[iTangent], tangents);
+		_ToFloats(leaveTangents[iTangent], tangents + dim);
+		if (FMemory::Memcmp(dstTangents, tangents, sizeof(float) * dim * 2) != 0)
+		{
+			PopcornFX::Mem::Copy(dstTangents, tangents, sizeof(float) * dim * 2);
+			m_Data->MarkKeysDirty(iTangent, 1);
+		}
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class _Type>
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetKeysGeneric(const TArray<int32> &keyIndices, const TArray<_Type> &values, const TArray<_Type> *arriveTangents, const TArray<_Type> *leaveTangents)
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerCurveDynamic::SetKeys", POPCORNFX_UE_PROFILER_COLOR);
+
+	const u32	dim = (u32)CurveDimension;
+	const u32	keyCount = m_Data->m_Values.Count() / dim;
+	const bool	setTangents = arriveTangents != null;
+	if (keyIndices.Num() != values.Num() ||
+		(setTangents && (arriveTangents->Num() != values.Num() || leaveTangents->Num() != values.Num())))
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys: KeyIndices count differs from Values/Tangents count"));
+		return false;
+	}
+	if (setTangents && m_Data->m_Tangents.Count() != keyCount * dim * 2)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys: Tangents must be set with SetTangents first"));
+		return false;
+	}
+	for (int32 iKey = 0; iKey < keyIndices.Num(); ++iKey)
+	{
+		const int32	keyIndex = keyIndices[iKey];
+		if (keyIndex < 0 || (u32)keyIndex >= keyCount)
+		{
+			UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys: key %d out of range (the curve has %d keys, set with SetValues)"), keyIndex, keyCount);
+			return false;
+		}
 	}
-	const float	*prevTangents = reinterpret_cast<const float*>(arriveTangents.GetData());
-	const float	*nextTangents = reinterpret_cast<const float*>(leaveTangents.GetData());
-	float		*dstTangents = m_Data->m_Tangents.RawDataPointer();
 
-	for (u32 iTangent = 0; iTangent < tangentCount; ++iTangent)
+	for (int32 iKey = 0; iKey < keyIndices.Num(); ++iKey)
 	{
-		for (u32 iDim = 0; iDim < dim; ++iDim)
-			*dstTangents++ = *prevTangents++;
-		for (u32 iDim = 0; iDim < dim; ++iDim)
-			*dstTangents++ = *nextTangents++;
+		const u32	keyIndex = keyIndices[iKey];
+		_ToFloats(values[iKey], m_Data->m_Values.RawDataPointer() + keyIndex * dim);
+		if (setTangents)
+		{
+			float	*dstTangents = m_Data->m_Tangents.RawDataPointer() + keyIndex * dim * 2;
+			_ToFloats((*arriveTangents)[iKey], dstTangents);
+			_ToFloats((*leaveTangents)[iKey], dstTangents + dim);
+		}
+		m_Data->MarkKeysDirty(keyIndex, 1);
 	}
-	m_Data->m_DirtyValues = true;
 	return true;
 }
 
@@ -166,13 +276,57 @@ bool	UPopcornFXAttributeSamplerCurveDynamic::SetTimes(const TArray<float> &Times
 		return false;
 	}
 	const u32	timesCount = Times.Num();
-	if (PK_VERIFY(m_Data->m_Times.Resize(timesCount)))
+	if (!m_Data->m_UserTimes || m_Data->m_Times.Count() != timesCount)
 	{
-		m_Data->m_DirtyValues = true;
-		PopcornFX::Mem::Copy(m_Data->m_Times.RawDataPointer(), Times.GetData(), sizeof(float) * timesCount);
-		return true;
+		if (!PK_VERIFY(m_Data->m_Times.Resize(timesCount)))
+			return false;
+		m_Data->m_UserTimes = true;
+		m_Data->MarkAllDirty();
+	}
+	float	*dstTimes = m_Data->m_Times.RawDataPointer();
+	for (u32 iTime = 0; iTime < timesCount; ++iTime)
+	{
+		if (dstTimes[iTime] != Times[iTime])
+		{
+			dstTimes[iTime] = Times[iTime];
+			m_Data->MarkKeysDirty(iTime, 1);
+		}
 	}
-	return false;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetKeyTimes(const TArray<int32> &KeyIndices, const TArray<float> &Times)
+{
+	PK_ASSERT(m_Data != null);
+	if (!m_Data->m_UserTimes)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeyTimes: Times must be set with SetTimes first"));
+		return false;
+	}
+	if (KeyIndices.Num() != Times.Num())
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeyTimes: KeyIndices count differs from Times count"));
+		return false;
+	}
+	const u32	keyCount = m_Data->m_Times.Count();
+	for (int32 iKey = 0; iKey < KeyIndices.Num(); ++iKey)
+	{
+		const int32	keyIndex = KeyIndices[iKey];
+		if (keyIndex < 0 || (u32)keyIndex >= keyCount)
+		{
+			UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeyTimes: key %d out of range (%d times)"), keyIndex, keyCount);
+			return false;
+		}
+		PK_ASSERT(Times[iKey] >= 0.0f && Times[iKey] <= 1.0f);
+	}
+	for (int32 iKey = 0; iKey < KeyIndices.Num(); ++iKey)
+	{
+		m_Data->m_Times[KeyIndices[iKey]] = Times[iKey];
+		m_Data->MarkKeysDirty(KeyIndices[iKey], 1);
+	}
+	return true;
 }
 
 //----------------------------------------------------------------------------
@@ -261,57 +415,165 @@ bool	UPopcornFXAttributeSamplerCurveDynamic::SetTangents4D(const TArray<FLinearC
 
 //----------------------------------------------------------------------------
 
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetKeys1D(const TArray<int32> &KeyIndices, const TArray<float> &Values)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float1)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys1D: Curve doesn't have Float1 dimension"));
+		return false;
+	}
+	return SetKeysGeneric<float>(KeyIndices, Values, null, null);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetKeys3D(const TArray<int32> &KeyIndices, const TArray<FVector> &Values)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float3)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys3D: Curve doesn't have Float3 dimension"));
+		return false;
+	}
+	return SetKeysGeneric<FVector>(KeyIndices, Values, null, null);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetKeys4D(const TArray<int32> &KeyIndices, const TArray<FLinearColor> &Values)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float4)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetKeys4D: Curve doesn't have Float4 dimension"));
+		return false;
+	}
+	return SetKeysGeneric<FLinearColor>(KeyIndices, Values, null, null);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetSplineKeys1D(const TArray<int32> &KeyIndices, const TArray<float> &Values, const TArray<float> &ArriveTangents, const TArray<float> &LeaveTangents)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float1)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetSplineKeys1D: Curve doesn't have Float1 dimension"));
+		return false;
+	}
+	if (CurveInterpolator != ECurveDynamicInterpolator::Spline)
+		return SetKeysGeneric<float>(KeyIndices, Values, null, null); // No need to set tangents
+	return SetKeysGeneric<float>(KeyIndices, Values, &ArriveTangents, &LeaveTangents);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetSplineKeys3D(const TArray<int32> &KeyIndices, const TArray<FVector> &Values, const TArray<FVector> &ArriveTangents, const TArray<FVector> &LeaveTangents)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float3)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetSplineKeys3D: Curve doesn't have Float3 dimension"));
+		return false;
+	}
+	if (CurveInterpolator != ECurveDynamicInterpolator::Spline)
+		return SetKeysGeneric<FVector>(KeyIndices, Values, null, null); // No need to set tangents
+	return SetKeysGeneric<FVector>(KeyIndices, Values, &ArriveTangents, &LeaveTangents);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerCurveDynamic::SetSplineKeys4D(const TArray<int32> &KeyIndices, const TArray<FLinearColor> &Values, const TArray<FLinearColor> &ArriveTangents, const TArray<FLinearColor> &LeaveTangents)
+{
+	PK_ASSERT(m_Data != null);
+	if (CurveDimension != EAttributeSamplerCurveDimension::Float4)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Couldn't SetSplineKeys4D: Curve doesn't have Float4 dimension"));
+		return false;
+	}
+	if (CurveInterpolator != ECurveDynamicInterpolator::Spline)
+		return SetKeysGeneric<FLinearColor>(KeyIndices, Values, null, null); // No need to set tangents
+	return SetKeysGeneric<FLinearColor>(KeyIndices, Values, &ArriveTangents, &LeaveTangents);
+}
+
+//----------------------------------------------------------------------------
+
 void	UPopcornFXAttributeSamplerCurveDynamic::_AttribSampler_PreUpdate(float deltaTime)
 {
 	PK_ASSERT(m_Data != null);
 
 	PopcornFX::CCurveDescriptor	*curve = m_Data->m_Curve0;
-	if (curve == null || !m_Data->m_DirtyValues)
+	if (curve == null || !m_Data->IsDirty())
 		return;
 	if (m_Data->m_Values.Empty())
 		return;
 
-	m_Data->m_DirtyValues = false;
-
-	const bool	hasTimes = !m_Data->m_Times.Empty();
-	const bool	hasTangents = !m_Data->m_Tangents.Empty();
-	if (!hasTimes)
+	const u32	dim = (u32)CurveDimension;
+	const u32	valueCount = m_Data->m_Values.Count() / dim;
+	if (!m_Data->m_UserTimes && m_Data->m_Times.Count() != valueCount)
 	{
 		// Generate the times based on the value count (minus one: the first value is at time 0.0f, and the last is at time 1.0f)
-		const u32	timesCount = m_Data->m_Values.Count() / (u32)CurveDimension;
-		if (!PK_VERIFY(m_Data->m_Times.Resize(timesCount)))
+		if (!PK_VERIFY(m_Data->m_Times.Resize(valueCount)))
 			return;
 
 		float		*times = m_Data->m_Times.RawDataPointer();
-		const float	step = 1.0f / (timesCount - 1);
-		for (u32 iTime = 0; iTime < timesCount; ++iTime)
+		const float	step = 1.0f / (valueCount - 1);
+		for (u32 iTime = 0; iTime < valueCount; ++iTime)
 			*times++ = step * iTime;
+		m_Data->MarkAllDirty();
 	}
 
-	if (!CreateCurveIFN())
-		return;
-	const u32	valueCount = m_Data->m_Times.Count();
-	if (!PK_VERIFY(curve->Resize(valueCount)))
-		return;
-
+	const bool	hasTangents = !m_Data->m_Tangents.Empty();
 	if ((hasTangents && m_Data->m_Tangents.Count() / 2 != m_Data->m_Values.Count()) ||
-		(hasTimes && m_Data->m_Times.Count() != m_Data->m_Values.Count() / (u32)CurveDimension))
+		m_Data->m_Times.Count() != valueCount)
 	{
 		UE_LOG(LogPopcornFXAttributeSamplerCurveDynamic, Warning, TEXT("Tangents/Times count differs from values. Make sure to set the same number of values/tangents/times"));
+		m_Data->m_DirtyValues = false;
+		m_Data->m_DirtyKeyRanges.Clear();
 		return;
 	}
-	PopcornFX::Mem::Copy(curve->m_Times.RawDataPointer(), m_Data->m_Times.RawDataPointer(), sizeof(float) * valueCount);
-	PopcornFX::Mem::Copy(curve->m_FloatValues.RawDataPointer(), m_Data->m_Values.RawDataPointer(), sizeof(float) * (u32)CurveDimension * valueCount);
 
-	if (CurveInterpolator == ECurveDynamicInterpolator::Spline)
+	if (!CreateCurveIFN())
+		return;
+	const bool	copyTangents = CurveInterpolator == ECurveDynamicInterpolator::Spline;
+	if (m_Data->m_DirtyValues || curve->m_Times.Count() != valueCount)
+	{
+		PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerCurveDynamic::PreUpdate Copy Curve", POPCORNFX_UE_PROFILER_COLOR);
+
+		if (!PK_VERIFY(curve->Resize(valueCount)))
+			return;
+		PopcornFX::Mem::Copy(curve->m_Times.RawDataPointer(), m_Data->m_Times.RawDataPointer(), sizeof(float) * valueCount);
+		PopcornFX::Mem::Copy(curve->m_FloatValues.RawDataPointer(), m_Data->m_Values.RawDataPointer(), sizeof(float) * dim * valueCount);
+		if (copyTangents)
+		{
+			const u32	tangentsByteCount = sizeof(float) * dim * 2 * valueCount;
+
+			if (hasTangents)
+				PopcornFX::Mem::Copy(curve->m_FloatTangents.RawDataPointer(), m_Data->m_Tangents.RawDataPointer(), tangentsByteCount);
+			else
+				PopcornFX::Mem::Clear(curve->m_FloatTangents.RawDataPointer(), tangentsByteCount);
+		}
+	}
+	else
 	{
-		const u32	tangentsByteCount = sizeof(float) * (u32)CurveDimension * 2 * valueCount;
+		PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerCurveDynamic::PreUpdate Patch Keys", POPCORNFX_UE_PROFILER_COLOR);
 
-		if (hasTangents)
-			PopcornFX::Mem::Copy(curve->m_FloatTangents.RawDataPointer(), m_Data->m_Tangents.RawDataPointer(), tangentsByteCount);
-		else
-			PopcornFX::Mem::Clear(curve->m_FloatTangents.RawDataPointer(), tangentsByteCount);
+		// Patch the modified keys only
+		for (const CUint2 &range : m_Data->m_DirtyKeyRanges)
+		{
+			const u32	firstKey = range.x();
+			const u32	keyCount = PopcornFX::PKMin(range.y(), valueCount) - PopcornFX::PKMin(firstKey, valueCount);
+			if (keyCount == 0)
+				continue;
+			PopcornFX::Mem::Copy(curve->m_Times.RawDataPointer() + firstKey, m_Data->m_Times.RawDataPointer() + firstKey, sizeof(float) * keyCount);
+			PopcornFX::Mem::Copy(curve->m_FloatValues.RawDataPointer() + firstKey * dim, m_Data->m_Values.RawDataPointer() + firstKey * dim, sizeof(float) * dim * keyCount);
+			if (copyTangents && hasTangents)
+				PopcornFX::Mem::Copy(curve->m_FloatTangents.RawDataPointer() + firstKey * dim * 2, m_Data->m_Tangents.RawDataPointer() + firstKey * dim * 2, sizeof(float) * dim * 2 * keyCount);
+		}
 	}
+	m_Data->m_DirtyValues = false;
+	m_Data->m_DirtyKeyRanges.Clear();
 }
 
 //----------------------------------------------------------------------------
@@ -22,6 +22,8 @@
 
 #include "Materials/MaterialInstanceDynamic.h"
 #include "UObject/Package.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
 
 #if (PK_GPU_D3D12 != 0)
 #	include <pk_particles/include/Samplers/D3D12/image_gpu_d3d12.h>
@@ -146,6 +148,41 @@ namespace
 			return PopcornFX::BaseType_Void;
 		};
 	}
+
+	//----------------------------------------------------------------------------
+	//	Grid cells <-> Blueprint values
+
+	template <typename _UEType, typename _PkType>
+	struct	TIsBitwiseGridCell { static constexpr bool	Value = false; };
+	template <> struct	TIsBitwiseGridCell<float, float>					{ static constexpr bool	Value = true; };
+	template <> struct	TIsBitwiseGridCell<int, s32>						{ static constexpr bool	Value = true; };
+	template <> struct	TIsBitwiseGridCell<FIntPoint, PopcornFX::CInt2>		{ static constexpr bool	Value = true; };
+	template <> struct	TIsBitwiseGridCell<FIntVector, PopcornFX::CInt3>	{ static constexpr bool	Value = true; };
+	template <> struct	TIsBitwiseGridCell<FIntVector4, PopcornFX::CInt4>	{ static constexpr bool	Value = true; };
+
+	// UE5 vectors are doubles
+	void	ConvertCell(const PopcornFX::CFloat2 &src, FVector2D &dst) { dst.X = src.x(); dst.Y = src.y(); }
+	void	ConvertCell(const PopcornFX::CFloat3 &src, FVector &dst) { dst.X = src.x(); dst.Y = src.y(); dst.Z = src.z(); }
+	void	ConvertCell(const PopcornFX::CFloat4 &src, FVector4 &dst) { dst.X = src.x(); dst.Y = src.y(); dst.Z = src.z(); dst.W = src.w(); }
+	void	ConvertCell(const FVector2D &src, PopcornFX::CFloat2 &dst) { dst = PopcornFX::CFloat2(src.X, src.Y); }
+	void	ConvertCell(const FVector &src, PopcornFX::CFloat3 &dst) { dst = PopcornFX::CFloat3(src.X, src.Y, src.Z); }
+	void	ConvertCell(const FVector4 &src, PopcornFX::CFloat4 &dst) { dst = PopcornFX::CFloat4(src.X, src.Y, src.Z, src.W); }
+
+	// Calls rowFunc(gridRow, firstValueIndex) for each X row of the region, values being packed X first, then Y, then Z
+	template <typename _PkType, typename _RowFunc>
+	void	ForEachRegionRow(_PkType *cells, const CUint4 &gridDimensions, const FIntVector &regionMin, const FIntVector &regionSize, const _RowFunc &rowFunc)
+	{
+		u32	firstValueIndex = 0;
+		for (int32 z = 0; z < regionSize.Z; ++z)
+		{
+			for (int32 y = 0; y < regionSize.Y; ++y)
+			{
+				const u32	firstCellIndex = ((regionMin.Z + z) * gridDimensions.y() + (regionMin.Y + y)) * gridDimensions.x() + regionMin.X;
+				rowFunc(cells + firstCellIndex, firstValueIndex);
+				firstValueIndex += regionSize.X;
+			}
+		}
+	}
 };
 
 //----------------------------------------------------------------------------
@@ -155,10 +192,18 @@ struct	FAttributeSamplerGridData
 	bool												m_ReloadGrid = true;
 	PopcornFX::PParticleSamplerDescriptor_Grid_Default	m_Desc;
 
+	// Cells modified since the last upload to the GPU grid texture, [m_DirtyMin, m_DirtyMax[
+	bool												m_UploadDirtyRegion = false; // The GPU grid texture has the same layout than the CPU cells
+	bool												m_HasDirtyRegion = false;
+	FIntVector											m_DirtyMin = FIntVector::ZeroValue;
+	FIntVector											m_DirtyMax = FIntVector::ZeroValue;
+
 	void	Clear()
 	{
 		m_Desc = null;
 		m_ReloadGrid = true;
+		m_UploadDirtyRegion = false;
+		m_HasDirtyRegion = false;
 	}
 
 	FAttributeSamplerGridData() {}
@@ -670,6 +715,7 @@ PopcornFX::CParticleSamplerDescriptor	*UPopcornFXAttributeSamplerGrid::_AttribSa
 		m_Data->m_ReloadGrid = false;
 	}
 
+	desc.m_NeedUpdate = m_Data->m_UploadDirtyRegion;
 	return m_Data->m_Desc.Get();
 }
 
@@ -943,10 +989,145 @@ bool	UPopcornFXAttributeSamplerGrid::_RebuildGridSampler(UPopcornFXEmitterCompon
 		descriptor->m_RawDataByteCount = descriptor->m_RawDataRef->DataSizeInBytes();
 	}
 
+	// Cells written from the game thread are uploaded to the GPU grid when it has the same layout
+	m_Data->m_UploadDirtyRegion = needsGPUHandle && texture != null &&
+		GPixelFormats[pixelFormat].BlockBytes == PopcornFX::CBaseTypeTraits::Traits(descriptor->m_DataType).Size;
+	m_Data->m_HasDirtyRegion = false;
+
 	m_Data->m_Desc = descriptor;
 	return true;
 }
 
+//---------------------------------------------------------------------------
+// 
+//	Regions
+// 
+//---------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerGrid::IsRegionInGrid(UPopcornFXAttributeSamplerGrid *Grid, const FIntVector &RegionMin, const FIntVector &RegionSize)
+{
+	PK_ASSERT(Grid != null);
+	const FIntVector	dimensions = Grid->GetDimensions();
+	const FIntVector	regionMax = RegionMin + RegionSize;
+	if (RegionMin.X < 0 || RegionMin.Y < 0 || RegionMin.Z < 0 ||
+		RegionSize.X <= 0 || RegionSize.Y <= 0 || RegionSize.Z <= 0 ||
+		regionMax.X > dimensions.X || regionMax.Y > dimensions.Y || regionMax.Z > dimensions.Z)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerGrid, Error, TEXT("Invalid region (min: %s, size: %s) for grid attribute sampler '%s'"
+			" in actor '%s'%s. Grid size: %s"),
+			*RegionMin.ToString(), *RegionSize.ToString(),
+			*Grid->GetName(), Grid->GetAttachmentRootActor() ? *Grid->GetAttachmentRootActor()->GetName() : TEXT("null"),
+			Grid->bIsInline ? *FString::Printf(TEXT(" for emitter '%s'"), *Grid->GetOuter()->GetName()) : TEXT(""),
+			*dimensions.ToString());
+		return false;
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeSamplerGrid::MarkRegionDirty(FIntVector RegionMin, FIntVector RegionSize)
+{
+	if (m_Data == null || !m_Data->m_UploadDirtyRegion) // Nothing to upload: the CPU sim reads the cells directly
+		return;
+	if (!IsRegionInGrid(this, RegionMin, RegionSize))
+		return;
+
+	const FIntVector	regionMax = RegionMin + RegionSize;
+	if (m_Data->m_HasDirtyRegion)
+	{
+		const FIntVector	&dirtyMin = m_Data->m_DirtyMin;
+		const FIntVector	&dirtyMax = m_Data->m_DirtyMax;
+		m_Data->m_DirtyMin = FIntVector(FMath::Min(dirtyMin.X, RegionMin.X), FMath::Min(dirtyMin.Y, RegionMin.Y), FMath::Min(dirtyMin.Z, RegionMin.Z));
+		m_Data->m_DirtyMax = FIntVector(FMath::Max(dirtyMax.X, regionMax.X), FMath::Max(dirtyMax.Y, regionMax.Y), FMath::Max(dirtyMax.Z, regionMax.Z));
+	}
+	else
+	{
+		m_Data->m_DirtyMin = RegionMin;
+		m_Data->m_DirtyMax = regionMax;
+		m_Data->m_HasDirtyRegion = true;
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	*UPopcornFXAttributeSamplerGrid::GetRawCells(EPopcornFXGridDataType::Type dataType, uint32 cellSizeInBytes, int32 &outCellCount)
+{
+	outCellCount = 0;
+	if (!CanReadFromGrid(this, dataType))
+		return null;
+	const PopcornFX::CParticleSamplerDescriptor_Grid_Default	*desc = m_Data->m_Desc.Get();
+	if (!PK_VERIFY(PopcornFX::CBaseTypeTraits::Traits(desc->m_DataType).Size == cellSizeInBytes))
+		return null;
+	outCellCount = desc->m_GridDimensions.AxialProduct();
+	return desc->m_RawDataPtr;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeSamplerGrid::_AttribSampler_PreUpdate(float deltaTime)
+{
+	if (m_Data != null && m_Data->m_HasDirtyRegion)
+		_UploadDirtyRegion();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXAttributeSamplerGrid::_UploadDirtyRegion()
+{
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerGrid::UploadDirtyRegion", POPCORNFX_UE_PROFILER_COLOR);
+
+	m_Data->m_HasDirtyRegion = false;
+
+	UTexture	*texture = GridTexture();
+	const PopcornFX::CParticleSamplerDescriptor_Grid_Default	*desc = m_Data->m_Desc.Get();
+	if (texture == null || texture->GetResource() == null || desc == null)
+		return;
+
+	// Snapshot the dirty cells: the CPU grid keeps being written while the render thread uploads them
+	const FIntVector	regionMin = m_Data->m_DirtyMin;
+	const FIntVector	regionSize = m_Data->m_DirtyMax - m_Data->m_DirtyMin;
+	const u32			cellSize = PopcornFX::CBaseTypeTraits::Traits(desc->m_DataType).Size;
+	const u32			rowSizeInBytes = regionSize.X * cellSize;
+	TArray<uint8>		regionData;
+	regionData.SetNumUninitialized(rowSizeInBytes * regionSize.Y * regionSize.Z);
+	uint8				*dstRow = regionData.GetData();
+	const u8			*srcCells = reinterpret_cast<const u8*>(desc->m_RawDataPtr);
+	const CUint4		&dimensions = desc->m_GridDimensions;
+	for (int32 z = 0; z < regionSize.Z; ++z)
+	{
+		for (int32 y = 0; y < regionSize.Y; ++y)
+		{
+			const u32	firstCellIndex = ((regionMin.Z + z) * dimensions.y() + (regionMin.Y + y)) * dimensions.x() + regionMin.X;
+			PopcornFX::Mem::Copy(dstRow, srcCells + firstCellIndex * cellSize, rowSizeInBytes);
+			dstRow += rowSizeInBytes;
+		}
+	}
+
+	const bool				isVolumeTexture = texture->IsA<UTextureRenderTargetVolume>();
+	FTextureResource		*resource = texture->GetResource();
+	ENQUEUE_RENDER_COMMAND(PopcornFXUploadGridRegion)(
+		[resource, isVolumeTexture, regionMin, regionSize, rowSizeInBytes, regionData = MoveTemp(regionData)](FRHICommandListImmediate &RHICmdList)
+		{
+			FRHITexture	*textureRHI = resource->GetTextureRHI();
+			if (textureRHI == null)
+				return;
+			if (isVolumeTexture)
+			{
+				const FUpdateTextureRegion3D	region(regionMin.X, regionMin.Y, regionMin.Z, 0, 0, 0, regionSize.X, regionSize.Y, regionSize.Z);
+				RHICmdList.UpdateTexture3D(textureRHI, 0, region, rowSizeInBytes, rowSizeInBytes * regionSize.Y, regionData.GetData());
+			}
+			else
+			{
+				PK_ASSERT(regionSize.Z == 1);
+				const FUpdateTextureRegion2D	region(regionMin.X, regionMin.Y, 0, 0, regionSize.X, regionSize.Y);
+				RHICmdList.UpdateTexture2D(textureRHI, 0, region, rowSizeInBytes, regionData.GetData());
+			}
+		});
+}
+
+//----------------------------------------------------------------------------
+
 //---------------------------------------------------------------------------
 // 
 //	Read functions
@@ -985,22 +1166,37 @@ bool	UPopcornFXAttributeSamplerGrid::CanReadFromGrid(UPopcornFXAttributeSamplerG
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXAttributeSamplerGrid::ReadGridFloatValues(UPopcornFXAttributeSamplerGrid *InSelf, TArray<float> &OutValues)
+template <typename _UEType, typename _PkType>
+void	UPopcornFXAttributeSamplerGrid::_ReadRegion(const FIntVector &regionMin, const FIntVector &regionSize, TArray<_UEType> &outValues) const
 {
-	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float))
-		return false;
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerGrid::ReadRegion", POPCORNFX_UE_PROFILER_COLOR);
+
 	// CPU Grids
 	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+	const PopcornFX::CParticleSamplerDescriptor_Grid_Default	*desc = m_Data->m_Desc.Get();
+	PK_ASSERT(PopcornFX::CBaseTypeTraits::Traits(desc->m_DataType).Size == sizeof(_PkType));
 
-	PopcornFX::TStridedMemoryView<float> values(reinterpret_cast<float*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(float));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
+	outValues.SetNumUninitialized(regionSize.X * regionSize.Y * regionSize.Z);
+	_UEType		*dstValues = outValues.GetData();
+	ForEachRegionRow(reinterpret_cast<const _PkType*>(desc->m_RawDataPtr), desc->m_GridDimensions, regionMin, regionSize, [&](const _PkType *srcCells, u32 firstValueIndex)
 	{
-		OutValues[i] = values[i];
-	}
+		if constexpr (TIsBitwiseGridCell<_UEType, _PkType>::Value)
+			PopcornFX::Mem::Copy(dstValues + firstValueIndex, srcCells, regionSize.X * sizeof(_PkType));
+		else
+		{
+			for (int32 x = 0; x < regionSize.X; ++x)
+				ConvertCell(srcCells[x], dstValues[firstValueIndex + x]);
+		}
+	});
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerGrid::ReadGridFloatValues(UPopcornFXAttributeSamplerGrid *InSelf, TArray<float> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float))
+		return false;
+	InSelf->_ReadRegion<float, float>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1008,20 +1204,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat2Values(UPopcornFXAttributeSam
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float2))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat2> values(reinterpret_cast<PopcornFX::CFloat2*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat2));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-	}
+	InSelf->_ReadRegion<FVector2D, PopcornFX::CFloat2>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1029,21 +1212,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat3Values(UPopcornFXAttributeSam
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float3))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->Properties.SizeX *InSelf->Properties.SizeY *InSelf->Properties.SizeZ;
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat3> values(reinterpret_cast<PopcornFX::CFloat3*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat3));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-		OutValues[i].Z = values[i].y();
-	}
+	InSelf->_ReadRegion<FVector, PopcornFX::CFloat3>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1051,22 +1220,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat4Values(UPopcornFXAttributeSam
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float4))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat4> values(reinterpret_cast<PopcornFX::CFloat4*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat4));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-		OutValues[i].Z = values[i].y();
-		OutValues[i].W = values[i].w();
-	}
+	InSelf->_ReadRegion<FVector4, PopcornFX::CFloat4>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1074,19 +1228,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridIntValues(UPopcornFXAttributeSample
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<int> values(reinterpret_cast<int*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(int));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i] = values[i];
-	}
+	InSelf->_ReadRegion<int, s32>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1094,20 +1236,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridInt2Values(UPopcornFXAttributeSampl
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int2))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt2> values(reinterpret_cast<PopcornFX::CInt2*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt2));
-
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-	}
+	InSelf->_ReadRegion<FIntPoint, PopcornFX::CInt2>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
 	return true;
 }
 
@@ -1115,44 +1244,87 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridInt3Values(UPopcornFXAttributeSampl
 {
 	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int3))
 		return false;
+	InSelf->_ReadRegion<FIntVector, PopcornFX::CInt3>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
+	return true;
+}
 
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+bool	UPopcornFXAttributeSamplerGrid::ReadGridInt4Values(UPopcornFXAttributeSamplerGrid *InSelf, TArray<FIntVector4> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int4))
+		return false;
+	InSelf->_ReadRegion<FIntVector4, PopcornFX::CInt4>(FIntVector::ZeroValue, InSelf->GetDimensions(), OutValues);
+	return true;
+}
 
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt3> values(reinterpret_cast<PopcornFX::CInt3*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt3));
+bool	UPopcornFXAttributeSamplerGrid::ReadGridFloatRegion(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<float> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<float, float>(RegionMin, RegionSize, OutValues);
+	return true;
+}
 
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-		OutValues[i].Z = values[i].y();
-	}
+bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat2Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector2D> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float2) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<FVector2D, PopcornFX::CFloat2>(RegionMin, RegionSize, OutValues);
 	return true;
 }
 
-bool	UPopcornFXAttributeSamplerGrid::ReadGridInt4Values(UPopcornFXAttributeSamplerGrid *InSelf, TArray<FIntVector4> &OutValues)
+bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat3Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector> &OutValues)
 {
-	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int4))
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float3) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
 		return false;
+	InSelf->_ReadRegion<FVector, PopcornFX::CFloat3>(RegionMin, RegionSize, OutValues);
+	return true;
+}
 
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+bool	UPopcornFXAttributeSamplerGrid::ReadGridFloat4Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector4> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Float4) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<FVector4, PopcornFX::CFloat4>(RegionMin, RegionSize, OutValues);
+	return true;
+}
 
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt4> values(reinterpret_cast<PopcornFX::CInt4*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt4));
+bool	UPopcornFXAttributeSamplerGrid::ReadGridIntRegion(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<int> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<int, s32>(RegionMin, RegionSize, OutValues);
+	return true;
+}
 
-	OutValues.SetNum(expectedCount);
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		OutValues[i].X = values[i].x();
-		OutValues[i].Y = values[i].y();
-		OutValues[i].Z = values[i].y();
-		OutValues[i].Z = values[i].w();
-	}
+bool	UPopcornFXAttributeSamplerGrid::ReadGridInt2Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntPoint> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int2) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<FIntPoint, PopcornFX::CInt2>(RegionMin, RegionSize, OutValues);
+	return true;
+}
+
+bool	UPopcornFXAttributeSamplerGrid::ReadGridInt3Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntVector> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int3) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<FIntVector, PopcornFX::CInt3>(RegionMin, RegionSize, OutValues);
+	return true;
+}
+
+bool	UPopcornFXAttributeSamplerGrid::ReadGridInt4Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntVector4> &OutValues)
+{
+	if (!CanReadFromGrid(InSelf, EPopcornFXGridDataType::Int4) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_ReadRegion<FIntVector4, PopcornFX::CInt4>(RegionMin, RegionSize, OutValues);
 	return true;
 }
 
@@ -1162,7 +1334,7 @@ bool	UPopcornFXAttributeSamplerGrid::ReadGridInt4Values(UPopcornFXAttributeSampl
 // 
 //---------------------------------------------------------------------------
 
-bool	UPopcornFXAttributeSamplerGrid::CanWriteToGrid(UPopcornFXAttributeSamplerGrid *Grid, EPopcornFXGridDataType::Type WantedType, const int32 InValuesCount)
+bool	UPopcornFXAttributeSamplerGrid::CanWriteToGrid(UPopcornFXAttributeSamplerGrid *Grid, EPopcornFXGridDataType::Type WantedType, const int32 InValuesCount, const int32 ExpectedCount)
 {
 	if (!Grid)
 	{
@@ -1180,13 +1352,15 @@ bool	UPopcornFXAttributeSamplerGrid::CanWriteToGrid(UPopcornFXAttributeSamplerGr
 		return false;
 	}
 
-	if (!PK_VERIFY(InValuesCount == Grid->GetCellCount()))
+	// ExpectedCount is the region cell count when writing a sub-region
+	const int32	expectedCount = ExpectedCount >= 0 ? ExpectedCount : Grid->GetCellCount();
+	if (!PK_VERIFY(InValuesCount == expectedCount))
 	{
 		UE_LOG(LogPopcornFXAttributeSamplerGrid, Error, TEXT("Invalid input array size when trying to write into grid attribute sampler '%s'"
-			" in actor '%s'%s. Grid size: %d (%d x %d x %d). Input array size: %d"),
+			" in actor '%s'%s. Grid size: %d (%d x %d x %d). Expected array size: %d. Input array size: %d"),
 			*Grid->GetName(), Grid->GetAttachmentRootActor() ? *Grid->GetAttachmentRootActor()->GetName() : TEXT("null"),
 			Grid->bIsInline ? *FString::Printf(TEXT(" for emitter '%s'"), *Grid->GetOuter()->GetName()) : TEXT(""),
-			Grid->GetCellCount(), Grid->Properties.SizeX, Grid->Properties.SizeY, Grid->Properties.SizeZ, InValuesCount);
+			Grid->GetCellCount(), Grid->Properties.SizeX, Grid->Properties.SizeY, Grid->Properties.SizeZ, expectedCount, InValuesCount);
 		return false;
 	}
 	if (!Grid->m_Data || Grid->m_Data->m_Desc == null)
@@ -1202,22 +1376,36 @@ bool	UPopcornFXAttributeSamplerGrid::CanWriteToGrid(UPopcornFXAttributeSamplerGr
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXAttributeSamplerGrid::WriteGridFloatValues(UPopcornFXAttributeSamplerGrid *InSelf, const TArray<float> &InValues)
+template <typename _UEType, typename _PkType>
+void	UPopcornFXAttributeSamplerGrid::_WriteRegion(const FIntVector &regionMin, const FIntVector &regionSize, const TArray<_UEType> &inValues)
 {
-	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float, InValues.Num()))
-		return false;
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerGrid::WriteRegion", POPCORNFX_UE_PROFILER_COLOR);
 
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+	const PopcornFX::CParticleSamplerDescriptor_Grid_Default	*desc = m_Data->m_Desc.Get();
+	PK_ASSERT(PopcornFX::CBaseTypeTraits::Traits(desc->m_DataType).Size == sizeof(_PkType));
+	PK_ASSERT(inValues.Num() == regionSize.X * regionSize.Y * regionSize.Z);
 
-	PopcornFX::TStridedMemoryView<float> values(reinterpret_cast<float*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(float));
-
-	for (u32 i = 0; i < expectedCount; i++)
+	const _UEType	*srcValues = inValues.GetData();
+	ForEachRegionRow(reinterpret_cast<_PkType*>(desc->m_RawDataPtr), desc->m_GridDimensions, regionMin, regionSize, [&](_PkType *dstCells, u32 firstValueIndex)
 	{
-		values[i] = InValues[i];
-	}
+		if constexpr (TIsBitwiseGridCell<_UEType, _PkType>::Value)
+			PopcornFX::Mem::Copy(dstCells, srcValues + firstValueIndex, regionSize.X * sizeof(_PkType));
+		else
+		{
+			for (int32 x = 0; x < regionSize.X; ++x)
+				ConvertCell(srcValues[firstValueIndex + x], dstCells[x]);
+		}
+	});
+	MarkRegionDirty(regionMin, regionSize);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerGrid::WriteGridFloatValues(UPopcornFXAttributeSamplerGrid *InSelf, const TArray<float> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float, InValues.Num()))
+		return false;
+	InSelf->_WriteRegion<float, float>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1225,19 +1413,7 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat2Values(UPopcornFXAttributeSa
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float2, InValues.Num()))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat2> values(reinterpret_cast<PopcornFX::CFloat2*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat2));
-
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-	}
+	InSelf->_WriteRegion<FVector2D, PopcornFX::CFloat2>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1245,20 +1421,7 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat3Values(UPopcornFXAttributeSa
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float3, InValues.Num()))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat3> values(reinterpret_cast<PopcornFX::CFloat3*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat3));
-
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-		values[i].z() = InValues[i].Z;
-	}
+	InSelf->_WriteRegion<FVector, PopcornFX::CFloat3>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1266,21 +1429,7 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat4Values(UPopcornFXAttributeSa
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float4, InValues.Num()))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CFloat4> values(reinterpret_cast<PopcornFX::CFloat4*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CFloat4));
-
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-		values[i].z() = InValues[i].Z;
-		values[i].w() = InValues[i].W;
-	}
+	InSelf->_WriteRegion<FVector4, PopcornFX::CFloat4>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1288,18 +1437,7 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridIntValues(UPopcornFXAttributeSampl
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int, InValues.Num()))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<int> values(reinterpret_cast<int*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(int));
-
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i] = InValues[i];
-	}
+	InSelf->_WriteRegion<int, s32>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1307,19 +1445,7 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridInt2Values(UPopcornFXAttributeSamp
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int2, InValues.Num()))
 		return false;
-
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
-
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt2> values(reinterpret_cast<PopcornFX::CInt2*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt2));
-
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-	}
+	InSelf->_WriteRegion<FIntPoint, PopcornFX::CInt2>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
 	return true;
 }
 
@@ -1327,42 +1453,87 @@ bool	UPopcornFXAttributeSamplerGrid::WriteGridInt3Values(UPopcornFXAttributeSamp
 {
 	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int3, InValues.Num()))
 		return false;
+	InSelf->_WriteRegion<FIntVector, PopcornFX::CInt3>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
+	return true;
+}
 
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+bool	UPopcornFXAttributeSamplerGrid::WriteGridInt4Values(UPopcornFXAttributeSamplerGrid *InSelf, const TArray<FIntVector4> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int4, InValues.Num()))
+		return false;
+	InSelf->_WriteRegion<FIntVector4, PopcornFX::CInt4>(FIntVector::ZeroValue, InSelf->GetDimensions(), InValues);
+	return true;
+}
+
+bool	UPopcornFXAttributeSamplerGrid::WriteGridFloatRegion(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<float> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<float, float>(RegionMin, RegionSize, InValues);
+	return true;
+}
 
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt3> values(reinterpret_cast<PopcornFX::CInt3*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt3));
+bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat2Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector2D> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float2, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<FVector2D, PopcornFX::CFloat2>(RegionMin, RegionSize, InValues);
+	return true;
+}
 
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-		values[i].z() = InValues[i].Z;
-	}
+bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat3Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float3, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<FVector, PopcornFX::CFloat3>(RegionMin, RegionSize, InValues);
 	return true;
 }
 
-bool	UPopcornFXAttributeSamplerGrid::WriteGridInt4Values(UPopcornFXAttributeSamplerGrid *InSelf, const TArray<FIntVector4> &InValues)
+bool	UPopcornFXAttributeSamplerGrid::WriteGridFloat4Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector4> &InValues)
 {
-	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int4, InValues.Num()))
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Float4, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
 		return false;
+	InSelf->_WriteRegion<FVector4, PopcornFX::CFloat4>(RegionMin, RegionSize, InValues);
+	return true;
+}
 
-	// CPU Grids
-	// TODO: GPU Grids
-	const u32	expectedCount = InSelf->GetCellCount();
+bool	UPopcornFXAttributeSamplerGrid::WriteGridIntRegion(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<int> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<int, s32>(RegionMin, RegionSize, InValues);
+	return true;
+}
 
-	PopcornFX::TStridedMemoryView<PopcornFX::CInt4> values(reinterpret_cast<PopcornFX::CInt4*>(InSelf->m_Data->m_Desc->m_RawDataPtr),
-		expectedCount, sizeof(PopcornFX::CInt4));
+bool	UPopcornFXAttributeSamplerGrid::WriteGridInt2Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntPoint> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int2, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<FIntPoint, PopcornFX::CInt2>(RegionMin, RegionSize, InValues);
+	return true;
+}
 
-	for (u32 i = 0; i < expectedCount; i++)
-	{
-		values[i].x() = InValues[i].X;
-		values[i].y() = InValues[i].Y;
-		values[i].z() = InValues[i].Z;
-		values[i].w() = InValues[i].W;
-	}
+bool	UPopcornFXAttributeSamplerGrid::WriteGridInt3Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntVector> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int3, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<FIntVector, PopcornFX::CInt3>(RegionMin, RegionSize, InValues);
+	return true;
+}
+
+bool	UPopcornFXAttributeSamplerGrid::WriteGridInt4Region(UPopcornFXAttributeSamplerGrid *InSelf, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntVector4> &InValues)
+{
+	if (!CanWriteToGrid(InSelf, EPopcornFXGridDataType::Int4, InValues.Num(), RegionSize.X * RegionSize.Y * RegionSize.Z) ||
+		!IsRegionInGrid(InSelf, RegionMin, RegionSize))
+		return false;
+	InSelf->_WriteRegion<FIntVector4, PopcornFX::CInt4>(RegionMin, RegionSize, InValues);
 	return true;
 }
 
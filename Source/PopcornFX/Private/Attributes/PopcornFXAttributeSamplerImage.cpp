@@ -6,6 +6,7 @@
 #include "PopcornFXAttributeSamplerImage.h"
 
 #include "PopcornFXPlugin.h"
+#include "PopcornFXSettings.h"
 #include "PopcornFXStats.h"
 #include "PopcornFXHelper.h"
 #include "PopcornFXAttributeList.h"
@@ -13,6 +14,7 @@
 #include "Assets/PopcornFXEffect.h"
 #include "Assets/PopcornFXEffectPriv.h"
 #include "Assets/PopcornFXTextureAtlas.h"
+#include "Internal/ResourceHandlerImage_UE.h"
 
 #include "PopcornFXSDK.h"
 #include <pk_particles/include/ps_samplers_classes.h>
@@ -27,14 +29,126 @@
 #endif // (PK_GPU_D3D12 != 0)
 
 #include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget.h"
+#include "Engine/World.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/AssetData.h"
+#include "Misc/Crc.h"
+#include "Misc/CoreDelegates.h"
 
 //----------------------------------------------------------------------------
 
 #define LOCTEXT_NAMESPACE "PopcornFXAttributeSamplerImage"
 DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXAttributeSamplerImage, Log, All);
 
+//----------------------------------------------------------------------------
+//
+// Shared density tables: image samplers sampling the same texture with the same density settings share their PDFs
+//
+//----------------------------------------------------------------------------
+
+struct FPopcornFXDensityTableKey
+{
+	FString		m_TexturePath;
+	FGuid		m_TextureGuid; // Changes when the texture is modified or reimported
+	u32			m_Mip = 0;
+	u32			m_DensitySource = 0;
+	float		m_DensityPower = 1.0f;
+	u32			m_AtlasHash = 0; // 0 when no atlas is set
+	u32			m_PrivateId = 0; // Non-zero when the texture's content can change at runtime: the table is owned by a single sampler
+
+	bool	operator == (const FPopcornFXDensityTableKey &other) const
+	{
+		return	m_PrivateId == other.m_PrivateId &&
+				m_TexturePath == other.m_TexturePath &&
+				m_TextureGuid == other.m_TextureGuid &&
+				m_Mip == other.m_Mip &&
+				m_DensitySource == other.m_DensitySource &&
+				m_DensityPower == other.m_DensityPower &&
+				m_AtlasHash == other.m_AtlasHash;
+	}
+
+	friend uint32	GetTypeHash(const FPopcornFXDensityTableKey &key)
+	{
+		const uint32	settingsHash = HashCombine(HashCombine(key.m_Mip, key.m_DensitySource), HashCombine(GetTypeHash(key.m_DensityPower), key.m_AtlasHash));
+		return HashCombine(HashCombine(GetTypeHash(key.m_TexturePath), GetTypeHash(key.m_TextureGuid)), HashCombine(settingsHash, key.m_PrivateId));
+	}
+};
+
+struct FPopcornFXDensityTable
+{
+	FPopcornFXDensityTableKey		m_Key;
+	u32								m_RefCount = 0;
+	u64								m_ReleaseStamp = 0; // Orders unreferenced tables for eviction
+	bool							m_Built = false;
+	PopcornFX::SDensitySamplerData	m_Data;
+};
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Game thread only, unreferenced tables are kept up to UPopcornFXSettings::MaxCachedImageDensityTables
+	TMap<FPopcornFXDensityTableKey, FPopcornFXDensityTable*>	g_DensityTables;
+	u64															g_DensityTablesReleaseStamp = 0;
+	u32															g_DensityTablesPrivateId = 0;
+	FDelegateHandle												g_DensityTablesPreExitHandle;
+
+	void	_EvictUnreferencedDensityTables(int32 maxUnreferencedCount)
+	{
+		TArray<FPopcornFXDensityTable*>	unreferenced;
+		for (const auto &it : g_DensityTables)
+		{
+			if (it.Value->m_RefCount == 0)
+				unreferenced.Add(it.Value);
+		}
+		const int32	evictCount = unreferenced.Num() - FMath::Max(maxUnreferencedCount, 0);
+		if (evictCount <= 0)
+			return;
+		// Least recently released first
+		unreferenced.Sort([](const FPopcornFXDensityTable &a, const FPopcornFXDensityTable &b) { return a.m_ReleaseStamp < b.m_ReleaseStamp; });
+		for (int32 i = 0; i < evictCount; ++i)
+		{
+			PK_VERIFY(g_DensityTables.Remove(unreferenced[i]->m_Key) == 1);
+			delete unreferenced[i];
+		}
+	}
+
+	FPopcornFXDensityTable	*_AcquireDensityTable(const FPopcornFXDensityTableKey &key)
+	{
+		PK_ASSERT(IsInGameThread());
+		if (!g_DensityTablesPreExitHandle.IsValid())
+		{
+			// Don't keep unreferenced tables alive past the PopcornFX runtime
+			g_DensityTablesPreExitHandle = FCoreDelegates::OnEnginePreExit.AddLambda([]() { _EvictUnreferencedDensityTables(0); });
+		}
+		FPopcornFXDensityTable	*&table = g_DensityTables.FindOrAdd(key);
+		if (table == null)
+		{
+			table = new FPopcornFXDensityTable();
+			table->m_Key = key;
+		}
+		++table->m_RefCount;
+		return table;
+	}
+
+	void	_ReleaseDensityTable(FPopcornFXDensityTable *table)
+	{
+		PK_ASSERT(IsInGameThread());
+		PK_ASSERT(table != null && table->m_RefCount > 0);
+		if (--table->m_RefCount > 0)
+			return;
+		table->m_ReleaseStamp = ++g_DensityTablesReleaseStamp;
+		if (!table->m_Built || table->m_Key.m_PrivateId != 0) // Failed builds and private tables are not worth keeping
+		{
+			PK_VERIFY(g_DensityTables.Remove(table->m_Key) == 1);
+			delete table;
+			return;
+		}
+		_EvictUnreferencedDensityTables(FPopcornFXPlugin::Get().Settings()->MaxCachedImageDensityTables);
+	}
+} // namespace
+
 //----------------------------------------------------------------------------
 //
 // UPopcornFXAttributeSamplerImage
@@ -51,7 +165,7 @@ struct FAttributeSamplerImageData
 	PopcornFX::TResourcePtr<PopcornFX::CImageGPU_D3D12>			m_TextureResource_D3D12;
 	PopcornFX::TResourcePtr<PopcornFX::CRectangleListGPU_D3D12>	m_TextureAtlasResource_D3D12;
 #endif // (PK_GPU_D3D12 != 0)
-	PopcornFX::SDensitySamplerData *m_DensityData = null;
+	FPopcornFXDensityTable		*m_DensityTable = null; // Shared, never modified once built
 
 	bool		m_ReloadTexture = true;
 	bool		m_ReloadTextureAtlas = true;
@@ -66,10 +180,19 @@ struct FAttributeSamplerImageData
 		m_TextureAtlasResource_D3D12.Clear();
 #endif // (PK_GPU_D3D12 != 0)
 		m_TextureAtlasResource.Clear();
-		if (m_DensityData != null)
-			m_DensityData->Clear();
+		ReleaseDensityTable();
+	}
+
+	void		ReleaseDensityTable()
+	{
 		if (m_Desc != null)
 			m_Desc->ClearDensity();
+		if (m_DensityTable != null)
+		{
+			_ReleaseDensityTable(m_DensityTable);
+			m_DensityTable = null;
+		}
+		m_RebuildPDF = true;
 	}
 
 	FAttributeSamplerImageData()
@@ -78,8 +201,8 @@ struct FAttributeSamplerImageData
 
 	~FAttributeSamplerImageData()
 	{
-		if (m_DensityData != null)
-			PK_SAFE_DELETE(m_DensityData);
+		if (m_DensityTable != null)
+			_ReleaseDensityTable(m_DensityTable);
 		if (m_ImageSampler != null)
 			PK_SAFE_DELETE(m_ImageSampler);
 	}
@@ -118,6 +241,18 @@ UPopcornFXAttributeSamplerImage::UPopcornFXAttributeSamplerImage(const FObjectIn
 
 //----------------------------------------------------------------------------
 
+void	UPopcornFXAttributeSamplerImage::OnRegister()
+{
+	Super::OnRegister();
+
+	// Start converting the texture on a worker now, instead of stalling the game thread when the effect first samples it
+	const UWorld	*world = GetWorld();
+	if (Properties.Texture != null && world != null && world->IsGameWorld())
+		CResourceHandlerImage_UE::Prefetch(Properties.Texture, FMath::Max(Properties.CPUMipIndex, 0));
+}
+
+//----------------------------------------------------------------------------
+
 void	UPopcornFXAttributeSamplerImage::OnUnregister()
 {
 	if (m_Data != null)
@@ -153,7 +288,8 @@ void	UPopcornFXAttributeSamplerImage::PostEditChangeProperty(FPropertyChangedEve
 		const FString	propertyName = propertyChangedEvent.Property->GetName();
 
 		if (propertyName == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesImage, Texture) ||
-			propertyName == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesImage, bAllowTextureConversionAtRuntime))
+			propertyName == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesImage, bAllowTextureConversionAtRuntime) ||
+			propertyName == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesImage, CPUMipIndex))
 		{
 			m_Data->m_ReloadTexture = true;
 			m_Data->m_RebuildPDF = true;
@@ -188,7 +324,8 @@ void	UPopcornFXAttributeSamplerImage::CopyPropertiesFrom(const UPopcornFXAttribu
 	Super::CopyPropertiesFrom(other);
 
 	if (newImageProperties->Texture != Properties.Texture ||
-		newImageProperties->bAllowTextureConversionAtRuntime != Properties.bAllowTextureConversionAtRuntime)
+		newImageProperties->bAllowTextureConversionAtRuntime != Properties.bAllowTextureConversionAtRuntime ||
+		newImageProperties->CPUMipIndex != Properties.CPUMipIndex)
 	{
 		m_Data->m_ReloadTexture = true;
 		m_Data->m_RebuildPDF = true;
@@ -347,8 +484,9 @@ bool	UPopcornFXAttributeSamplerImage::_RebuildImageSampler()
 	if (rebuildImage)
 	{
 		const PopcornFX::CString	fullPath = ToPk(Properties.Texture->GetPathName());
+		const PopcornFX::CString	cpuPath = CResourceHandlerImage_UE::BuildMipPath(fullPath, FMath::Max(Properties.CPUMipIndex, 0));
 		bool						success = false;
-		m_Data->m_TextureResource = PopcornFX::Resource::DefaultManager()->Load<PopcornFX::CImage>(fullPath, true);
+		m_Data->m_TextureResource = PopcornFX::Resource::DefaultManager()->Load<PopcornFX::CImage>(cpuPath, true);
 		success |= (m_Data->m_TextureResource != null && !m_Data->m_TextureResource->Empty());
 		if (success)
 		{
@@ -374,6 +512,7 @@ bool	UPopcornFXAttributeSamplerImage::_RebuildImageSampler()
 			return false;
 		}
 		m_Data->m_ReloadTexture = false;
+		m_Data->m_RebuildPDF = true; // SetTexture() doesn't flag it
 	}
 	const bool	reloadImageAtlas = m_Data->m_ReloadTextureAtlas;
 	if (reloadImageAtlas)
@@ -452,15 +591,9 @@ bool	UPopcornFXAttributeSamplerImage::_RebuildImageSampler()
 		const bool	both = Properties.SamplingMode == EPopcornFXImageSamplingMode::Both;
 		if (Properties.SamplingMode == EPopcornFXImageSamplingMode::Density || both)
 		{
-			if (m_Data->m_DensityData == null)
-			{
-				m_Data->m_DensityData = PK_NEW(PopcornFX::SDensitySamplerData);
-				if (!PK_VERIFY(m_Data->m_DensityData != null))
-					return false;
-			}
 			if (!_BuildPDFs(dstSurface))
 				return false;
-			if (!PK_VERIFY(m_Data->m_Desc->SetupDensity(m_Data->m_DensityData)))
+			if (!PK_VERIFY(m_Data->m_Desc->SetupDensity(&m_Data->m_DensityTable->m_Data)))
 				return false;
 			if (!both)
 				m_Data->m_Desc->m_Sampler = null;
@@ -471,11 +604,8 @@ bool	UPopcornFXAttributeSamplerImage::_RebuildImageSampler()
 			if (!_BuildRegularImage(dstSurface, rebuildImage))
 				return false;
 			m_Data->m_Desc->m_Sampler = m_Data->m_ImageSampler;
-			if (!both && m_Data->m_DensityData != null)
-			{
-				m_Data->m_DensityData->Clear();
-				m_Data->m_Desc->ClearDensity();
-			}
+			if (!both && m_Data->m_DensityTable != null)
+				m_Data->ReleaseDensityTable();
 		}
 	}
 
@@ -492,9 +622,8 @@ bool	UPopcornFXAttributeSamplerImage::_RebuildImageSampler()
 bool	UPopcornFXAttributeSamplerImage::_BuildPDFs(PopcornFX::CImageSurface &dstSurface)
 {
 	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXAttributeSamplerImage::Build PDF", POPCORNFX_UE_PROFILER_COLOR);
-	if (!m_Data->m_RebuildPDF)
+	if (!m_Data->m_RebuildPDF && m_Data->m_DensityTable != null)
 		return true;
-	m_Data->m_RebuildPDF = false;
 
 	PK_STATIC_ASSERT(EPopcornFXImageDensitySource::Red == (u32)PopcornFX::SImageConvertSettings::LumMode_Red);
 	PK_STATIC_ASSERT(EPopcornFXImageDensitySource::Green == (u32)PopcornFX::SImageConvertSettings::LumMode_Green);
@@ -508,9 +637,59 @@ bool	UPopcornFXAttributeSamplerImage::_BuildPDFs(PopcornFX::CImageSurface &dstSu
 	//settings.m_SampleRawValues = ;
 	if (m_Data->m_TextureAtlasResource != null)
 		settings.m_AtlasRectangleList = m_Data->m_TextureAtlasResource->m_RectsFp32;
-	m_Data->m_DensityData->Clear();
-	if (!PK_VERIFY(m_Data->m_DensityData->Build(dstSurface, settings)))
-		return false;
+
+	// Samplers with the same texture and density settings share the same density table.
+	// Render targets and textures created at runtime have no content revision to key on: never share them.
+	FPopcornFXDensityTableKey	key;
+	key.m_TexturePath = Properties.Texture->GetPathName();
+#if WITH_EDITORONLY_DATA
+	key.m_TextureGuid = Properties.Texture->Source.GetId();
+#else
+	key.m_TextureGuid = Properties.Texture->GetLightingGuid();
+#endif // WITH_EDITORONLY_DATA
+	key.m_Mip = FMath::Max(Properties.CPUMipIndex, 0);
+	key.m_DensitySource = Properties.DensitySource.GetValue();
+	key.m_DensityPower = Properties.DensityPower;
+	if (!settings.m_AtlasRectangleList.Empty())
+	{
+		const PopcornFX::TMemoryView<const CFloat4>	rects = settings.m_AtlasRectangleList;
+		key.m_AtlasHash = FCrc::MemCrc32(rects.Data(), rects.Count() * sizeof(CFloat4), rects.Count());
+	}
+	if (!Properties.Texture->IsAsset() || Properties.Texture->IsA<UTextureRenderTarget>())
+	{
+		if (++g_DensityTablesPrivateId == 0) // 0 is for shared tables
+			++g_DensityTablesPrivateId;
+		key.m_PrivateId = g_DensityTablesPrivateId;
+	}
+
+	FPopcornFXDensityTable	*table = _AcquireDensityTable(key);
+	if (table->m_Built)
+	{
+		INC_DWORD_STAT(STAT_PopcornFX_ImageDensityReuseCount);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_PopcornFX_ImageDensityBuildCount);
+		table->m_Data.Clear();
+		if (!PK_VERIFY(table->m_Data.Build(dstSurface, settings)))
+		{
+			// Not built: dropped right away, the previous table stays in use
+			_ReleaseDensityTable(table);
+			return false;
+		}
+		table->m_Built = true;
+	}
+
+	// Only publish the table once built
+	FPopcornFXDensityTable	*prevTable = m_Data->m_DensityTable;
+	if (prevTable != null)
+	{
+		// m_Desc points to the previous table's data until SetupDensity is called with the new one
+		m_Data->m_Desc->ClearDensity();
+		_ReleaseDensityTable(prevTable);
+	}
+	m_Data->m_DensityTable = table;
+	m_Data->m_RebuildPDF = false;
 	return true;
 }
 
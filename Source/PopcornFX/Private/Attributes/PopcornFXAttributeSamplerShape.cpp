@@ -507,19 +507,71 @@ struct FPopcornFXClothSection
 	PopcornFX::TArray<u32>		m_Indices;
 };
 
-struct FAttributeSamplerShapeData
+namespace
 {
-	bool	m_ShouldUpdateTransforms = false;
-	bool	m_BoneVisibilityChanged = false;
+	struct	SBuildSkinnedMesh;
 
-	float	m_AccumulatedDts = 0.0f;
+	// Skinned streams, also used as FPopcornFXSharedSkinKey::m_Streams
+	enum
+	{
+		None = 0,
+		Build_Positions = 0x1,
+		Build_Normals = 0x2,
+		Build_Tangents = 0x4,
+		Build_Cloth = 0x8,
+		Build_Velocities = 0x10,
+
+		Build_SkinMask = Build_Positions | Build_Normals | Build_Tangents,
+	};
+} // namespace
+
+//----------------------------------------------------------------------------
+//
+// Shared skinning: shape samplers targeting the same skinned mesh component with the same streams skin it once per frame
+//
+//----------------------------------------------------------------------------
+
+struct FPopcornFXSharedSkinKey
+{
+	TWeakObjectPtr<USkinnedMeshComponent>	m_Component;
+	TWeakObjectPtr<USkeletalMesh>			m_SkeletalMesh; // Component's mesh can change at runtime (see UPopcornFXAttributeSamplerShape::Rebuild)
+	u32										m_LODIndex = 0;
+	u32										m_Subsampling = 1;
+	u32										m_Streams = 0;
+
+	bool	operator == (const FPopcornFXSharedSkinKey &other) const
+	{
+		return	m_Component == other.m_Component &&
+				m_SkeletalMesh == other.m_SkeletalMesh &&
+				m_LODIndex == other.m_LODIndex &&
+				m_Subsampling == other.m_Subsampling &&
+				m_Streams == other.m_Streams;
+	}
+
+	friend uint32	GetTypeHash(const FPopcornFXSharedSkinKey &key)
+	{
+		const uint32	meshHash = HashCombine(key.m_LODIndex, HashCombine(key.m_Subsampling, key.m_Streams));
+		return HashCombine(HashCombine(GetTypeHash(key.m_Component), GetTypeHash(key.m_SkeletalMesh)), meshHash);
+	}
+};
+
+struct FPopcornFXSharedSkin
+{
+	FPopcornFXSharedSkinKey		m_Key;
+	u32							m_RefCount = 0;
+	bool						m_Built = false;
+
+	// Game thread only
+	uint64						m_LastStartFrame = 0;
+	uint64						m_LastTickFrame = 0;
+	bool						m_Running = false;
+	u32							m_BoneVisibilitySerial = 0; // Incremented when bones were hidden/unhidden, samplers rebuild their sampling structures
+
+	// Read by the skinning job
+	bool						m_BoneVisibilityChanged = false;
+	float						m_AccumulatedDts = 0.0f;
 
-	UStaticMesh													*m_StaticMesh = null;
-	USkeletalMesh												*m_SkeletalMesh = null;
 	PopcornFX::PMeshNew											m_Mesh;
-	PopcornFX::PParticleSamplerDescriptor_Shape_Default			m_Desc;
-	PopcornFX::PShapeDescriptor									m_Shape;
-	PopcornFX::CMeshSurfaceSamplerStructuresRandom				m_SamplerSurface;
 
 	PopcornFX::TArray<CFloat4, PopcornFX::TArrayAligned16>		m_DstPositions;
 	PopcornFX::TArray<CFloat4, PopcornFX::TArrayAligned16>		m_DstNormals;
@@ -541,6 +593,76 @@ struct FAttributeSamplerShapeData
 	PopcornFX::CSkinAsyncContext				m_AsyncSkinContext;
 	PopcornFX::CSkeletonView					*m_SkeletonView = null;
 
+	~FPopcornFXSharedSkin()
+	{
+		Wait(false);
+		PK_SAFE_DELETE(m_SkeletonView);
+		PK_SAFE_DELETE(m_SkinningStreamsProxy);
+	}
+
+	bool	Build(SBuildSkinnedMesh &buildDesc, const PopcornFX::PMeshNew &mesh, PopcornFX::CBaseSkinningStreams *skinningStreams);
+	void	Tick(float deltaTime);
+	bool	Start();
+	void	Wait(bool consume);
+	void	ClearVelocities();
+
+	void	Skin_PreProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx);
+	void	Skin_PostProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx);
+	void	FetchClothData(uint32 vertexStart, uint32 vertexCount);
+};
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Game thread only, an entry lives as long as a shape sampler references it
+	TMap<FPopcornFXSharedSkinKey, FPopcornFXSharedSkin*>	g_SharedSkins;
+
+	FPopcornFXSharedSkin	*_AcquireSharedSkin(const FPopcornFXSharedSkinKey &key)
+	{
+		PK_ASSERT(IsInGameThread());
+		FPopcornFXSharedSkin	*&skin = g_SharedSkins.FindOrAdd(key);
+		if (skin == null)
+		{
+			skin = new FPopcornFXSharedSkin();
+			skin->m_Key = key;
+		}
+		++skin->m_RefCount;
+		return skin;
+	}
+
+	void	_ReleaseSharedSkin(FPopcornFXSharedSkin *skin)
+	{
+		PK_ASSERT(IsInGameThread());
+		PK_ASSERT(skin != null && skin->m_RefCount > 0);
+		if (--skin->m_RefCount > 0)
+			return;
+		PK_VERIFY(g_SharedSkins.Remove(skin->m_Key) == 1);
+		delete skin;
+	}
+} // namespace
+
+//----------------------------------------------------------------------------
+
+struct FAttributeSamplerShapeData
+{
+	bool	m_ShouldUpdateTransforms = false;
+	bool	m_SkinPending = false; // This sampler requested this frame's skinning and didn't wait for it yet
+	u32		m_BoneVisibilitySerial = 0;
+	u32		m_SkinningLOD = 0; // LOD requested when building m_Mesh (LOD 0 is used if that LOD couldn't be built)
+	u32		m_PendingSkinningLOD = 0; // RenderLOD mode: render LOD waiting to be stable long enough before switching to it
+	u32		m_PendingSkinningLODFrames = 0;
+
+	UStaticMesh													*m_StaticMesh = null;
+	USkeletalMesh												*m_SkeletalMesh = null;
+	PopcornFX::PMeshNew											m_Mesh;
+	PopcornFX::PParticleSamplerDescriptor_Shape_Default			m_Desc;
+	PopcornFX::PShapeDescriptor									m_Shape;
+	PopcornFX::CMeshSurfaceSamplerStructuresRandom				m_SamplerSurface;
+
+	FPopcornFXSharedSkin										*m_Skin = null;
+	TArray<FPopcornFXSharedSkin*, TInlineAllocator<4>>			m_LODSkins; // RenderLOD mode: references on the skins of the LODs previously used, kept built to switch back to them
+
 	PopcornFX::SSamplerSourceOverride			m_Override;
 
 	PopcornFX::CDiscreteProbabilityFunction1D_O1::SWorkingBuffers	m_OverrideSurfaceSamplingWorkingBuffers;
@@ -549,6 +671,30 @@ struct FAttributeSamplerShapeData
 	TWeakObjectPtr<USkinnedMeshComponent>		m_CurrentSkinnedMeshComponent = null;
 };
 
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Releases the LOD skins that 'key' can't switch to anymore, all of them if 'key' is null
+	void	_ReleaseLODSkins(FAttributeSamplerShapeData *data, const FPopcornFXSharedSkinKey *key)
+	{
+		for (int32 iSkin = data->m_LODSkins.Num() - 1; iSkin >= 0; --iSkin)
+		{
+			const FPopcornFXSharedSkinKey	&lodKey = data->m_LODSkins[iSkin]->m_Key;
+			if (key != null &&
+				lodKey.m_Component == key->m_Component &&
+				lodKey.m_SkeletalMesh == key->m_SkeletalMesh &&
+				lodKey.m_Subsampling == key->m_Subsampling &&
+				lodKey.m_Streams == key->m_Streams)
+				continue;
+			_ReleaseSharedSkin(data->m_LODSkins[iSkin]);
+			data->m_LODSkins.RemoveAtSwap(iSkin);
+		}
+	}
+} // namespace
+
+//----------------------------------------------------------------------------
+
 UPopcornFXAttributeSamplerShape::UPopcornFXAttributeSamplerShape(const FObjectInitializer &PCIP)
 	: Super(PCIP)
 	, m_LastFrameUpdate(0)
@@ -610,6 +756,7 @@ void	UPopcornFXAttributeSamplerShape::BeginDestroy()
 	if (m_Data != null)
 	{
 		Clear();
+		_ReleaseLODSkins(m_Data, null);
 		delete m_Data;
 		m_Data = null;
 	}
@@ -669,35 +816,20 @@ void	UPopcornFXAttributeSamplerShape::Clear()
 {
 	PK_ASSERT(m_Data != null);
 
-	PK_SAFE_DELETE(m_Data->m_SkeletonView);
-	PK_SAFE_DELETE(m_Data->m_SkinningStreamsProxy);
-
-	m_Data->m_DstPositions.Clear();
-	m_Data->m_DstNormals.Clear();
-	m_Data->m_DstTangents.Clear();
-	m_Data->m_DstVelocities.Clear();
-	m_Data->m_OldPositions.Clear();
-	m_Data->m_BoneInverseMatrices.Clear();
-
-	m_Data->m_ClothSections.Clear();
-	m_Data->m_ClothSimDataCopy.Empty();
+	if (m_Data->m_Skin != null)
+	{
+		_ReleaseSharedSkin(m_Data->m_Skin);
+		m_Data->m_Skin = null;
+	}
 
 	m_Data->m_ShouldUpdateTransforms = false;
-	m_Data->m_BoneVisibilityChanged = false;
-
-	m_Data->m_AccumulatedDts = 0.0f;
-
-	m_Data->m_SkinContext.m_SrcPositions = TStridedMemoryView<const CFloat3>();
-	m_Data->m_SkinContext.m_SrcNormals = TStridedMemoryView<const CFloat3>();
-	m_Data->m_SkinContext.m_SrcTangents = TStridedMemoryView<const CFloat4>();
-
-	m_Data->m_SkinContext.m_DstPositions = TStridedMemoryView<CFloat3>();
-	m_Data->m_SkinContext.m_DstNormals = TStridedMemoryView<CFloat3>();
-	m_Data->m_SkinContext.m_DstTangents = TStridedMemoryView<CFloat4>();
+	m_Data->m_SkinPending = false;
+	m_Data->m_BoneVisibilitySerial = 0;
 
 	m_Data->m_Override.m_PositionsOverride = TStridedMemoryView<const CFloat3>();
 	m_Data->m_Override.m_NormalsOverride = TStridedMemoryView<const CFloat3>();
 	m_Data->m_Override.m_TangentsOverride = TStridedMemoryView<const CFloat4>();
+	m_Data->m_Override.m_VelocitiesOverride = TStridedMemoryView<const CFloat3>();
 
 	if (m_Data->m_CurrentSkinnedMeshComponent != null)
 	{
@@ -709,18 +841,17 @@ void	UPopcornFXAttributeSamplerShape::Clear()
 
 //----------------------------------------------------------------------------
 
-void	UPopcornFXAttributeSamplerShape::Skin_PreProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx)
+void	FPopcornFXSharedSkin::Skin_PreProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx)
 {
 	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::Skin_PreProcess", POPCORNFX_UE_PROFILER_COLOR);
 
-	PK_ASSERT(m_Data != null);
-	PK_ASSERT(vertexStart + vertexCount <= m_Data->m_DstPositions.Count());
-	PK_ASSERT(m_Data->m_DstPositions.Count() == m_Data->m_OldPositions.Count());
-	PK_ASSERT(m_Data->m_DstPositions.Count() == m_Data->m_DstVelocities.Count());
+	PK_ASSERT(vertexStart + vertexCount <= m_DstPositions.Count());
+	PK_ASSERT(m_DstPositions.Count() == m_OldPositions.Count());
+	PK_ASSERT(m_DstPositions.Count() == m_DstVelocities.Count());
 
 	PopcornFX::TStridedMemoryView<const CFloat3>	src = ctx.m_DstPositions.Slice(vertexStart, vertexCount);
 
-	PopcornFX::TStridedMemoryView<CFloat3>	dst = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_OldPositions.RawDataPointer()), m_Data->m_OldPositions.Count(), 16).Slice(vertexStart, vertexCount);
+	PopcornFX::TStridedMemoryView<CFloat3>	dst = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_OldPositions.RawDataPointer()), m_OldPositions.Count(), 16).Slice(vertexStart, vertexCount);
 
 	PK_ASSERT(src.Stride() == 0x10 && dst.Stride() == 0x10);
 	PopcornFX::Mem::Copy(dst.Data(), src.Data(), dst.Count() * dst.Stride());
@@ -728,24 +859,23 @@ void	UPopcornFXAttributeSamplerShape::Skin_PreProcess(uint32 vertexStart, uint32
 
 //----------------------------------------------------------------------------
 
-void	UPopcornFXAttributeSamplerShape::Skin_PostProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx)
+void	FPopcornFXSharedSkin::Skin_PostProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx)
 {
-	PK_ASSERT(m_Data != null);
-	PK_ASSERT(m_Data->m_Mesh != null);
+	PK_ASSERT(m_Mesh != null);
 
-	if (Properties.bBuildClothData && !m_Data->m_ClothSections.Empty())
+	if ((m_Key.m_Streams & Build_Cloth) && !m_ClothSections.Empty())
 		FetchClothData(vertexStart, vertexCount);
-	if (!Properties.bComputeVelocities)
+	if ((m_Key.m_Streams & Build_Velocities) == 0)
 		return;
 	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::Skin_PostProcess", POPCORNFX_UE_PROFILER_COLOR);
 
 	PopcornFX::TStridedMemoryView<const CFloat3>	posCur = ctx.m_DstPositions.Slice(vertexStart, vertexCount);
-	PopcornFX::TStridedMemoryView<const CFloat3>	posOld = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_OldPositions.RawDataPointer()), m_Data->m_OldPositions.Count(), 16).Slice(vertexStart, vertexCount);
-	PopcornFX::TStridedMemoryView<CFloat3>			vel = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_DstVelocities.RawDataPointer()), m_Data->m_DstVelocities.Count(), 16).Slice(vertexStart, vertexCount);
+	PopcornFX::TStridedMemoryView<const CFloat3>	posOld = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_OldPositions.RawDataPointer()), m_OldPositions.Count(), 16).Slice(vertexStart, vertexCount);
+	PopcornFX::TStridedMemoryView<CFloat3>			vel = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_DstVelocities.RawDataPointer()), m_DstVelocities.Count(), 16).Slice(vertexStart, vertexCount);
 
 	if (vel.Empty())
 		return;
-	if (m_Data->m_AccumulatedDts >= POPCORNFX_MAX_ANIM_IDLE_TIME)
+	if (m_AccumulatedDts >= POPCORNFX_MAX_ANIM_IDLE_TIME)
 	{
 		PopcornFX::Mem::Clear(vel.Data(), vel.CoveredBytes());
 		return;
@@ -762,7 +892,7 @@ void	UPopcornFXAttributeSamplerShape::Skin_PostProcess(uint32 vertexStart, uint3
 	PK_ASSERT(PopcornFX::Mem::IsAligned<0x10>(curPosPtr));
 	PK_ASSERT(PopcornFX::Mem::IsAligned<0x10>(oldPosPtr));
 
-	const float				invDt = 1.0f / m_Data->m_AccumulatedDts;
+	const float				invDt = 1.0f / m_AccumulatedDts;
 	const VectorRegister4f	iDt = MakeVectorRegister(invDt, invDt, invDt, invDt);
 
 	for (u32 iVertex = 0; iVertex < vertexCount; ++iVertex)
@@ -781,17 +911,19 @@ void	UPopcornFXAttributeSamplerShape::Skin_PostProcess(uint32 vertexStart, uint3
 
 //----------------------------------------------------------------------------
 
-void	UPopcornFXAttributeSamplerShape::Skin_Finish(const PopcornFX::SSkinContext &ctx)
+void	UPopcornFXAttributeSamplerShape::UpdateSamplingAccelStructs()
 {
-	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::Skin_Finish", POPCORNFX_UE_PROFILER_FAST_COLOR);
+	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::UpdateSamplingAccelStructs", POPCORNFX_UE_PROFILER_FAST_COLOR);
 
 	PK_ASSERT(m_Data != null);
 	PK_ASSERT(m_Data->m_Mesh != null);
 
-	// Rebuild sampling structures if bone visibility array has changed
-	if (!m_Data->m_BoneVisibilityChanged)
+	const FPopcornFXSharedSkin	*skin = m_Data->m_Skin;
+	if (skin == null || m_Data->m_BoneVisibilitySerial == skin->m_BoneVisibilitySerial)
 		return;
+	m_Data->m_BoneVisibilitySerial = skin->m_BoneVisibilitySerial;
 
+	// Rebuild sampling structures if bone visibility array has changed
 	if (!Properties.bSkinPositions)
 	{
 		// @TODO : warn the user that distribution will be invalid if he only checked bSkinNormals or bSkinTangents
@@ -804,7 +936,7 @@ void	UPopcornFXAttributeSamplerShape::Skin_Finish(const PopcornFX::SSkinContext
 	if (Properties.ShapeSamplingMode == EPopcornFXMeshSamplingMode::Type::Weighted)
 		rebuildAccelStruct = m_Data->m_Mesh->SetupSurfaceSamplingAccelStructs(0, Properties.DensityColorChannel, m_Data->m_OverrideSurfaceSamplingAccelStructs, &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
 	else
-		rebuildAccelStruct = m_Data->m_OverrideSurfaceSamplingAccelStructs.Build(m_Data->m_Mesh->TriangleBatch().m_IStream, m_Data->m_SkinContext.m_DstPositions, &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
+		rebuildAccelStruct = m_Data->m_OverrideSurfaceSamplingAccelStructs.Build(m_Data->m_Mesh->TriangleBatch().m_IStream, skin->m_SkinContext.m_DstPositions, &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
 
 	if (!PK_VERIFY(rebuildAccelStruct))
 	{
@@ -840,20 +972,20 @@ namespace	PopcornFXAttributeSamplers
 
 //----------------------------------------------------------------------------
 
-void	UPopcornFXAttributeSamplerShape::FetchClothData(uint32 vertexStart, uint32 vertexCount)
+void	FPopcornFXSharedSkin::FetchClothData(uint32 vertexStart, uint32 vertexCount)
 {
 	// Done during skinning job's PostProcess callback
 	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::FetchClothData", POPCORNFX_UE_PROFILER_COLOR);
 
-	const TMap<int32, FClothSimulData>	&clothData = m_Data->m_ClothSimDataCopy;
+	const TMap<int32, FClothSimulData>	&clothData = m_ClothSimDataCopy;
 	if (clothData.Num() == 0)
 		return;
 
 	const float			invScale = FPopcornFXPlugin::GlobalScaleRcp();
-	const FMatrix44f	localM = m_Data->m_InverseTransforms * invScale;
-	for (u32 iSection = 0; iSection < m_Data->m_ClothSections.Count(); ++iSection)
+	const FMatrix44f	localM = m_InverseTransforms * invScale;
+	for (u32 iSection = 0; iSection < m_ClothSections.Count(); ++iSection)
 	{
-		const FPopcornFXClothSection	&section = m_Data->m_ClothSections[iSection];
+		const FPopcornFXClothSection	&section = m_ClothSections[iSection];
 
 		const u32	baseVertexOffset = section.m_BaseVertexOffset;
 		if (baseVertexOffset > vertexStart + vertexCount ||
@@ -879,10 +1011,11 @@ void	UPopcornFXAttributeSamplerShape::FetchClothData(uint32 vertexStart, uint32
 			const u32		*srcIndices = section.m_Indices.RawDataPointer() + indicesStart;
 
 			CFloat4		_dummyNormal[1];
-			CFloat4		*dstPositions = m_Data->m_DstPositions.RawDataPointer() + realVertexStart;
-			CFloat4		*dstNormals = Properties.bSkinNormals ? m_Data->m_DstPositions.RawDataPointer() + realVertexStart : _dummyNormal;
+			CFloat4		*dstPositions = m_DstPositions.RawDataPointer() + realVertexStart;
+			const bool	skinNormals = (m_Key.m_Streams & Build_Normals) != 0;
+			CFloat4		*dstNormals = skinNormals ? m_DstNormals.RawDataPointer() + realVertexStart : _dummyNormal;
 
-			const u32	dstStride = Properties.bSkinNormals ? 0x10 : 0;
+			const u32	dstStride = skinNormals ? 0x10 : 0;
 
 			for (u32 iVertex = 0; iVertex < realVertexCount; ++iVertex)
 			{
@@ -1047,7 +1180,11 @@ void	UPopcornFXAttributeSamplerShape::PostEditChangeProperty(FPropertyChangedEve
 			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, bSkinTangents) ||
 			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, bBuildColors) ||
 			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, bBuildUVs) ||
-			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, bBuildClothData))
+			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, bBuildClothData) ||
+			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, SkinningLODMode) ||
+			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, SkinningLOD) ||
+			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, SkinningLODBias) ||
+			propertyChangedEvent.Property->GetName() == GET_MEMBER_NAME_STRING_CHECKED(FPopcornFXAttributeSamplerPropertiesShape, SkinningSubsampling))
 		{
 			if (!Properties.bSkinPositions)
 				Properties.bComputeVelocities = false;
@@ -1120,7 +1257,11 @@ void	UPopcornFXAttributeSamplerShape::CopyPropertiesFrom(const UPopcornFXAttribu
 		newShapeProperties->bSkinTangents != oldProperties.bSkinTangents ||
 		newShapeProperties->bBuildColors != oldProperties.bBuildColors ||
 		newShapeProperties->bBuildUVs != oldProperties.bBuildUVs ||
-		newShapeProperties->bBuildClothData != oldProperties.bBuildClothData)
+		newShapeProperties->bBuildClothData != oldProperties.bBuildClothData ||
+		newShapeProperties->SkinningLODMode != oldProperties.SkinningLODMode ||
+		newShapeProperties->SkinningLOD != oldProperties.SkinningLOD ||
+		newShapeProperties->SkinningLODBias != oldProperties.SkinningLODBias ||
+		newShapeProperties->SkinningSubsampling != oldProperties.SkinningSubsampling)
 	{
 		if (!newShapeProperties->bSkinPositions)
 			Properties.bComputeVelocities = false;
@@ -1243,11 +1384,11 @@ void	UPopcornFXAttributeSamplerShape::TickComponent(float deltaTime, ELevelTick
 	if (Properties.ShapeType == EPopcornFXAttribSamplerShapeType::SkeletalMesh)
 	{
 		PK_ASSERT(m_Data != null);
-		m_Data->m_ClothSimDataCopy.Empty();
 
 		// Don't skin anything if we don't have any skinned mesh component assigned
-		const USkinnedMeshComponent *skinnedMesh = m_Data->m_CurrentSkinnedMeshComponent.Get();
-		if (skinnedMesh == null || m_Data->m_Mesh == null /*Legit, if bPlayOnLoad == false, early out*/)
+		const USkinnedMeshComponent	*skinnedMesh = m_Data->m_CurrentSkinnedMeshComponent.Get();
+		FPopcornFXSharedSkin		*skin = m_Data->m_Skin;
+		if (skinnedMesh == null || skin == null || m_Data->m_Mesh == null /*Legit, if bPlayOnLoad == false, early out*/)
 		{
 			PK_ASSERT(!m_Data->m_ShouldUpdateTransforms);
 			return;
@@ -1258,26 +1399,27 @@ void	UPopcornFXAttributeSamplerShape::TickComponent(float deltaTime, ELevelTick
 			&& !Properties.bPauseSkinning;
 
 		// We don't want to interpolate more than POPCORNFX_MAX_ANIM_IDLE_TIME of inactive animation.
-		if (m_Data->m_AccumulatedDts < POPCORNFX_MAX_ANIM_IDLE_TIME)
-			m_Data->m_AccumulatedDts += GetWorld()->DeltaTimeSeconds;
+		skin->Tick(GetWorld()->DeltaTimeSeconds);
 		if (shouldUpdateTransforms)
 		{
 			// This means that no emitter is attached to this attr sampler, automatically pause skinning
-			if (m_Data->m_AsyncSkinContext.m_SkinMergeJob != null)
+			if (m_Data->m_SkinPending)
 			{
 				PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::TickComponent AsyncSkinWait", POPCORNFX_UE_PROFILER_COLOR);
 
 				// @TODO : Warn the user that they'll have to unpause the skinner when rehooking an effect to this attr sampler
-				PopcornFX::CSkeletalSkinnerSimple::AsyncSkinWait(m_Data->m_AsyncSkinContext, null);
+				skin->Wait(false);
+				m_Data->m_SkinPending = false;
 				Properties.bPauseSkinning = true;
 				return;
 			}
 			shouldUpdateTransforms = UpdateSkinning();
+			m_Data->m_SkinPending = shouldUpdateTransforms;
 		}
 		else if (m_Data->m_ShouldUpdateTransforms)
 		{
-			// Clear velocities
-			PopcornFX::Mem::Clear(m_Data->m_DstVelocities.RawDataPointer(), sizeof(CFloat4) * m_Data->m_DstVelocities.Count());
+			// Clear velocities, unless another sampler is skinning the mesh this frame
+			skin->ClearVelocities();
 		}
 		m_Data->m_ShouldUpdateTransforms = shouldUpdateTransforms;
 	}
@@ -1418,20 +1560,37 @@ namespace
 		return comp->GetComponentSpaceTransforms();
 	}
 
-	enum
+	// RenderLOD mode: frames a new render LOD must be kept before the sampler switches to it
+	const u32	kSkinningLODSwitchFrames = 8;
+
+	u32	_ResolveSkinningLOD(const FPopcornFXAttributeSamplerPropertiesShape &properties, const USkinnedMeshComponent *skinnedMesh)
 	{
-		None = 0,
-		Build_Positions = 0x1,
-		Build_Normals = 0x2,
-		Build_Tangents = 0x4,
-		Build_Cloth = 0x8,
-	};
+		const FSkeletalMeshRenderData	*skelMeshRenderData = skinnedMesh != null ? skinnedMesh->GetSkeletalMeshRenderData() : null;
+		if (skelMeshRenderData == null || skelMeshRenderData->LODRenderData.Num() == 0)
+			return 0;
+
+		int32	lod = 0;
+		switch (properties.SkinningLODMode)
+		{
+		case	EPopcornFXSkinningLOD::RenderLOD:
+			lod = skinnedMesh->GetPredictedLODLevel() + properties.SkinningLODBias;
+			break;
+		case	EPopcornFXSkinningLOD::Fixed:
+			lod = properties.SkinningLOD;
+			break;
+		default:
+			break;
+		}
+		return FMath::Clamp(lod, 0, skelMeshRenderData->LODRenderData.Num() - 1);
+	}
 
 	struct	SBuildSkinnedMesh
 	{
 		USkinnedMeshComponent				*m_SkinnedMeshComponent = null;
 		USkeletalMesh						*m_SkeletalMesh = null;
 		const FSkeletalMeshLODRenderData	*m_LODRenderData = null;
+		u32									m_LODIndex = 0;
+		bool								m_Subsampled = false; // Mesh vertices don't match m_LODRenderData's
 
 		u32		m_TotalVertexCount;
 
@@ -1441,7 +1600,7 @@ namespace
 
 		u32		m_BuildFlags = 0;
 
-		bool	Initialize(USkinnedMeshComponent *skinnedMesh)
+		bool	Initialize(USkinnedMeshComponent *skinnedMesh, u32 lodIndex)
 		{
 			PK_NAMEDSCOPEDPROFILE_C("InitBuildDesc", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -1455,9 +1614,11 @@ namespace
 			const FSkeletalMeshRenderData *skelMeshRenderData = m_SkinnedMeshComponent->GetSkeletalMeshRenderData();
 			if (!PK_VERIFY(skelMeshRenderData != null && skelMeshRenderData->LODRenderData.Num() > 0))
 				return false;
-			m_LODRenderData = &skelMeshRenderData->LODRenderData[0];
+			m_LODIndex = PopcornFX::PKMin(lodIndex, u32(skelMeshRenderData->LODRenderData.Num() - 1));
+			m_LODRenderData = &skelMeshRenderData->LODRenderData[m_LODIndex];
 
-			m_TotalBoneCount = m_LODRenderData->RequiredBones.Num();
+			// Bone indices reference the whole skeleton, regardless of the LOD (see UPopcornFXMesh::NewResourceMesh)
+			m_TotalBoneCount = skelMeshRenderData->LODRenderData[0].RequiredBones.Num();
 			if (!PK_VERIFY(m_TotalBoneCount > 0))
 				return false;
 			m_SmallBoneIndices = m_TotalBoneCount <= 256;
@@ -1471,7 +1632,7 @@ namespace
 	};
 
 	template<typename _IndexType>
-	bool	_FillBuffers(FAttributeSamplerShapeData *data, SBuildSkinnedMesh &buildDesc, PopcornFX::CMeshVStream &vstream, PopcornFX::CBaseSkinningStreams *skinningStreams)
+	bool	_FillBuffers(FPopcornFXSharedSkin *data, SBuildSkinnedMesh &buildDesc, PopcornFX::CMeshVStream &vstream, PopcornFX::CBaseSkinningStreams *skinningStreams)
 	{
 		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::FillBuffers", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -1522,6 +1683,31 @@ namespace
 			PK_ASSERT(GetMasterBoneMap(buildDesc.m_SkinnedMeshComponent).Num() == Cast<USkeletalMesh>(buildDesc.m_SkinnedMeshComponent->GetSkinnedAsset())->GetRefSkeleton().GetNum());
 		}
 
+		if (buildDesc.m_Subsampled)
+		{
+			// Vertices were compacted, sections don't apply anymore (no cloth)
+			PK_ASSERT((buildDesc.m_BuildFlags & Build_Cloth) == 0);
+			if (!skin || !hasMasterPoseComponent)
+				return true;
+
+			PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::Subsampled - Bindpose", POPCORNFX_UE_PROFILER_COLOR);
+			const TArray<int32>	&masterBoneMap = GetMasterBoneMap(buildDesc.m_SkinnedMeshComponent);
+			for (u32 iVertex = 0; iVertex < buildDesc.m_TotalVertexCount; ++iVertex)
+			{
+				const u32	offsetInfluences = iVertex * buildDesc.m_MaxInfluenceCount;
+				PK_ASSERT(offsetInfluences + buildDesc.m_MaxInfluenceCount <= srcBoneWeights.Count());
+				for (u32 iInfluence = 0; iInfluence < buildDesc.m_MaxInfluenceCount; ++iInfluence)
+				{
+					// We can stop copying data, weights are sorted
+					if (srcBoneWeights[offsetInfluences + iInfluence] == 0.0f)
+						break;
+					const _IndexType	masterBoneMapIndex = masterBoneMap[srcBoneIndices[offsetInfluences + iInfluence]];
+					boneIndices[offsetInfluences + iInfluence] = masterBoneMapIndex;
+				}
+			}
+			return true;
+		}
+
 		PK_ONLY_IF_ASSERTS(u32 totalVertices = 0);
 
 		const float		scale = FPopcornFXPlugin::GlobalScale();
@@ -1555,7 +1741,8 @@ namespace
 
 					if (clothAsset != null && clothAsset->LodData.Num() > 0)
 					{
-						const FClothLODDataCommon &lodData = clothAsset->LodData[0];
+						const int32					clothLOD = FMath::Clamp(section.ClothingData.AssetLodIndex, 0, clothAsset->LodData.Num() - 1);
+						const FClothLODDataCommon	&lodData = clothAsset->LodData[clothLOD];
 						const FClothPhysicalMeshData &physMeshData = lodData.PhysicalMeshData;
 
 						clothVertices = PopcornFX::TMemoryView<const FVector3f>(physMeshData.Vertices.GetData(), physMeshData.Vertices.Num());
@@ -1644,109 +1831,62 @@ namespace
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXAttributeSamplerShape::BuildInitialPose()
+bool	FPopcornFXSharedSkin::Build(SBuildSkinnedMesh &buildDesc, const PopcornFX::PMeshNew &mesh, PopcornFX::CBaseSkinningStreams *skinningStreams)
 {
-	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildInitialPose", POPCORNFX_UE_PROFILER_COLOR);
-
-	check(m_Data != null);
-	Clear();
-
-	PK_TODO("Big endian");
-#if !PLATFORM_LITTLE_ENDIAN
-	PK_ASSERT_NOT_REACHED();
-	return false;
-#endif
+	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildSharedSkin", POPCORNFX_UE_PROFILER_COLOR);
 
-	SBuildSkinnedMesh	buildDesc;
-	if (!buildDesc.Initialize(ResolveSkinnedMeshComponent()))
-		return false;
+	PK_ASSERT(!m_Built);
+	PK_ASSERT(mesh != null && skinningStreams != null);
 
-	if (buildDesc.m_LODRenderData->SkinWeightVertexBuffer.GetBoneInfluenceType() == UnlimitedBoneInfluence)
-	{
-		UE_LOG(LogPopcornFXAttributeSamplerShape, Warning, TEXT("Cannot build mesh '%s' for sampling: Unlimited bone influences not supported for sampling"), *buildDesc.m_SkinnedMeshComponent->GetSkinnedAsset()->GetName());
-		return false;
-	}
-
-	UPopcornFXMesh		*pkMesh = UPopcornFXMesh::FindSkeletalMesh(buildDesc.m_SkeletalMesh);
-	if (!PK_VERIFY(pkMesh != null))
-		return false;
-
-	PopcornFX::PResourceMesh	meshRes = pkMesh->LoadResourceMeshIFN(true);
-	if (meshRes == null ||
-		meshRes->BatchList().Count() != 1 ||
-		meshRes->BatchList().First() == null)
-	{
-		UE_LOG(LogPopcornFXAttributeSamplerShape, Warning, TEXT("Cannot build mesh '%s' for sampling: PopcornFX mesh was not built"), *buildDesc.m_SkinnedMeshComponent->GetSkinnedAsset()->GetName());
-		return false;
-	}
-
-	PopcornFX::PMeshNew				meshNew = meshRes->BatchList()[0]->RawMesh();
-	if (!PK_VERIFY(meshNew != null))
-		return false;
-	PopcornFX::CBaseSkinningStreams	*skinningStreams = meshRes->BatchList()[0]->m_OptimizedStreams;
-	if (!PK_VERIFY(skinningStreams != null))
-		return false;
-
-	PopcornFX::CMeshTriangleBatch	&triBatch = meshNew->TriangleBatch();
-	PopcornFX::CMeshVStream			&vstream = triBatch.m_VStream;
-	PopcornFX::CMeshIStream			&istream = triBatch.m_IStream;
+	PopcornFX::CMeshVStream	&vstream = mesh->TriangleBatch().m_VStream;
 
 	PopcornFX::TMemoryView<const float>		srcBoneWeights(skinningStreams->WeightStream(), skinningStreams->Count());
 	PK_ASSERT(skinningStreams->VertexCount() == buildDesc.m_TotalVertexCount);
 
 	// TODO: We have to make sure those streams remain valid while this attr sampler is active: Reset when src .uasset is removed?
 
-	const bool	skin = Properties.bSkinPositions || Properties.bSkinNormals || Properties.bSkinTangents;
+	buildDesc.m_BuildFlags = m_Key.m_Streams;
+	PK_ASSERT((buildDesc.m_BuildFlags & Build_SkinMask) != 0);
 	{
 		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildMeshVertexDecl", POPCORNFX_UE_PROFILER_COLOR);
 
-		if (Properties.bSkinPositions)
+		if (buildDesc.m_BuildFlags & Build_Positions)
 		{
-			if (!PK_VERIFY(m_Data->m_DstPositions.Resize(buildDesc.m_TotalVertexCount)))
+			if (!PK_VERIFY(m_DstPositions.Resize(buildDesc.m_TotalVertexCount)))
 				return false;
-			m_Data->m_SkinContext.m_DstPositions = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_DstPositions.RawDataPointer()), m_Data->m_DstPositions.Count(), 16);
-			m_Data->m_Override.m_PositionsOverride = m_Data->m_SkinContext.m_DstPositions;
-			buildDesc.m_BuildFlags |= Build_Positions;
+			m_SkinContext.m_DstPositions = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_DstPositions.RawDataPointer()), m_DstPositions.Count(), 16);
 		}
-		if (Properties.bSkinNormals)
+		if (buildDesc.m_BuildFlags & Build_Normals)
 		{
-			if (!PK_VERIFY(m_Data->m_DstNormals.Resize(buildDesc.m_TotalVertexCount)))
+			if (!PK_VERIFY(m_DstNormals.Resize(buildDesc.m_TotalVertexCount)))
 				return false;
-			m_Data->m_SkinContext.m_DstNormals = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_DstNormals.RawDataPointer()), m_Data->m_DstNormals.Count(), 16);
-			m_Data->m_Override.m_NormalsOverride = m_Data->m_SkinContext.m_DstNormals;
-			buildDesc.m_BuildFlags |= Build_Normals;
+			m_SkinContext.m_DstNormals = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_DstNormals.RawDataPointer()), m_DstNormals.Count(), 16);
 		}
-		if (Properties.bSkinTangents)
+		if (buildDesc.m_BuildFlags & Build_Tangents)
 		{
-			if (!PK_VERIFY(m_Data->m_DstTangents.Resize(buildDesc.m_TotalVertexCount)))
+			if (!PK_VERIFY(m_DstTangents.Resize(buildDesc.m_TotalVertexCount)))
 				return false;
-			m_Data->m_SkinContext.m_DstTangents = PopcornFX::TStridedMemoryView<CFloat4>(reinterpret_cast<CFloat4*>(m_Data->m_DstTangents.RawDataPointer()), m_Data->m_DstTangents.Count(), 16);
-			m_Data->m_Override.m_TangentsOverride = m_Data->m_DstTangents;
-			buildDesc.m_BuildFlags |= Build_Tangents;
+			m_SkinContext.m_DstTangents = PopcornFX::TStridedMemoryView<CFloat4>(reinterpret_cast<CFloat4*>(m_DstTangents.RawDataPointer()), m_DstTangents.Count(), 16);
 		}
-		if (Properties.bBuildClothData)
-			buildDesc.m_BuildFlags |= Build_Cloth;
-		if (Properties.bComputeVelocities)
+		if (buildDesc.m_BuildFlags & Build_Velocities)
 		{
 			// There should be at least position skinning
-			PK_ASSERT(Properties.bSkinPositions && skin);
-			if (!PK_VERIFY(m_Data->m_DstVelocities.Resize(buildDesc.m_TotalVertexCount)) ||
-				!PK_VERIFY(m_Data->m_OldPositions.Resize(buildDesc.m_TotalVertexCount)))
+			PK_ASSERT(buildDesc.m_BuildFlags & Build_Positions);
+			if (!PK_VERIFY(m_DstVelocities.Resize(buildDesc.m_TotalVertexCount)) ||
+				!PK_VERIFY(m_OldPositions.Resize(buildDesc.m_TotalVertexCount)))
 				return false;
 			// No need to clear the oldPositions
-			PopcornFX::Mem::Clear(m_Data->m_DstVelocities.RawDataPointer(), sizeof(CFloat4) * buildDesc.m_TotalVertexCount);
+			PopcornFX::Mem::Clear(m_DstVelocities.RawDataPointer(), sizeof(CFloat4) * buildDesc.m_TotalVertexCount);
 
-			m_Data->m_SkinContext.m_CustomProcess_PreSkin = PopcornFX::SSkinContext::CbCustomProcess(this, &UPopcornFXAttributeSamplerShape::Skin_PreProcess);
-			m_Data->m_Override.m_VelocitiesOverride = PopcornFX::TStridedMemoryView<CFloat3>(reinterpret_cast<CFloat3*>(m_Data->m_DstVelocities.RawDataPointer()), m_Data->m_DstVelocities.Count(), 16);
+			m_SkinContext.m_CustomProcess_PreSkin = PopcornFX::SSkinContext::CbCustomProcess(this, &FPopcornFXSharedSkin::Skin_PreProcess);
 		}
-		m_Data->m_SkinContext.m_CustomProcess_PostSkin = PopcornFX::SSkinContext::CbCustomProcess(this, &UPopcornFXAttributeSamplerShape::Skin_PostProcess);
-		m_Data->m_SkinContext.m_CustomFinish = PopcornFX::SSkinContext::CbCustomFinish(this, &UPopcornFXAttributeSamplerShape::Skin_Finish);
+		m_SkinContext.m_CustomProcess_PostSkin = PopcornFX::SSkinContext::CbCustomProcess(this, &FPopcornFXSharedSkin::Skin_PostProcess);
 	}
 
 	// No need to create bone weights/indices if we don't skin anything..
 	const u32	sectionCount = GetSections(buildDesc.m_LODRenderData).Num();
 	const bool	hasMasterPoseComponent = buildDesc.m_SkinnedMeshComponent->LeaderPoseComponent.Get() != null;
-	if (skin && hasMasterPoseComponent) // No master pose component? Use directly the src mesh indices
+	if (hasMasterPoseComponent) // No master pose component? Use directly the src mesh indices
 	{
 		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::Alloc skinning buffers", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -1763,105 +1903,106 @@ bool	UPopcornFXAttributeSamplerShape::BuildInitialPose()
 		if (!PK_VERIFY(totalDataCount > 0))
 			return false;
 		const u32	boneRealDataCount = totalDataCount * (buildDesc.m_SmallBoneIndices ? 1 : 2);
-		if (!PK_VERIFY(m_Data->m_BoneIndices.Resize(boneRealDataCount)))
+		if (!PK_VERIFY(m_BoneIndices.Resize(boneRealDataCount)))
 			return false;
-		PopcornFX::Mem::Clear(m_Data->m_BoneIndices.RawDataPointer(), sizeof(u8) * boneRealDataCount);
+		PopcornFX::Mem::Clear(m_BoneIndices.RawDataPointer(), sizeof(u8) * boneRealDataCount);
 	}
 	if (buildDesc.m_SmallBoneIndices)
 	{
-		if (!PK_VERIFY(_FillBuffers<u8>(m_Data, buildDesc, vstream, skinningStreams)))
+		if (!PK_VERIFY(_FillBuffers<u8>(this, buildDesc, vstream, skinningStreams)))
 			return false;
 	}
 	else
 	{
-		if (!PK_VERIFY(_FillBuffers<u16>(m_Data, buildDesc, vstream, skinningStreams)))
+		if (!PK_VERIFY(_FillBuffers<u16>(this, buildDesc, vstream, skinningStreams)))
 			return false;
 	}
 
-	{
-		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildAccelStructs", POPCORNFX_UE_PROFILER_COLOR);
-
-		// No need to build sampling structs as we override them
-		//meshNew->SetupRuntimeStructsIFN(false);
-
-		bool	success = false;
-
-		if (Properties.ShapeSamplingMode == EPopcornFXMeshSamplingMode::Type::Weighted)
-			success = meshNew->SetupSurfaceSamplingAccelStructs(0, Properties.DensityColorChannel, m_Data->m_OverrideSurfaceSamplingAccelStructs, &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
-		else
-			success = m_Data->m_OverrideSurfaceSamplingAccelStructs.Build(istream, vstream.Positions(), &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
-
-		if (!PK_VERIFY(success))
-			return false;
-	}
+	PK_ASSERT(m_SkeletonView == null);
+	PK_ASSERT(m_SkinningStreamsProxy == null);
 
-	if (skin)
+	if (!m_BoneIndices.Empty()) // hasMasterPoseComponent
 	{
-		PK_ASSERT(m_Data->m_SkeletonView == null);
-		PK_ASSERT(m_Data->m_SkinningStreamsProxy == null);
-
-		if (!m_Data->m_BoneIndices.Empty()) // hasMasterPoseComponent
+		if (buildDesc.m_SmallBoneIndices)
 		{
-			if (buildDesc.m_SmallBoneIndices)
+			PopcornFX::TBaseSkinningStreamsProxy<u8>	*proxy = PK_NEW(PopcornFX::TBaseSkinningStreamsProxy<u8>);
+			if (!PK_VERIFY(proxy != null))
+				return false;
+			if (!PK_VERIFY(proxy->Setup(buildDesc.m_TotalVertexCount, srcBoneWeights, m_BoneIndices)))
 			{
-				PopcornFX::TBaseSkinningStreamsProxy<u8>	*proxy = PK_NEW(PopcornFX::TBaseSkinningStreamsProxy<u8>);
-				if (!PK_VERIFY(proxy != null))
-					return false;
-				if (!PK_VERIFY(proxy->Setup(buildDesc.m_TotalVertexCount, srcBoneWeights, m_Data->m_BoneIndices)))
-				{
-					PK_DELETE(proxy);
-					return false;
-				}
-				m_Data->m_SkinningStreamsProxy = proxy;
+				PK_DELETE(proxy);
+				return false;
 			}
-			else
+			m_SkinningStreamsProxy = proxy;
+		}
+		else
+		{
+			PopcornFX::TBaseSkinningStreamsProxy<u16>	*proxy = PK_NEW(PopcornFX::TBaseSkinningStreamsProxy<u16>);
+			if (!PK_VERIFY(proxy != null))
+				return false;
+			if (!PK_VERIFY(proxy->Setup(buildDesc.m_TotalVertexCount, srcBoneWeights, PopcornFX::TMemoryView<const u16>(reinterpret_cast<const u16*>(m_BoneIndices.RawDataPointer()), m_BoneIndices.Count() / 2))))
 			{
-				PopcornFX::TBaseSkinningStreamsProxy<u16>	*proxy = PK_NEW(PopcornFX::TBaseSkinningStreamsProxy<u16>);
-				if (!PK_VERIFY(proxy != null))
-					return false;
-				if (!PK_VERIFY(proxy->Setup(buildDesc.m_TotalVertexCount, srcBoneWeights, PopcornFX::TMemoryView<const u16>(reinterpret_cast<const u16*>(m_Data->m_BoneIndices.RawDataPointer()), m_Data->m_BoneIndices.Count() / 2))))
-				{
-					PK_DELETE(proxy);
-					return false;
-				}
-				m_Data->m_SkinningStreamsProxy = proxy;
+				PK_DELETE(proxy);
+				return false;
 			}
+			m_SkinningStreamsProxy = proxy;
 		}
-		m_Data->m_SkinContext.m_SkinningStreams = m_Data->m_SkinningStreamsProxy != null ? m_Data->m_SkinningStreamsProxy : skinningStreams;
+	}
+	m_SkinContext.m_SkinningStreams = m_SkinningStreamsProxy != null ? m_SkinningStreamsProxy : skinningStreams;
 
-		if (!PK_VERIFY(m_Data->m_BoneInverseMatrices.Resize(buildDesc.m_TotalBoneCount)))
-			return false;
-		m_Data->m_SkeletonView = PK_NEW(PopcornFX::CSkeletonView(buildDesc.m_TotalBoneCount, null, m_Data->m_BoneInverseMatrices.RawDataPointer()));
-		if (!PK_VERIFY(m_Data->m_SkeletonView != null))
-			return false;
+	if (!PK_VERIFY(m_BoneInverseMatrices.Resize(buildDesc.m_TotalBoneCount)))
+		return false;
+	m_SkeletonView = PK_NEW(PopcornFX::CSkeletonView(buildDesc.m_TotalBoneCount, null, m_BoneInverseMatrices.RawDataPointer()));
+	if (!PK_VERIFY(m_SkeletonView != null))
+		return false;
 
-		// If everything is OK, we assign this component as dependency
-		if (!PK_VERIFY(SetComponentTickingGroup(buildDesc.m_SkinnedMeshComponent)))
-			return false;
-		m_Data->m_CurrentSkinnedMeshComponent = buildDesc.m_SkinnedMeshComponent;
-	}
-	m_Data->m_Mesh = meshNew;
+	// Old positions are the bind pose until the first skinning is consumed: no velocities until then
+	m_AccumulatedDts = POPCORNFX_MAX_ANIM_IDLE_TIME;
+	m_Mesh = mesh;
+	m_Built = true;
 	return true;
 }
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXAttributeSamplerShape::UpdateSkinning()
+void	FPopcornFXSharedSkin::Tick(float deltaTime)
+{
+	// Several samplers tick the same shared skin, accumulate once per frame
+	if (m_LastTickFrame == GFrameCounter)
+		return;
+	m_LastTickFrame = GFrameCounter;
+	if (m_AccumulatedDts < POPCORNFX_MAX_ANIM_IDLE_TIME)
+		m_AccumulatedDts += deltaTime;
+}
+
+//----------------------------------------------------------------------------
+
+bool	FPopcornFXSharedSkin::Start()
 {
 	PK_ASSERT(IsInGameThread());
 	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::UpdateSkinning", POPCORNFX_UE_PROFILER_COLOR);
 
-	PK_TODO("Don't skin several times the same skinned mesh component");
+	// Already skinned this frame for another sampler
+	if (m_LastStartFrame == GFrameCounter)
+	{
+		INC_DWORD_STAT(STAT_PopcornFX_SharedSkinningCount);
+		return true;
+	}
+
+	// Not consumed by anyone last frame
+	if (m_Running)
+		Wait(false);
+	m_ClothSimDataCopy.Empty();
 
 	// Do we have to resolve the skeletal mesh each frame ?
-	USkinnedMeshComponent	*skinnedMesh = m_Data->m_CurrentSkinnedMeshComponent.Get();
+	USkinnedMeshComponent	*skinnedMesh = m_Key.m_Component.Get();
 	if (!PK_VERIFY(skinnedMesh != null))
 		return false;
 
 	// Don't even start the skinning if the skeleton view is invalid
-	if (!PK_VERIFY(m_Data->m_SkeletonView != null))
+	if (!PK_VERIFY(m_SkeletonView != null))
 		return false;
-	const u32	boneCount = m_Data->m_BoneInverseMatrices.Count();
+	const u32	boneCount = m_BoneInverseMatrices.Count();
 	if (!PK_VERIFY(boneCount > 0))
 		return false;
 	const FVector3f	invScale(FPopcornFXPlugin::GlobalScaleRcp());
@@ -1880,48 +2021,289 @@ bool	UPopcornFXAttributeSamplerShape::UpdateSkinning()
 
 	const TArray<FMatrix44f>	&refBasesInvMatrix=  mesh->GetRefBasesInvMatrix();
 	PK_ASSERT(boneCount <= (u32)boneVisibilityStates.Num());
-	m_Data->m_BoneVisibilityChanged = false;
+	m_BoneVisibilityChanged = false;
 	for (u32 iBone = 0; iBone < boneCount; ++iBone)
 	{
 		// Consider only purely visible vertices (hierarchy of bones is respected)
 		const bool	isBoneVisible = boneVisibilityStates[iBone] == EBoneVisibilityStatus::BVS_Visible;
-		const bool	wasBoneVisible = m_Data->m_BoneInverseMatrices[iBone] != CFloat4x4::ZERO;
+		const bool	wasBoneVisible = m_BoneInverseMatrices[iBone] != CFloat4x4::ZERO;
 		if (isBoneVisible)
 		{
 			FMatrix44f	matrix = refBasesInvMatrix[iBone] * (FMatrix44f)spaceBases[iBone].ToMatrixWithScale();
 
 			matrix.ScaleTranslation(invScale);
-			m_Data->m_BoneInverseMatrices[iBone] = ToPk(matrix);
+			m_BoneInverseMatrices[iBone] = ToPk(matrix);
 		}
 		else
-			m_Data->m_BoneInverseMatrices[iBone] = CFloat4x4::ZERO;
-		m_Data->m_BoneVisibilityChanged |= isBoneVisible != wasBoneVisible;
+			m_BoneInverseMatrices[iBone] = CFloat4x4::ZERO;
+		m_BoneVisibilityChanged |= isBoneVisible != wasBoneVisible;
 	}
+	if (m_BoneVisibilityChanged)
+		++m_BoneVisibilitySerial;
 
 	USkeletalMeshComponent	*skelMesh = Cast<USkeletalMeshComponent>(skinnedMesh);
 	if (skelMesh != null && !skelMesh->bDisableClothSimulation)
 	{
-		if (Properties.bBuildClothData &&
-			!m_Data->m_ClothSections.Empty())
+		if ((m_Key.m_Streams & Build_Cloth) &&
+			!m_ClothSections.Empty())
 		{
 			SCOPE_CYCLE_COUNTER(STAT_PopcornFX_FetchClothData); // Time cloth data copy
 
 			const TMap<int32, FClothSimulData>	&simData = skelMesh->GetCurrentClothingData_GameThread();
 			const FMatrix44f					&inverseTr = (FMatrix44f)skelMesh->GetComponentToWorld().Inverse().ToMatrixWithScale();
 
-			m_Data->m_InverseTransforms = inverseTr;
-			m_Data->m_ClothSimDataCopy = simData;
+			m_InverseTransforms = inverseTr;
+			m_ClothSimDataCopy = simData;
 		}
 	}
 
 	// Launch skinning tasks
-	PopcornFX::CSkeletalSkinnerSimple::AsyncSkinStart(m_Data->m_AsyncSkinContext, *m_Data->m_SkeletonView, m_Data->m_SkinContext);
+	PopcornFX::CSkeletalSkinnerSimple::AsyncSkinStart(m_AsyncSkinContext, *m_SkeletonView, m_SkinContext);
+	m_LastStartFrame = GFrameCounter;
+	m_Running = true;
+	INC_DWORD_STAT(STAT_PopcornFX_SkinnedMeshCount);
+
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSharedSkin::Wait(bool consume)
+{
+	if (!m_Running)
+		return;
+	PopcornFX::CSkeletalSkinnerSimple::AsyncSkinWait(m_AsyncSkinContext, null);
+	m_Running = false;
+
+	// Velocities are computed over the time accumulated since the last consumed skinning
+	if (consume)
+		m_AccumulatedDts = 0.0f;
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSharedSkin::ClearVelocities()
+{
+	// The running job, if any, writes them
+	if (m_Running || m_LastStartFrame == GFrameCounter)
+		return;
+	PopcornFX::Mem::Clear(m_DstVelocities.RawDataPointer(), sizeof(CFloat4) * m_DstVelocities.Count());
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerShape::BuildInitialPose()
+{
+	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildInitialPose", POPCORNFX_UE_PROFILER_COLOR);
+
+	check(m_Data != null);
+	Clear();
+	if (Properties.SkinningLODMode != EPopcornFXSkinningLOD::RenderLOD)
+		_ReleaseLODSkins(m_Data, null);
+
+	PK_TODO("Big endian");
+#if !PLATFORM_LITTLE_ENDIAN
+	PK_ASSERT_NOT_REACHED();
+	return false;
+#endif
+
+	USkinnedMeshComponent	*skinnedMesh = ResolveSkinnedMeshComponent();
+	const u32				requestedLOD = _ResolveSkinningLOD(Properties, skinnedMesh);
+	SBuildSkinnedMesh		buildDesc;
+	if (!buildDesc.Initialize(skinnedMesh, requestedLOD))
+		return false;
+
+	if (buildDesc.m_LODRenderData->SkinWeightVertexBuffer.GetBoneInfluenceType() == UnlimitedBoneInfluence)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerShape, Warning, TEXT("Cannot build mesh '%s' for sampling: Unlimited bone influences not supported for sampling"), *buildDesc.m_SkinnedMeshComponent->GetSkinnedAsset()->GetName());
+		return false;
+	}
+
+	UPopcornFXMesh		*pkMesh = UPopcornFXMesh::FindSkeletalMesh(buildDesc.m_SkeletalMesh);
+	if (!PK_VERIFY(pkMesh != null))
+		return false;
+
+	u32							subsampling = FMath::Max(Properties.SkinningSubsampling, 1);
+	PopcornFX::PResourceMesh	meshRes = pkMesh->LoadSkinningResourceMeshIFN(buildDesc.m_LODIndex, subsampling);
+	if ((buildDesc.m_LODIndex != 0 || subsampling != 1) &&
+		(meshRes == null || meshRes->BatchList().Count() != 1))
+	{
+		// Runtime build failed (see UPopcornFXMesh::LoadSkinningResourceMeshIFN), fallback on the full resolution mesh
+		if (!PK_VERIFY(buildDesc.Initialize(skinnedMesh, 0)))
+			return false;
+		subsampling = 1;
+		meshRes = pkMesh->LoadResourceMeshIFN(true);
+	}
+	if (meshRes == null ||
+		meshRes->BatchList().Count() != 1 ||
+		meshRes->BatchList().First() == null)
+	{
+		UE_LOG(LogPopcornFXAttributeSamplerShape, Warning, TEXT("Cannot build mesh '%s' for sampling: PopcornFX mesh was not built"), *buildDesc.m_SkinnedMeshComponent->GetSkinnedAsset()->GetName());
+		return false;
+	}
+
+	PopcornFX::PMeshNew				meshNew = meshRes->BatchList()[0]->RawMesh();
+	if (!PK_VERIFY(meshNew != null))
+		return false;
+	PopcornFX::CBaseSkinningStreams	*skinningStreams = meshRes->BatchList()[0]->m_OptimizedStreams;
+	if (!PK_VERIFY(skinningStreams != null))
+		return false;
+
+	PopcornFX::CMeshTriangleBatch	&triBatch = meshNew->TriangleBatch();
+	PopcornFX::CMeshVStream			&vstream = triBatch.m_VStream;
+	PopcornFX::CMeshIStream			&istream = triBatch.m_IStream;
+
+	if (subsampling != 1)
+	{
+		buildDesc.m_Subsampled = true;
+		buildDesc.m_TotalVertexCount = vstream.Positions().Count();
+	}
+
+	const bool	skin = Properties.bSkinPositions || Properties.bSkinNormals || Properties.bSkinTangents;
+	u32			streams = None;
+	if (skin)
+	{
+		streams |= Properties.bSkinPositions ? Build_Positions : None;
+		streams |= Properties.bSkinNormals ? Build_Normals : None;
+		streams |= Properties.bSkinTangents ? Build_Tangents : None;
+		// Cloth and velocities are written into the skinned buffers, they must be part of the key
+		streams |= (Properties.bBuildClothData && !buildDesc.m_Subsampled) ? Build_Cloth : None;
+		streams |= Properties.bComputeVelocities ? Build_Velocities : None;
+	}
+	if (skin)
+	{
+		FPopcornFXSharedSkinKey	key;
+		key.m_Component = buildDesc.m_SkinnedMeshComponent;
+		key.m_SkeletalMesh = buildDesc.m_SkeletalMesh;
+		key.m_LODIndex = buildDesc.m_LODIndex;
+		key.m_Subsampling = subsampling;
+		key.m_Streams = streams;
+
+		_ReleaseLODSkins(m_Data, &key);
+		m_Data->m_Skin = _AcquireSharedSkin(key);
+		if (!m_Data->m_Skin->m_Built &&
+			!m_Data->m_Skin->Build(buildDesc, meshNew, skinningStreams))
+		{
+			_ReleaseSharedSkin(m_Data->m_Skin);
+			m_Data->m_Skin = null;
+			return false;
+		}
 
+		const FPopcornFXSharedSkin	*sharedSkin = m_Data->m_Skin;
+		m_Data->m_BoneVisibilitySerial = sharedSkin->m_BoneVisibilitySerial;
+		if (streams & Build_Positions)
+			m_Data->m_Override.m_PositionsOverride = sharedSkin->m_SkinContext.m_DstPositions;
+		if (streams & Build_Normals)
+			m_Data->m_Override.m_NormalsOverride = sharedSkin->m_SkinContext.m_DstNormals;
+		if (streams & Build_Tangents)
+			m_Data->m_Override.m_TangentsOverride = sharedSkin->m_SkinContext.m_DstTangents;
+		if (streams & Build_Velocities)
+			m_Data->m_Override.m_VelocitiesOverride = PopcornFX::TStridedMemoryView<const CFloat3>(reinterpret_cast<const CFloat3*>(sharedSkin->m_DstVelocities.RawDataPointer()), sharedSkin->m_DstVelocities.Count(), 16);
+	}
+
+	{
+		PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::BuildAccelStructs", POPCORNFX_UE_PROFILER_COLOR);
+
+		// No need to build sampling structs as we override them
+		//meshNew->SetupRuntimeStructsIFN(false);
+
+		bool	success = false;
+
+		if (Properties.ShapeSamplingMode == EPopcornFXMeshSamplingMode::Type::Weighted)
+			success = meshNew->SetupSurfaceSamplingAccelStructs(0, Properties.DensityColorChannel, m_Data->m_OverrideSurfaceSamplingAccelStructs, &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
+		else
+			success = m_Data->m_OverrideSurfaceSamplingAccelStructs.Build(istream, vstream.Positions(), &m_Data->m_OverrideSurfaceSamplingWorkingBuffers);
+
+		if (!PK_VERIFY(success))
+			return false;
+	}
+
+	if (skin)
+	{
+		// If everything is OK, we assign this component as dependency
+		if (!PK_VERIFY(SetComponentTickingGroup(buildDesc.m_SkinnedMeshComponent)))
+			return false;
+		m_Data->m_CurrentSkinnedMeshComponent = buildDesc.m_SkinnedMeshComponent;
+	}
+	m_Data->m_SkinningLOD = requestedLOD;
+	m_Data->m_Mesh = meshNew;
 	return true;
 }
 
 //----------------------------------------------------------------------------
 
+void	UPopcornFXAttributeSamplerShape::UpdateSkinningLOD()
+{
+	PK_ASSERT(IsInGameThread());
+
+	if (Properties.SkinningLODMode != EPopcornFXSkinningLOD::RenderLOD ||
+		m_Data->m_Mesh == null)
+		return;
+	USkinnedMeshComponent	*skinnedMesh = m_Data->m_CurrentSkinnedMeshComponent.Get();
+	if (skinnedMesh == null)
+		return;
+	const u32	lod = _ResolveSkinningLOD(Properties, skinnedMesh);
+	if (lod == m_Data->m_SkinningLOD)
+	{
+		m_Data->m_PendingSkinningLODFrames = 0;
+		return;
+	}
+
+	// Don't follow a render LOD oscillating around a screen size threshold: it must be stable for a few frames
+	if (lod != m_Data->m_PendingSkinningLOD)
+	{
+		m_Data->m_PendingSkinningLOD = lod;
+		m_Data->m_PendingSkinningLODFrames = 0;
+	}
+	if (++m_Data->m_PendingSkinningLODFrames < kSkinningLODSwitchFrames)
+		return;
+	m_Data->m_PendingSkinningLODFrames = 0;
+
+	PK_NAMEDSCOPEDPROFILE_C("AttributeSamplerShape::UpdateSkinningLOD", POPCORNFX_UE_PROFILER_COLOR);
+
+	// Keep the current LOD's skin built, the render LOD will likely come back to it
+	FPopcornFXSharedSkin	*previousSkin = m_Data->m_Skin;
+	if (previousSkin != null && !m_Data->m_LODSkins.Contains(previousSkin))
+		m_Data->m_LODSkins.Add(_AcquireSharedSkin(previousSkin->m_Key));
+
+	// Render LOD changed: switch to the matching mesh and skin it right away, so this frame's sampling stays coherent
+	if (!BuildInitialPose())
+		return;
+	FPopcornFXSharedSkin	*skin = m_Data->m_Skin;
+	if (skin != null && !Properties.bPauseSkinning)
+	{
+		// A kept skin wasn't updated while unused, its previous positions are stale: don't derive velocities from them
+		if (skin->m_LastStartFrame + 1 < GFrameCounter)
+			skin->m_AccumulatedDts = POPCORNFX_MAX_ANIM_IDLE_TIME;
+		if (skin->Start())
+			skin->Wait(true);
+	}
+
+	// Emitters hold the shape descriptor, point it to the new mesh
+	PopcornFX::CParticleSamplerDescriptor_Shape_Default	*shapeDesc = m_Data->m_Desc.Get();
+	if (shapeDesc != null && shapeDesc->m_Shape != null)
+	{
+		PopcornFX::CShapeDescriptor_Mesh	*descMesh = static_cast<PopcornFX::CShapeDescriptor_Mesh*>(shapeDesc->m_Shape.Get());
+		descMesh->SetSamplingStructs(&m_Data->m_OverrideSurfaceSamplingAccelStructs, null);
+		descMesh->SetMesh(m_Data->m_Mesh, &(m_Data->m_Override));
+	}
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXAttributeSamplerShape::UpdateSkinning()
+{
+	PK_ASSERT(IsInGameThread());
+
+	FPopcornFXSharedSkin	*skin = m_Data->m_Skin;
+	if (!PK_VERIFY(skin != null))
+		return false;
+	// Samplers targeting the same component with the same streams share the skinning (see _AcquireSharedSkin)
+	return skin->Start();
+}
+
+//----------------------------------------------------------------------------
+
 void	UPopcornFXAttributeSamplerShape::UpdateTransforms()
 {
 	m_WorldTr_Previous = m_WorldTr_Current;
@@ -2112,17 +2494,19 @@ void	UPopcornFXAttributeSamplerShape::_AttribSampler_PreUpdate(float deltaTime)
 
 		UpdateTransforms();
 
-		if (m_Data->m_CurrentSkinnedMeshComponent.IsValid() &&
-			m_Data->m_ShouldUpdateTransforms)
+		if (m_Data->m_Skin != null &&
+			m_Data->m_SkinPending)
 		{
 			PK_ASSERT(Properties.bSkinPositions || Properties.bSkinNormals || Properties.bSkinTangents);
 			SCOPE_CYCLE_COUNTER(STAT_PopcornFX_SkinningWaitTime);
 
-			PopcornFX::CSkeletalSkinnerSimple::AsyncSkinWait(m_Data->m_AsyncSkinContext, null);
+			// First sampler to wait joins the job, others return immediately
+			m_Data->m_Skin->Wait(!Properties.bPauseSkinning);
+			m_Data->m_SkinPending = false;
 
-			if (!Properties.bPauseSkinning)
-				m_Data->m_AccumulatedDts = 0.0f;
+			UpdateSamplingAccelStructs();
 		}
+		UpdateSkinningLOD();
 	}
 	else
 	{
@@ -12,6 +12,11 @@
 
 #include "Engine/StaticMesh.h"
 #include "Engine/SkeletalMesh.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Package.h"
 
 #define FILE_ASSERT		PK_RELEASE_ASSERT
 
@@ -59,9 +64,140 @@ UPopcornFXFile		*CFileSystemController_UE::FindDirectPopcornFXFile(UObject *uobj
 	return null;
 }
 
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// FILETIME like: 100ns ticks since 1601/01/01 UTC
+	u64		_ToFileTime(const FDateTime &time)
+	{
+		const FDateTime	kFileTimeEpoch(1601, 1, 1);
+		return time > kFileTimeEpoch ? u64((time - kFileTimeEpoch).GetTicks()) : 0;
+	}
+
+	// Cooked packages have no file of their own: use the executable's, stable across runs of a same build
+	const FDateTime	&_CookedBuildTimestamp()
+	{
+		static const FDateTime	kBuildTime = IFileManager::Get().GetTimeStamp(FPlatformProcess::ExecutablePath());
+		return kBuildTime;
+	}
+
+	PopcornFX::SFileTimes	_FileTimestamps(const UPopcornFXFile *file)
+	{
+		const FDateTime	now = FDateTime::UtcNow();
+		FDateTime		writeTime = FDateTime::MinValue();
+
+		// In memory changes (import, reimport, baking) are not reflected by the package file: use the registration time
+		const UPackage	*package = file->GetOutermost();
+		if (package != null && !package->IsDirty())
+		{
+			FString		packageFilename;
+			if (FPackageName::DoesPackageExist(package->GetName(), &packageFilename))
+				writeTime = IFileManager::Get().GetTimeStamp(*packageFilename);
+			if (writeTime == FDateTime::MinValue() && package->HasAnyPackageFlags(PKG_Cooked)) // Cooked into a container
+				writeTime = _CookedBuildTimestamp();
+		}
+		if (writeTime == FDateTime::MinValue()) // Transient or dirty
+			writeTime = now;
+
+		PopcornFX::SFileTimes	timestamps;
+		timestamps.m_CreationTime = _ToFileTime(writeTime);
+		timestamps.m_LastAccessTime = _ToFileTime(now);
+		timestamps.m_LastWriteTime = _ToFileTime(writeTime);
+		return timestamps;
+	}
+}
+
 //----------------------------------------------------------------------------
 //
-// CFileSystemController_UE
+// CFileDataView_UE
+//
+//----------------------------------------------------------------------------
+
+CFileDataView_UE::CFileDataView_UE(const UPopcornFXFile *file, const PopcornFX::PFilePack &pack, const PopcornFX::SFileTimes &timestamps)
+:	m_File(file)
+,	m_Data(file->FileData().GetData())
+,	m_Size(file->FileData().Num())
+,	m_Pack(pack)
+,	m_Timestamps(timestamps)
+{
+}
+
+//----------------------------------------------------------------------------
+
+CFileDataView_UE::~CFileDataView_UE()
+{
+	PK_ASSERT(m_OpenStreams == 0);
+}
+
+//----------------------------------------------------------------------------
+
+u64	CFileDataView_UE::Read(u64 offset, void *targetBuffer, u64 byteCount) const
+{
+	FReadScopeLock	readLock(m_Lock);
+
+	if (offset >= m_Size)
+		return 0;
+	const u64	readCount = PKMin(byteCount, m_Size - offset);
+	PopcornFX::Mem::Copy(targetBuffer, m_Data + offset, readCount);
+	return readCount;
+}
+
+//----------------------------------------------------------------------------
+
+void	CFileDataView_UE::AddStream()
+{
+	FWriteScopeLock	writeLock(m_Lock);
+	++m_OpenStreams;
+}
+
+//----------------------------------------------------------------------------
+
+void	CFileDataView_UE::RemoveStream()
+{
+	FWriteScopeLock	writeLock(m_Lock);
+	PK_ASSERT(m_OpenStreams > 0);
+	--m_OpenStreams;
+}
+
+//----------------------------------------------------------------------------
+
+bool	CFileDataView_UE::GameThread_Matches(const UPopcornFXFile *file) const
+{
+	PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+
+	// m_Data is only written on the game thread (see GameThread_Detach)
+	return	m_File == file &&
+			m_Data == file->FileData().GetData() &&
+			m_Size == u64(file->FileData().Num());
+}
+
+//----------------------------------------------------------------------------
+
+void	CFileDataView_UE::GameThread_Detach()
+{
+	PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+
+	FWriteScopeLock	writeLock(m_Lock);
+	if (m_File == null) // Already detached
+		return;
+	if (m_OpenStreams > 0)
+	{
+		// Only copy when streams still read this data, which is rare: file data changes in editor or at unload
+		m_DetachedData = TArray<u8>(m_Data, int32(m_Size));
+		m_Data = m_DetachedData.GetData();
+	}
+	else
+	{
+		m_Data = null;
+		m_Size = 0;
+	}
+	m_File = null;
+}
+
+//----------------------------------------------------------------------------
+//
+// CFileStreamFS_UE
 //
 //----------------------------------------------------------------------------
 
@@ -69,17 +205,22 @@ CFileStreamFS_UE::CFileStreamFS_UE(	CFileSystemController_UE	*controller,
 									PopcornFX::PFilePack		pack,
 									const CString				&path,
 									IFileSystem::EAccessPolicy	mode,
-									UPopcornFXFile				*file)
+									UPopcornFXFile				*file,
+									const PFileDataView_UE		&view)
 :	CFileStream(controller, pack, path, mode)
 ,	m_Mode(mode)
 ,	m_File(file)
+,	m_View(view)
 ,	m_Pos(0)
 {
-	FILE_ASSERT(m_File != null);
+	// Write streams modify the file data on the game thread, read streams go through a view (that already counts this stream)
+	FILE_ASSERT(_Writing() ? (m_File != null && m_View == null) : (m_File == null && m_View != null));
 	FS_DEBUG_LOG(PK_INFO, "ctor CFileStreamFS_UE %s filesize:%d", Path().Data(), CFileStreamFS_UE::SizeInBytes());
-	if (m_File != null &&
-		(m_Mode == IFileSystem::Access_WriteCreate || m_Mode == IFileSystem::Access_ReadWriteCreate))
+	if (m_File != null)
 	{
+		PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+		controller->GameThread_UnregisterFile(m_File);
+
 		u32		oldNum = m_File->FileDataForWriting().Num();
 		m_File->FileDataForWriting().Empty(oldNum);
 	}
@@ -89,9 +230,14 @@ CFileStreamFS_UE::CFileStreamFS_UE(	CFileSystemController_UE	*controller,
 
 CFileStreamFS_UE::~CFileStreamFS_UE()
 {
-	if (m_File != null &&
-		(m_Mode == IFileSystem::Access_WriteCreate || m_Mode == IFileSystem::Access_ReadWriteCreate))
+	if (m_File != null)
+	{
 		m_File->MarkPackageDirty();
+		if (g_FsController != null)
+			g_FsController->GameThread_RegisterFile(m_File); // New data is readable from workers again
+	}
+	if (m_View != null)
+		m_View->RemoveStream();
 	FS_DEBUG_LOG(PK_INFO, "dtor CFileStreamFS_UE %s", Path().Data());
 }
 
@@ -99,6 +245,14 @@ CFileStreamFS_UE::~CFileStreamFS_UE()
 
 u64	CFileStreamFS_UE::Read(void *targetBuffer, u64 byteCount)
 {
+	if (m_View != null)
+	{
+		// Directly from the resident file data
+		const u64	readCount = m_View->Read(m_Pos, targetBuffer, byteCount);
+		m_Pos += readCount;
+		return readCount;
+	}
+
 	const u64		totalBytes = CFileStreamFS_UE::SizeInBytes();
 	const u64		start = m_Pos;
 
@@ -117,7 +271,7 @@ u64	CFileStreamFS_UE::Read(void *targetBuffer, u64 byteCount)
 u64	CFileStreamFS_UE::Write(const void *sourceBuffer, u64 byteCount)
 {
 	// only in that case you have cleared the FileData();
-	FILE_ASSERT(m_Mode == IFileSystem::Access_WriteCreate || m_Mode == IFileSystem::Access_ReadWriteCreate);
+	FILE_ASSERT(_Writing());
 
 	TArray<u8>			&fileData = m_File->FileDataForWriting();
 	if (m_Pos + byteCount > fileData.Num())
@@ -134,9 +288,10 @@ u64	CFileStreamFS_UE::Write(const void *sourceBuffer, u64 byteCount)
 
 bool	CFileStreamFS_UE::Seek(s64 offset, ESeekMode whence)
 {
-	s64		i = s32(whence == SeekSet ? 0 : m_Pos) + offset;
-	FILE_ASSERT(i > 0 && i <= s32(CFileStreamFS_UE::SizeInBytes()));
-	m_Pos = u64(PKMin(PKMax(i, 0), s64(CFileStreamFS_UE::SizeInBytes())));
+	const s64	size = s64(CFileStreamFS_UE::SizeInBytes());
+	const s64	i = (whence == SeekSet ? 0 : s64(m_Pos)) + offset;
+	FILE_ASSERT(i >= 0 && i <= size);
+	m_Pos = u64(PKMin(PKMax(i, s64(0)), size));
 	return true;
 }
 
@@ -151,7 +306,7 @@ u64	CFileStreamFS_UE::Tell() const
 
 bool	CFileStreamFS_UE::Eof() const
 {
-	return m_Pos >= m_File->FileData().Num();
+	return m_Pos >= CFileStreamFS_UE::SizeInBytes();
 }
 
 //----------------------------------------------------------------------------
@@ -173,20 +328,31 @@ void	CFileStreamFS_UE::Close()
 
 u64	CFileStreamFS_UE::SizeInBytes() const
 {
-	return m_File->FileData().Num();
+	return m_View != null ? m_View->SizeInBytes() : m_File->FileData().Num();
 }
 
 //----------------------------------------------------------------------------
 
 void	CFileStreamFS_UE::Timestamps(PopcornFX::SFileTimes &timestamps)
 {
-	PK_ASSERT_NOT_REACHED();
+	if (m_View != null)
+	{
+		timestamps = m_View->Timestamps();
+		return;
+	}
+	// Being written
+	const u64	now = _ToFileTime(FDateTime::UtcNow());
+	timestamps.m_CreationTime = now;
+	timestamps.m_LastAccessTime = now;
+	timestamps.m_LastWriteTime = now;
 }
 
 //----------------------------------------------------------------------------
 
 CFileStreamFS_UE	*CFileStreamFS_UE::Open(CFileSystemController_UE *controller, const CString &path, bool pathNotVirtual, IFileSystem::EAccessPolicy mode)
 {
+	PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+
 	CFileStreamFS_UE		*stream = null;
 	UObject					*uobject = CFileSystemController_UE::LoadUObject(path, pathNotVirtual);
 	if (uobject != null)
@@ -195,7 +361,22 @@ CFileStreamFS_UE	*CFileStreamFS_UE::Open(CFileSystemController_UE *controller, c
 		if (file != null)
 		{
 			if (file->IsFileValid())
-				stream = PK_NEW(CFileStreamFS_UE(controller, FPopcornFXPlugin::Get().FilePack(), path, mode, file));
+			{
+				if (mode == IFileSystem::Access_WriteCreate || mode == IFileSystem::Access_ReadWriteCreate)
+					stream = PK_NEW(CFileStreamFS_UE(controller, FPopcornFXPlugin::Get().FilePack(), path, mode, file, null));
+				else
+				{
+					// Also makes the file openable from workers with this path
+					PFileDataView_UE	view = controller->GameThread_RegisterFile(file, path, pathNotVirtual);
+					if (view != null)
+					{
+						view->AddStream();
+						stream = PK_NEW(CFileStreamFS_UE(controller, view->Pack(), path, mode, null, view));
+						if (stream == null)
+							view->RemoveStream();
+					}
+				}
+			}
 			else
 				CLog::Log(PK_DBG, "CFileStreamFS_UE: Open: invalid UPopcornFXFile '%s'", path.Data());
 		}
@@ -207,6 +388,19 @@ CFileStreamFS_UE	*CFileStreamFS_UE::Open(CFileSystemController_UE *controller, c
 	return stream;
 }
 
+//----------------------------------------------------------------------------
+
+CFileStreamFS_UE	*CFileStreamFS_UE::OpenResident(CFileSystemController_UE *controller, const CString &path, bool pathNotVirtual)
+{
+	PFileDataView_UE	view = controller->FindFileView(path, pathNotVirtual, true);
+	if (view == null)
+		return null;
+	CFileStreamFS_UE	*stream = PK_NEW(CFileStreamFS_UE(controller, view->Pack(), path, IFileSystem::Access_Read, null, view));
+	if (stream == null)
+		view->RemoveStream();
+	return stream;
+}
+
 //----------------------------------------------------------------------------
 //
 // CFileSystemController_UE
@@ -215,12 +409,18 @@ CFileStreamFS_UE	*CFileStreamFS_UE::Open(CFileSystemController_UE *controller, c
 
 CFileSystemController_UE::CFileSystemController_UE()
 {
+	PK_ASSERT(g_FsController == null);
+	g_FsController = this;
 }
 
 //----------------------------------------------------------------------------
 
 CFileSystemController_UE::~CFileSystemController_UE()
 {
+	if (g_FsController == this)
+		g_FsController = null;
+	PK_SCOPEDLOCK(m_ViewsLock);
+	m_Views.Empty();
 }
 
 //----------------------------------------------------------------------------
@@ -229,8 +429,12 @@ PopcornFX::PFileStream		CFileSystemController_UE::OpenStream(const CString &path
 {
 	if (!IsInGameThread())
 	{
-		CLog::Log(PK_INFO, "CFileSystemController_UE OpenStream: cannot load UE packages outside the main thread ('%s' pathNotVirtual:%d)", path.Data(), pathNotVirtual);
-		return null;
+		// UE packages can't be loaded here, but files already resident can be read
+		const bool	readOnly = mode != IFileSystem::Access_WriteCreate && mode != IFileSystem::Access_ReadWriteCreate && mode != IFileSystem::Access_ReadWrite;
+		CFileStreamFS_UE	*fs = readOnly ? CFileStreamFS_UE::OpenResident(this, path, pathNotVirtual) : null;
+		if (fs == null)
+			CLog::Log(PK_INFO, "CFileSystemController_UE OpenStream: cannot load UE packages outside the main thread, and '%s' isn't resident (pathNotVirtual:%d mode:%d)", path.Data(), pathNotVirtual, u32(mode));
+		return fs;
 	}
 	CFileStreamFS_UE	*fs = CFileStreamFS_UE::Open(this, path, pathNotVirtual, mode);
 	if (fs != null)
@@ -242,10 +446,107 @@ PopcornFX::PFileStream		CFileSystemController_UE::OpenStream(const CString &path
 
 //----------------------------------------------------------------------------
 
+FString		CFileSystemController_UE::_ViewKey(const CString &path, bool pathNotVirtual) const
+{
+	// Worker safe: only string manipulation, the pack path is cached at registration
+	FString		key = ToUE(path);
+	FPaths::NormalizeFilename(key);
+	if (pathNotVirtual && !m_PackPath.IsEmpty() && key.StartsWith(m_PackPath))
+		key.RightChopInline(m_PackPath.Len());
+	while (key.StartsWith(TEXT("/")))
+		key.RightChopInline(1);
+	return key;
+}
+
+//----------------------------------------------------------------------------
+
+PFileDataView_UE	CFileSystemController_UE::GameThread_RegisterFile(const UPopcornFXFile *file, const CString &openedPath, bool pathNotVirtual)
+{
+	PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+
+	if (file == null || !file->IsFileValid() || file->IsTemplate())
+		return null;
+	PopcornFX::PFilePack	pack = FPopcornFXPlugin::Get().FilePack();
+	if (pack == null)
+		return null;
+	const CString	pkPath = file->PkPath();
+	if (pkPath.Empty())
+		return null;
+
+	PK_SCOPEDLOCK(m_ViewsLock);
+	if (m_PackPath.IsEmpty())
+	{
+		m_PackPath = ToUE(pack->Path());
+		FPaths::NormalizeFilename(m_PackPath);
+	}
+
+	const FString		fileKey = _ViewKey(pkPath, false);
+	PFileDataView_UE	view;
+	if (PFileDataView_UE *existing = m_Views.Find(fileKey))
+	{
+		// Still valid as long as the file data didn't move: any change goes through GameThread_UnregisterFile
+		if ((*existing)->GameThread_Matches(file))
+			view = *existing;
+	}
+	if (view == null)
+	{
+		view = PK_NEW(CFileDataView_UE(file, pack, _FileTimestamps(file)));
+		if (!PK_VERIFY(view != null))
+			return null;
+		m_Views.Add(fileKey, view);
+	}
+	if (!openedPath.Empty())
+	{
+		const FString	openedKey = _ViewKey(openedPath, pathNotVirtual);
+		if (openedKey != fileKey)
+			m_Views.Add(openedKey, view); // ie. static mesh paths resolving to their UPopcornFXMesh
+	}
+	return view;
+}
+
+//----------------------------------------------------------------------------
+
+void	CFileSystemController_UE::GameThread_UnregisterFile(const UPopcornFXFile *file)
+{
+	PK_ASSERT(FPopcornFXPlugin::IsMainThread());
+
+	TArray<PFileDataView_UE, TInlineAllocator<2>>	views;
+	{
+		PK_SCOPEDLOCK(m_ViewsLock);
+		for (auto it = m_Views.CreateIterator(); it; ++it)
+		{
+			if (it->Value->File() != file)
+				continue;
+			views.AddUnique(it->Value);
+			it.RemoveCurrent();
+		}
+	}
+	// Unreachable from workers now: detach before the caller modifies the file data
+	for (const PFileDataView_UE &view : views)
+		view->GameThread_Detach();
+}
+
+//----------------------------------------------------------------------------
+
+PFileDataView_UE	CFileSystemController_UE::FindFileView(const CString &path, bool pathNotVirtual, bool addStream)
+{
+	PK_SCOPEDLOCK(m_ViewsLock);
+	const PFileDataView_UE	*view = m_Views.Find(_ViewKey(path, pathNotVirtual));
+	if (view == null)
+		return null;
+	if (addStream)
+		(*view)->AddStream(); // Under the views lock: can't race with GameThread_UnregisterFile
+	return *view;
+}
+
+//----------------------------------------------------------------------------
+
 bool	CFileSystemController_UE::Exists(const CString &path, bool pathNotVirtual /*= false*/)
 {
 	if (!IsInGameThread())
 	{
+		if (FindFileView(path, pathNotVirtual) != null)
+			return true;
 		CLog::Log(PK_INFO, "CFileSystemController_UE Exists: cannot load UE packages outside the main thread ('%s' pathNotVirtual:%d)", path.Data(), pathNotVirtual);
 		return false;
 	}
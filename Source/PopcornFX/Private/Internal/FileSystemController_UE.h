@@ -14,6 +14,50 @@ class CFileSystemController_UE;
 class UPopcornFXFile;
 extern CFileSystemController_UE		*g_FsController;
 
+//----------------------------------------------------------------------------
+//
+//	Read-only view over the resident data of a UPopcornFXFile, shared by all streams reading it.
+//	Views are registered on the game thread, and can be opened from any thread.
+//	When the file data is about to change (unload, reimport, write), the view is unregistered and detached:
+//	streams still reading it keep a private copy, new streams see the new data.
+//
+//----------------------------------------------------------------------------
+
+class	CFileDataView_UE : public PopcornFX::CRefCountedObject
+{
+public:
+	CFileDataView_UE(const UPopcornFXFile *file, const PopcornFX::PFilePack &pack, const PopcornFX::SFileTimes &timestamps);
+	~CFileDataView_UE();
+
+	u64								Read(u64 offset, void *targetBuffer, u64 byteCount) const;
+	u64								SizeInBytes() const { return m_Size; }
+	const PopcornFX::SFileTimes		&Timestamps() const { return m_Timestamps; }
+	const PopcornFX::PFilePack		&Pack() const { return m_Pack; }
+	const UPopcornFXFile			*File() const { return m_File; } // Identity only, do not dereference outside the game thread
+
+	void							AddStream();
+	void							RemoveStream();
+
+	// Game thread: does this view still read 'file''s current data
+	bool							GameThread_Matches(const UPopcornFXFile *file) const;
+
+	// Game thread, called once unregistered: the file data is about to change
+	void							GameThread_Detach();
+
+private:
+	mutable FRWLock					m_Lock;
+	const UPopcornFXFile			*m_File;
+	const u8						*m_Data;
+	u64								m_Size;
+	TArray<u8>						m_DetachedData;
+	PopcornFX::PFilePack			m_Pack;
+	PopcornFX::SFileTimes			m_Timestamps;
+	u32								m_OpenStreams = 0;
+};
+PK_DECLARE_REFPTRCLASS(FileDataView_UE);
+
+//----------------------------------------------------------------------------
+
 class	CFileStreamFS_UE : public PopcornFX::CFileStream
 {
 private:
@@ -22,12 +66,14 @@ private:
 		PopcornFX::PFilePack					pack,
 		const PopcornFX::CString				&path,
 		PopcornFX::IFileSystem::EAccessPolicy	mode,
-		UPopcornFXFile							*file);
+		UPopcornFXFile							*file,
+		const PFileDataView_UE					&view);
 
 public:
 	virtual ~CFileStreamFS_UE();
 
 	static CFileStreamFS_UE	*Open(CFileSystemController_UE *controller, const PopcornFX::CString &path, bool pathNotVirtual, PopcornFX::IFileSystem::EAccessPolicy mode);
+	static CFileStreamFS_UE	*OpenResident(CFileSystemController_UE *controller, const PopcornFX::CString &path, bool pathNotVirtual);
 
 	virtual u64			Read(void *targetBuffer, u64 byteCount) override;
 	virtual u64			Write(const void *sourceBuffer, u64 byteCount) override;
@@ -39,13 +85,19 @@ public:
 	virtual u64			SizeInBytes() const override;
 	virtual void		Timestamps(PopcornFX::SFileTimes &timestamps) override;
 
+private:
+	bool				_Writing() const { return m_Mode == PopcornFX::IFileSystem::Access_WriteCreate || m_Mode == PopcornFX::IFileSystem::Access_ReadWriteCreate; }
+
 private:
 	PopcornFX::IFileSystem::EAccessPolicy	m_Mode;
-	UPopcornFXFile		*m_File;
+	UPopcornFXFile		*m_File; // Write streams only: game thread
+	PFileDataView_UE	m_View; // Read streams only
 	u64					m_Pos;
 };
 PK_DECLARE_REFPTRCLASS(FileStreamFS_UE);
 
+//----------------------------------------------------------------------------
+
 class	CFileSystemController_UE : public PopcornFX::CFileSystemBase
 {
 public:
@@ -63,4 +115,17 @@ public:
 	virtual void					GetDirectoryContents(char *dpath, char *virtualPath, u32 pathLength, PopcornFX::CFileDirectoryWalker *walker, const PopcornFX::CFilePack *pack) override;
 	virtual bool					CreateDirectoryChainIFN(const PopcornFX::CString &directoryPath, bool pathNotVirtual = false) override;
 	virtual bool					DirectoryDelete(const PopcornFX::CString &path, bool pathNotVirtual = false);
+
+	// Resident file views, see CFileDataView_UE
+	PFileDataView_UE				GameThread_RegisterFile(const UPopcornFXFile *file, const PopcornFX::CString &openedPath = PopcornFX::CString(), bool pathNotVirtual = false);
+	void							GameThread_UnregisterFile(const UPopcornFXFile *file);
+	PFileDataView_UE				FindFileView(const PopcornFX::CString &path, bool pathNotVirtual, bool addStream = false);
+
+private:
+	FString							_ViewKey(const PopcornFX::CString &path, bool pathNotVirtual) const;
+
+private:
+	PopcornFX::Threads::CCriticalSection	m_ViewsLock;
+	TMap<FString, PFileDataView_UE>			m_Views; // Virtual path -> view. Several paths can map to the same file (meshes)
+	FString									m_PackPath; // Cached on the game thread, to resolve non-virtual paths from workers
 };
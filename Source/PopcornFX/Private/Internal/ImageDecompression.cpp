@@ -0,0 +1,692 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#include "ImageDecompression.h"
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	PK_FORCEINLINE u8	_Clamp255(s32 value)
+	{
+		return static_cast<u8>(value < 0 ? 0 : (value > 255 ? 255 : value));
+	}
+
+	//----------------------------------------------------------------------------
+	//
+	//	BC4: single channel, two 8 bits endpoints + 16 3 bits indices
+	//
+	//----------------------------------------------------------------------------
+
+	void	_DecodeBlock_BC4(const u8 *block, u8 outLum[16])
+	{
+		const u32	e0 = block[0];
+		const u32	e1 = block[1];
+		u8			palette[8];
+
+		palette[0] = static_cast<u8>(e0);
+		palette[1] = static_cast<u8>(e1);
+		if (e0 > e1)
+		{
+			for (u32 i = 1; i < 7; ++i)
+				palette[i + 1] = static_cast<u8>(((7 - i) * e0 + i * e1 + 3) / 7);
+		}
+		else
+		{
+			for (u32 i = 1; i < 5; ++i)
+				palette[i + 1] = static_cast<u8>(((5 - i) * e0 + i * e1 + 2) / 5);
+			palette[6] = 0;
+			palette[7] = 255;
+		}
+
+		u64	indices = 0;
+		for (u32 i = 0; i < 6; ++i)
+			indices |= u64(block[2 + i]) << (8 * i);
+		for (u32 i = 0; i < 16; ++i)
+			outLum[i] = palette[(indices >> (3 * i)) & 0x7];
+	}
+
+	//----------------------------------------------------------------------------
+	//
+	//	BC7: 8 modes with 1 to 3 subsets, see the D3D11 functional spec
+	//
+	//----------------------------------------------------------------------------
+
+	struct	SBC7Mode
+	{
+		u8	m_SubsetCount;
+		u8	m_PartitionBits;
+		u8	m_RotationBits;
+		u8	m_IndexSelectionBits;
+		u8	m_ColorBits;
+		u8	m_AlphaBits;
+		u8	m_EndpointPBits;
+		u8	m_SharedPBits;
+		u8	m_IndexBits;
+		u8	m_SecondaryIndexBits;
+	};
+
+	const SBC7Mode	kBC7Modes[8] =
+	{
+		{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+		{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+		{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+		{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+		{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+		{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+		{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+		{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+	};
+
+	// One bit per pixel: subset of the pixel
+	const u16	kBC7Partitions2[64] =
+	{
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+	};
+
+	const u8	kBC7Partitions3[64][16] =
+	{
+		{ 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2 },
+		{ 0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1 },
+		{ 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2 },
+		{ 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1 },
+		{ 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2 },
+		{ 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2 },
+		{ 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2 },
+		{ 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2 },
+		{ 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0 },
+		{ 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2 },
+		{ 0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0 },
+		{ 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1 },
+		{ 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2 },
+		{ 0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2 },
+		{ 0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0 },
+		{ 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0 },
+		{ 0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2 },
+		{ 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0 },
+		{ 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1 },
+		{ 0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2 },
+		{ 0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2 },
+		{ 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1 },
+		{ 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1 },
+		{ 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2 },
+		{ 0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1 },
+		{ 0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2 },
+		{ 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0 },
+		{ 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0 },
+		{ 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0 },
+		{ 0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0 },
+		{ 0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1 },
+		{ 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1 },
+		{ 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1 },
+		{ 0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1 },
+		{ 0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1 },
+		{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1 },
+		{ 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1 },
+		{ 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2 },
+		{ 0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1 },
+		{ 0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2 },
+		{ 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2 },
+		{ 0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2 },
+		{ 0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2 },
+		{ 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2 },
+		{ 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2 },
+		{ 0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2 },
+		{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2 },
+		{ 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1 },
+		{ 0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2 },
+		{ 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0 },
+	};
+
+	// Anchor pixel of the second subset for 2 subsets partitions
+	const u8	kBC7Anchors2[64] =
+	{
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15,  2,  8,  2,  2,  8,  8, 15,
+		 2,  8,  2,  2,  8,  8,  2,  2,
+		15, 15,  6,  8,  2,  8, 15, 15,
+		 2,  8,  2,  2,  2, 15, 15,  6,
+		 6,  2,  6,  8, 15, 15,  2,  2,
+		15, 15, 15, 15, 15,  2,  2, 15,
+	};
+
+	// Anchor pixels of the second and third subsets for 3 subsets partitions
+	const u8	kBC7Anchors3[2][64] =
+	{
+		{
+			 3,  3, 15, 15,  8,  3, 15, 15,
+			 8,  8,  6,  6,  6,  5,  3,  3,
+			 3,  3,  8, 15,  3,  3,  6, 10,
+			 5,  8,  8,  6,  8,  5, 15, 15,
+			 8, 15,  3,  5,  6, 10,  8, 15,
+			15,  3, 15,  5, 15, 15, 15, 15,
+			 3, 15,  5,  5,  5,  8,  5, 10,
+			 5, 10,  8, 13, 15, 12,  3,  3,
+		},
+		{
+			15,  8,  8,  3, 15, 15,  3,  8,
+			15, 15, 15, 15, 15, 15, 15,  8,
+			15,  8, 15,  3, 15,  8, 15,  8,
+			 3, 15,  6, 10, 15, 15, 10,  8,
+			15,  3, 15, 10, 10,  8,  9, 10,
+			 6, 15,  8, 15,  3,  6,  6,  8,
+			15,  3, 15, 15, 15, 15, 15, 15,
+			15, 15, 15, 15,  3, 15, 15,  8,
+		},
+	};
+
+	const u8	kBC7Weights2[4] = { 0, 21, 43, 64 };
+	const u8	kBC7Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	const u8	kBC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+	PK_FORCEINLINE u8	_BC7Interpolate(u32 e0, u32 e1, u32 index, u32 indexBits)
+	{
+		const u8	*weights = indexBits == 2 ? kBC7Weights2 : (indexBits == 3 ? kBC7Weights3 : kBC7Weights4);
+		const u32	w = weights[index];
+		return static_cast<u8>(((64 - w) * e0 + w * e1 + 32) >> 6);
+	}
+
+	struct	SBC7BitReader
+	{
+		const u8	*m_Block;
+		u32			m_Position;
+
+		u32		Read(u32 bitCount)
+		{
+			u32	value = 0;
+			for (u32 i = 0; i < bitCount; ++i, ++m_Position)
+				value |= ((m_Block[m_Position >> 3] >> (m_Position & 7)) & 1U) << i;
+			return value;
+		}
+	};
+
+	void	_DecodeBlock_BC7(const u8 *block, u8 outRGBA[16][4])
+	{
+		u32	modeIndex = 0;
+		while (modeIndex < 8 && (block[0] & (1U << modeIndex)) == 0)
+			++modeIndex;
+		if (modeIndex == 8) // Reserved, decodes to transparent black
+		{
+			PopcornFX::Mem::Clear(outRGBA, 16 * 4);
+			return;
+		}
+
+		const SBC7Mode	&mode = kBC7Modes[modeIndex];
+		SBC7BitReader	bits = { block, modeIndex + 1 };
+
+		const u32	partition = bits.Read(mode.m_PartitionBits);
+		const u32	rotation = bits.Read(mode.m_RotationBits);
+		const u32	indexSelection = bits.Read(mode.m_IndexSelectionBits);
+		const u32	subsetCount = mode.m_SubsetCount;
+
+		// [subset][endpoint][channel]
+		u32		endpoints[3][2][4] = {};
+		for (u32 channel = 0; channel < 3; ++channel)
+		{
+			for (u32 subset = 0; subset < subsetCount; ++subset)
+			{
+				endpoints[subset][0][channel] = bits.Read(mode.m_ColorBits);
+				endpoints[subset][1][channel] = bits.Read(mode.m_ColorBits);
+			}
+		}
+		if (mode.m_AlphaBits > 0)
+		{
+			for (u32 subset = 0; subset < subsetCount; ++subset)
+			{
+				endpoints[subset][0][3] = bits.Read(mode.m_AlphaBits);
+				endpoints[subset][1][3] = bits.Read(mode.m_AlphaBits);
+			}
+		}
+
+		u32			colorBits = mode.m_ColorBits;
+		u32			alphaBits = mode.m_AlphaBits;
+		const u32	channelCount = mode.m_AlphaBits > 0 ? 4 : 3;
+		if (mode.m_EndpointPBits != 0 || mode.m_SharedPBits != 0)
+		{
+			for (u32 subset = 0; subset < subsetCount; ++subset)
+			{
+				const u32	sharedPBit = mode.m_SharedPBits != 0 ? bits.Read(1) : 0;
+				for (u32 endpoint = 0; endpoint < 2; ++endpoint)
+				{
+					const u32	pBit = mode.m_EndpointPBits != 0 ? bits.Read(1) : sharedPBit;
+					for (u32 channel = 0; channel < channelCount; ++channel)
+						endpoints[subset][endpoint][channel] = (endpoints[subset][endpoint][channel] << 1) | pBit;
+				}
+			}
+			++colorBits;
+			if (alphaBits > 0)
+				++alphaBits;
+		}
+
+		// Expand endpoints to 8 bits by replicating their high bits
+		for (u32 subset = 0; subset < subsetCount; ++subset)
+		{
+			for (u32 endpoint = 0; endpoint < 2; ++endpoint)
+			{
+				u32	*e = endpoints[subset][endpoint];
+				for (u32 channel = 0; channel < 3; ++channel)
+				{
+					e[channel] <<= (8 - colorBits);
+					e[channel] |= e[channel] >> colorBits;
+				}
+				if (alphaBits > 0)
+				{
+					e[3] <<= (8 - alphaBits);
+					e[3] |= e[3] >> alphaBits;
+				}
+				else
+					e[3] = 255;
+			}
+		}
+
+		u32	subsets[16];
+		u32	anchors[3] = { 0, 0, 0 };
+		for (u32 i = 0; i < 16; ++i)
+		{
+			if (subsetCount == 1)
+				subsets[i] = 0;
+			else if (subsetCount == 2)
+				subsets[i] = (kBC7Partitions2[partition] >> i) & 1U;
+			else
+				subsets[i] = kBC7Partitions3[partition][i];
+		}
+		if (subsetCount == 2)
+			anchors[1] = kBC7Anchors2[partition];
+		else if (subsetCount == 3)
+		{
+			anchors[1] = kBC7Anchors3[0][partition];
+			anchors[2] = kBC7Anchors3[1][partition];
+		}
+
+		// Anchor pixels have their index high bit implicitly set to 0
+		u32	indices[16];
+		u32	secondaryIndices[16] = {};
+		for (u32 i = 0; i < 16; ++i)
+			indices[i] = bits.Read(mode.m_IndexBits - (i == anchors[subsets[i]] ? 1 : 0));
+		if (mode.m_SecondaryIndexBits > 0)
+		{
+			for (u32 i = 0; i < 16; ++i)
+				secondaryIndices[i] = bits.Read(mode.m_SecondaryIndexBits - (i == 0 ? 1 : 0));
+		}
+
+		for (u32 i = 0; i < 16; ++i)
+		{
+			const u32	*e0 = endpoints[subsets[i]][0];
+			const u32	*e1 = endpoints[subsets[i]][1];
+			u32			colorIndex = indices[i];
+			u32			colorIndexBits = mode.m_IndexBits;
+			u32			alphaIndex = indices[i];
+			u32			alphaIndexBits = mode.m_IndexBits;
+			if (mode.m_SecondaryIndexBits > 0)
+			{
+				if (indexSelection != 0)
+				{
+					colorIndex = secondaryIndices[i];
+					colorIndexBits = mode.m_SecondaryIndexBits;
+				}
+				else
+				{
+					alphaIndex = secondaryIndices[i];
+					alphaIndexBits = mode.m_SecondaryIndexBits;
+				}
+			}
+
+			u8	*dst = outRGBA[i];
+			for (u32 channel = 0; channel < 3; ++channel)
+				dst[channel] = _BC7Interpolate(e0[channel], e1[channel], colorIndex, colorIndexBits);
+			dst[3] = _BC7Interpolate(e0[3], e1[3], alphaIndex, alphaIndexBits);
+			if (rotation != 0)
+				PopcornFX::PKSwap(dst[3], dst[rotation - 1]);
+		}
+	}
+
+	//----------------------------------------------------------------------------
+	//
+	//	ETC2 RGB (ETC1 compatible individual/differential modes + T, H and planar modes) and EAC alpha
+	//
+	//----------------------------------------------------------------------------
+
+	const s32	kETCModifiers[8][2] =
+	{
+		{ 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 },
+	};
+
+	const s32	kETCDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+	const s32	kEACModifiers[16][8] =
+	{
+		{ -3, -6, -9, -15, 2, 5, 8, 14 },
+		{ -3, -7, -10, -13, 2, 6, 9, 12 },
+		{ -2, -5, -8, -13, 1, 4, 7, 12 },
+		{ -2, -4, -6, -13, 1, 3, 5, 12 },
+		{ -3, -6, -8, -12, 2, 5, 7, 11 },
+		{ -3, -7, -9, -11, 2, 6, 8, 10 },
+		{ -4, -7, -8, -11, 3, 6, 7, 10 },
+		{ -3, -5, -8, -11, 2, 4, 7, 10 },
+		{ -2, -6, -8, -10, 1, 5, 7, 9 },
+		{ -2, -5, -8, -10, 1, 4, 7, 9 },
+		{ -2, -4, -8, -10, 1, 3, 7, 9 },
+		{ -2, -5, -7, -10, 1, 4, 6, 9 },
+		{ -3, -4, -7, -10, 2, 3, 6, 9 },
+		{ -1, -2, -3, -10, 0, 1, 2, 9 },
+		{ -4, -6, -8, -9, 3, 5, 7, 8 },
+		{ -3, -5, -7, -9, 2, 4, 6, 8 },
+	};
+
+	PK_FORCEINLINE s32	_Extend4(u32 v) { return static_cast<s32>((v << 4) | v); }
+	PK_FORCEINLINE s32	_Extend5(u32 v) { return static_cast<s32>((v << 3) | (v >> 2)); }
+	PK_FORCEINLINE s32	_Extend6(u32 v) { return static_cast<s32>((v << 2) | (v >> 4)); }
+	PK_FORCEINLINE s32	_Extend7(u32 v) { return static_cast<s32>((v << 1) | (v >> 6)); }
+
+	PK_FORCEINLINE s32	_SignExtend3(u32 v) { return (v & 0x4) != 0 ? static_cast<s32>(v) - 8 : static_cast<s32>(v); }
+
+	// Writes opaque RGBA, pixels in row-major order
+	void	_DecodeBlock_ETC2RGB(const u8 *block, u8 outRGBA[16][4])
+	{
+		// Per pixel 2 bits index, pixels in column-major order: LSBs in the low 16 bits, MSBs in the high 16 bits
+		const u32	msbs = (u32(block[4]) << 8) | block[5];
+		const u32	lsbs = (u32(block[6]) << 8) | block[7];
+
+		s32			paint[4][3];
+		const bool	differential = (block[3] & 0x2) != 0;
+
+		if (differential)
+		{
+			const s32	r = block[0] >> 3;
+			const s32	g = block[1] >> 3;
+			const s32	b = block[2] >> 3;
+			const s32	r2 = r + _SignExtend3(block[0] & 0x7);
+			const s32	g2 = g + _SignExtend3(block[1] & 0x7);
+			const s32	b2 = b + _SignExtend3(block[2] & 0x7);
+
+			if (r2 < 0 || r2 > 31) // T mode
+			{
+				const s32	c0[3] = { _Extend4(((block[0] >> 1) & 0xC) | (block[0] & 0x3)), _Extend4(block[1] >> 4), _Extend4(block[1] & 0xF) };
+				const s32	c1[3] = { _Extend4(block[2] >> 4), _Extend4(block[2] & 0xF), _Extend4(block[3] >> 4) };
+				const s32	d = kETCDistances[((block[3] >> 1) & 0x6) | (block[3] & 0x1)];
+				for (u32 c = 0; c < 3; ++c)
+				{
+					paint[0][c] = c0[c];
+					paint[1][c] = c1[c] + d;
+					paint[2][c] = c1[c];
+					paint[3][c] = c1[c] - d;
+				}
+			}
+			else if (g2 < 0 || g2 > 31) // H mode
+			{
+				const u32	r0 = (block[0] >> 3) & 0xF;
+				const u32	g0 = ((block[0] & 0x7) << 1) | ((block[1] >> 4) & 0x1);
+				const u32	b0 = (block[1] & 0x8) | ((block[1] & 0x3) << 1) | (block[2] >> 7);
+				const u32	r1 = (block[2] >> 3) & 0xF;
+				const u32	g1 = ((block[2] & 0x7) << 1) | (block[3] >> 7);
+				const u32	b1 = (block[3] >> 3) & 0xF;
+				const u32	order = ((r0 << 8) | (g0 << 4) | b0) >= ((r1 << 8) | (g1 << 4) | b1) ? 1 : 0;
+				const s32	d = kETCDistances[(block[3] & 0x4) | ((block[3] & 0x1) << 1) | order];
+				const s32	c0[3] = { _Extend4(r0), _Extend4(g0), _Extend4(b0) };
+				const s32	c1[3] = { _Extend4(r1), _Extend4(g1), _Extend4(b1) };
+				for (u32 c = 0; c < 3; ++c)
+				{
+					paint[0][c] = c0[c] + d;
+					paint[1][c] = c0[c] - d;
+					paint[2][c] = c1[c] + d;
+					paint[3][c] = c1[c] - d;
+				}
+			}
+			else if (b2 < 0 || b2 > 31) // Planar mode
+			{
+				const s32	o[3] =
+				{
+					_Extend6((block[0] >> 1) & 0x3F),
+					_Extend7(((block[0] & 0x1) << 6) | ((block[1] >> 1) & 0x3F)),
+					_Extend6(((block[1] & 0x1) << 5) | (block[2] & 0x18) | ((block[2] & 0x3) << 1) | (block[3] >> 7)),
+				};
+				const s32	h[3] =
+				{
+					_Extend6((((block[3] >> 2) & 0x1F) << 1) | (block[3] & 0x1)),
+					_Extend7(block[4] >> 1),
+					_Extend6(((block[4] & 0x1) << 5) | (block[5] >> 3)),
+				};
+				const s32	v[3] =
+				{
+					_Extend6(((block[5] & 0x7) << 3) | (block[6] >> 5)),
+					_Extend7(((block[6] & 0x1F) << 2) | (block[7] >> 6)),
+					_Extend6(block[7] & 0x3F),
+				};
+				for (u32 y = 0; y < 4; ++y)
+				{
+					for (u32 x = 0; x < 4; ++x)
+					{
+						u8	*dst = outRGBA[y * 4 + x];
+						for (u32 c = 0; c < 3; ++c)
+							dst[c] = _Clamp255((s32(x) * (h[c] - o[c]) + s32(y) * (v[c] - o[c]) + 4 * o[c] + 2) >> 2);
+						dst[3] = 255;
+					}
+				}
+				return;
+			}
+			else // Differential mode
+			{
+				const s32	base[2][3] = { { _Extend5(r), _Extend5(g), _Extend5(b) }, { _Extend5(r2), _Extend5(g2), _Extend5(b2) } };
+				const bool	flip = (block[3] & 0x1) != 0;
+				const u32	tables[2] = { u32(block[3] >> 5) & 0x7, u32(block[3] >> 2) & 0x7 };
+				for (u32 x = 0; x < 4; ++x)
+				{
+					for (u32 y = 0; y < 4; ++y)
+					{
+						const u32	i = x * 4 + y;
+						const u32	subBlock = flip ? (y >= 2) : (x >= 2);
+						const s32	modifier = kETCModifiers[tables[subBlock]][(lsbs >> i) & 0x1];
+						const s32	delta = ((msbs >> i) & 0x1) != 0 ? -modifier : modifier;
+						u8			*dst = outRGBA[y * 4 + x];
+						for (u32 c = 0; c < 3; ++c)
+							dst[c] = _Clamp255(base[subBlock][c] + delta);
+						dst[3] = 255;
+					}
+				}
+				return;
+			}
+
+			// T and H modes: the index directly selects a paint color
+			for (u32 x = 0; x < 4; ++x)
+			{
+				for (u32 y = 0; y < 4; ++y)
+				{
+					const u32	i = x * 4 + y;
+					const u32	index = (((msbs >> i) & 0x1) << 1) | ((lsbs >> i) & 0x1);
+					u8			*dst = outRGBA[y * 4 + x];
+					for (u32 c = 0; c < 3; ++c)
+						dst[c] = _Clamp255(paint[index][c]);
+					dst[3] = 255;
+				}
+			}
+			return;
+		}
+
+		// Individual mode
+		const s32	base[2][3] =
+		{
+			{ _Extend4(block[0] >> 4), _Extend4(block[1] >> 4), _Extend4(block[2] >> 4) },
+			{ _Extend4(block[0] & 0xF), _Extend4(block[1] & 0xF), _Extend4(block[2] & 0xF) },
+		};
+		const bool	flip = (block[3] & 0x1) != 0;
+		const u32	tables[2] = { u32(block[3] >> 5) & 0x7, u32(block[3] >> 2) & 0x7 };
+		for (u32 x = 0; x < 4; ++x)
+		{
+			for (u32 y = 0; y < 4; ++y)
+			{
+				const u32	i = x * 4 + y;
+				const u32	subBlock = flip ? (y >= 2) : (x >= 2);
+				const s32	modifier = kETCModifiers[tables[subBlock]][(lsbs >> i) & 0x1];
+				const s32	delta = ((msbs >> i) & 0x1) != 0 ? -modifier : modifier;
+				u8			*dst = outRGBA[y * 4 + x];
+				for (u32 c = 0; c < 3; ++c)
+					dst[c] = _Clamp255(base[subBlock][c] + delta);
+				dst[3] = 255;
+			}
+		}
+	}
+
+	// Writes the alpha channel of 'outRGBA'
+	void	_DecodeBlock_EACAlpha(const u8 *block, u8 outRGBA[16][4])
+	{
+		const s32	base = block[0];
+		const s32	multiplier = block[1] >> 4;
+		const s32	*modifiers = kEACModifiers[block[1] & 0xF];
+
+		u64	indices = 0;
+		for (u32 i = 0; i < 6; ++i)
+			indices = (indices << 8) | block[2 + i];
+		// 3 bits per pixel, first pixel in the high bits, pixels in column-major order
+		for (u32 i = 0; i < 16; ++i)
+		{
+			const u32	index = static_cast<u32>(indices >> (45 - 3 * i)) & 0x7;
+			const u32	x = i / 4;
+			const u32	y = i % 4;
+			outRGBA[y * 4 + x][3] = _Clamp255(base + modifiers[index] * multiplier);
+		}
+	}
+
+	//----------------------------------------------------------------------------
+
+	struct	SBlockFormat
+	{
+		u32		m_BlockSizeInBytes;
+		u32		m_DstPixelSizeInBytes;
+	};
+
+	bool	_GetBlockFormat(EPixelFormat pixelFormat, SBlockFormat &outFormat)
+	{
+		switch (pixelFormat)
+		{
+		case PF_BC4:
+			outFormat = { 8, 1 };
+			return true;
+		case PF_BC7:
+		case PF_ETC2_RGBA:
+			outFormat = { 16, 4 };
+			return true;
+		case PF_ETC2_RGB:
+			outFormat = { 8, 4 };
+			return true;
+		default:
+			return false;
+		}
+	}
+
+} // namespace
+
+//----------------------------------------------------------------------------
+
+PopcornFX::CImage::EFormat	PopcornFXImage_DecompressedFormat(EPixelFormat pixelFormat)
+{
+	switch (pixelFormat)
+	{
+	case PF_BC4:
+		return PopcornFX::CImage::Format_Lum8;
+	case PF_BC7:
+	case PF_ETC2_RGB:
+	case PF_ETC2_RGBA:
+		return PopcornFX::CImage::Format_BGRA8;
+	default:
+		return PopcornFX::CImage::Format_Invalid;
+	}
+}
+
+//----------------------------------------------------------------------------
+
+bool	PopcornFXImage_Decompress(EPixelFormat pixelFormat, const CUint2 &size, const void *src, u32 srcSizeInBytes, void *dst, u32 dstSizeInBytes)
+{
+	PK_NAMEDSCOPEDPROFILE_C("PopcornFXImage_Decompress", POPCORNFX_UE_PROFILER_COLOR);
+
+	SBlockFormat	format;
+	if (!PK_VERIFY(_GetBlockFormat(pixelFormat, format)))
+		return false;
+
+	const u32	blockCountX = (size.x() + 3) / 4;
+	const u32	blockCountY = (size.y() + 3) / 4;
+	if (!PK_VERIFY(srcSizeInBytes >= blockCountX * blockCountY * format.m_BlockSizeInBytes) ||
+		!PK_VERIFY(dstSizeInBytes >= size.x() * size.y() * format.m_DstPixelSizeInBytes))
+		return false;
+
+	const u8	*srcBlock = static_cast<const u8*>(src);
+	u8			*dstPixels = static_cast<u8*>(dst);
+	for (u32 blockY = 0; blockY < blockCountY; ++blockY)
+	{
+		for (u32 blockX = 0; blockX < blockCountX; ++blockX, srcBlock += format.m_BlockSizeInBytes)
+		{
+			u8	texels[16][4]; // RGBA, or luminance in [i][0]
+			switch (pixelFormat)
+			{
+			case PF_BC4:
+			{
+				u8	lum[16];
+				_DecodeBlock_BC4(srcBlock, lum);
+				for (u32 i = 0; i < 16; ++i)
+					texels[i][0] = lum[i];
+				break;
+			}
+			case PF_BC7:
+				_DecodeBlock_BC7(srcBlock, texels);
+				break;
+			case PF_ETC2_RGB:
+				_DecodeBlock_ETC2RGB(srcBlock, texels);
+				break;
+			case PF_ETC2_RGBA:
+				_DecodeBlock_ETC2RGB(srcBlock + 8, texels);
+				_DecodeBlock_EACAlpha(srcBlock, texels);
+				break;
+			default:
+				PK_ASSERT_NOT_REACHED();
+				return false;
+			}
+
+			// Edge blocks of non multiple of 4 mips are cropped
+			const u32	pixelCountX = PopcornFX::PKMin(4U, size.x() - blockX * 4);
+			const u32	pixelCountY = PopcornFX::PKMin(4U, size.y() - blockY * 4);
+			for (u32 y = 0; y < pixelCountY; ++y)
+			{
+				for (u32 x = 0; x < pixelCountX; ++x)
+				{
+					const u8	*texel = texels[y * 4 + x];
+					u8			*dstPixel = dstPixels + ((blockY * 4 + y) * size.x() + blockX * 4 + x) * format.m_DstPixelSizeInBytes;
+					if (format.m_DstPixelSizeInBytes == 1)
+						dstPixel[0] = texel[0];
+					else // BGRA8
+					{
+						dstPixel[0] = texel[2];
+						dstPixel[1] = texel[1];
+						dstPixel[2] = texel[0];
+						dstPixel[3] = texel[3];
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,29 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#pragma once
+
+#include "PopcornFXMinimal.h"
+
+#include "PixelFormat.h"
+
+#include "PopcornFXSDK.h"
+#include <pk_imaging/include/im_image.h>
+
+//----------------------------------------------------------------------------
+//
+//	CPU decompression of block-compressed texture formats PopcornFX images can't hold as-is
+//	(BC4, BC7, ETC2), so CPU samplers can read textures that stay compressed on the GPU.
+//
+//----------------------------------------------------------------------------
+
+// Returns Format_Invalid if 'pixelFormat' can't be decompressed on the CPU
+PopcornFX::CImage::EFormat	PopcornFXImage_DecompressedFormat(EPixelFormat pixelFormat);
+
+// 'size' is the mip size in pixels, 'src' must contain the (size + 3) / 4 blocks of the mip
+// 'dst' must be at least PopcornFX::CImage::GetFormatPixelBufferSizeInBytes(PopcornFXImage_DecompressedFormat(pixelFormat), size) bytes
+bool						PopcornFXImage_Decompress(EPixelFormat pixelFormat, const CUint2 &size, const void *src, u32 srcSizeInBytes, void *dst, u32 dstSizeInBytes);
+
+//----------------------------------------------------------------------------
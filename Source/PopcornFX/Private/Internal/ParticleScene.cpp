@@ -7,6 +7,7 @@
 
 #include "PopcornFXPlugin.h"
 #include "PopcornFXSceneComponent.h"
+#include "PopcornFXFunctions.h"
 #include "World/PopcornFXSceneProxy.h"
 #include "Assets/PopcornFXRendererMaterial.h"
 #include "Render/RendererSubView.h"
@@ -23,6 +24,7 @@
 #include "PopcornFXStats.h"
 #include "GPUSim/PopcornFXGPUSim.h"
 #include "Render/RenderBatchManager.h"
+#include "Render/BatchDrawer_Decal_CPU.h"
 
 #if PK_WITH_PHYSX
 #	ifdef WITH_APEX
@@ -70,6 +72,7 @@
 #endif // WITH_EDITOR
 
 #include "UnrealClient.h"
+#include "Async/ParallelFor.h"
 
 #include "PopcornFXSDK.h"
 #include <pk_particles/include/ps_mediums.h>
@@ -322,7 +325,7 @@ bool	CParticleScene::InternalSetup(const UPopcornFXSceneComponent *sceneComp)
 #endif // (PK_HAS_GPU != 0)
 	}
 
-	m_CurrentPayloadView = new SPopcornFXPayloadView();
+	m_CurrentPayloadView = &SPopcornFXPayloadView::Invalid;
 
 	return true;
 }
@@ -384,21 +387,8 @@ u32	CParticleScene::_InstanceCount(const PopcornFX::CParticleEffect *effect)
 	PK_ASSERT(effect != null);
 	PK_SCOPEDLOCK(m_EmittersLock);
 
-	u32	instanceCount = 0;
-	for (u32 i = 0; i < m_Emitters.Count(); ++i)
-	{
-		const SEmitterRegister	&emitter = m_Emitters[i];
-		if (!emitter.Valid() ||
-			!emitter.m_Emitter->IsEmitterAlive())
-			continue;
-		PopcornFX::CParticleEffectInstance	*effectInstance = emitter.m_Emitter->_GetEffectInstance();
-		if (!PK_VERIFY(effectInstance != null))
-			continue;
-		if (effectInstance->ParentEffect() == effect)
-			++instanceCount;
-	}
-
-	return instanceCount;
+	const u32	*instanceCount = m_EffectInstanceCounts.Find(effect);
+	return instanceCount != null ? *instanceCount : 0;
 }
 
 //----------------------------------------------------------------------------
@@ -939,10 +929,16 @@ bool	CParticleScene::Emitter_Register(UPopcornFXEmitterComponent *emitter)
 {
 	PK_SCOPEDLOCK(m_EmittersLock);
 	PK_ASSERT(!m_Emitters.Contains(emitter));
-	PopcornFX::CGuid	emitterId = m_Emitters.Insert(SEmitterRegister(emitter));
+	const PopcornFX::CParticleEffectInstance	*effectInstance = emitter->_GetEffectInstance();
+	const PopcornFX::CParticleEffect			*parentEffect = effectInstance != null ? effectInstance->ParentEffect() : null;
+	PopcornFX::CGuid	emitterId = m_Emitters.Insert(SEmitterRegister(emitter, parentEffect));
 	PK_ASSERT(emitterId.Valid());
 	if (emitterId.Valid())
+	{
+		if (parentEffect != null)
+			++m_EffectInstanceCounts.FindOrAdd(parentEffect, 0);
 		emitter->Scene_OnRegistered(this, emitterId);
+	}
 	return emitterId.Valid();
 }
 
@@ -959,6 +955,7 @@ bool	CParticleScene::Emitter_Unregister(UPopcornFXEmitterComponent *emitter)
 		if (PK_VERIFY(emitterId < m_Emitters.Count()) &&
 			PK_VERIFY(m_Emitters[emitterId] == emitter))
 		{
+			_DecrementEffectInstanceCount(m_Emitters[emitterId].m_ParentEffect);
 			m_Emitters.Remove(emitterId);
 			ok = true;
 		}
@@ -970,6 +967,35 @@ bool	CParticleScene::Emitter_Unregister(UPopcornFXEmitterComponent *emitter)
 
 //----------------------------------------------------------------------------
 
+u32	CParticleScene::EffectInstanceCount(const UPopcornFXEffect *effect)
+{
+	if (effect == null)
+		return 0;
+	// UPopcornFXEffect::Effect() is not const, but we only read the loaded runtime effect
+	CPopcornFXEffect	*effectPriv = const_cast<UPopcornFXEffect*>(effect)->Effect();
+	if (effectPriv == null)
+		return 0;
+	const PopcornFX::PCParticleEffect	particleEffect = effectPriv->ParticleEffectIFP();
+	if (particleEffect == null)
+		return 0;
+	return _InstanceCount(particleEffect.Get());
+}
+
+//----------------------------------------------------------------------------
+
+void	CParticleScene::_DecrementEffectInstanceCount(const PopcornFX::CParticleEffect *parentEffect)
+{
+	if (parentEffect == null)
+		return;
+	u32	*instanceCount = m_EffectInstanceCounts.Find(parentEffect);
+	if (!PK_VERIFY(instanceCount != null && *instanceCount > 0))
+		return;
+	if (--(*instanceCount) == 0)
+		m_EffectInstanceCounts.Remove(parentEffect);
+}
+
+//----------------------------------------------------------------------------
+
 bool	CParticleScene::Effect_Install(PopcornFX::PCParticleEffect &effect)
 {
 	if (!PK_VERIFY(effect != null) ||
@@ -980,6 +1006,147 @@ bool	CParticleScene::Effect_Install(PopcornFX::PCParticleEffect &effect)
 
 //----------------------------------------------------------------------------
 
+bool	SPopcornFXEmitterUpdateBatch::Reserve(u32 count)
+{
+	bool	success = true;
+	success &= m_Emitters.Reserve(count);
+	success &= m_EffectInstances.Reserve(count);
+	m_ComponentTransforms.Reserve(count);
+	success &= m_CurrentTransforms.Reserve(count);
+	success &= m_PreviousTransforms.Reserve(count);
+	success &= m_PreviousPositions.Reserve(count);
+	success &= m_CurrentVelocities.Reserve(count);
+	success &= m_PreviousVelocities.Reserve(count);
+	success &= m_TimeScales.Reserve(count);
+	success &= m_Flags.Reserve(count);
+	return success;
+}
+
+//----------------------------------------------------------------------------
+
+s32	SPopcornFXEmitterUpdateBatch::Add(UPopcornFXEmitterComponent *emitter)
+{
+	const u32	index = m_Emitters.Count();
+	if (!m_Emitters.PushBack(emitter).Valid() ||
+		!m_EffectInstances.PushBack().Valid() ||
+		!m_CurrentTransforms.PushBack().Valid() ||
+		!m_PreviousTransforms.PushBack().Valid() ||
+		!m_PreviousPositions.PushBack().Valid() ||
+		!m_CurrentVelocities.PushBack().Valid() ||
+		!m_PreviousVelocities.PushBack().Valid() ||
+		!m_TimeScales.PushBack().Valid() ||
+		!m_Flags.PushBack().Valid())
+	{
+		// Keep all streams the same size
+		m_Emitters.Resize(index);
+		m_EffectInstances.Resize(index);
+		m_CurrentTransforms.Resize(index);
+		m_PreviousTransforms.Resize(index);
+		m_PreviousPositions.Resize(index);
+		m_CurrentVelocities.Resize(index);
+		m_PreviousVelocities.Resize(index);
+		m_TimeScales.Resize(index);
+		m_Flags.Resize(index);
+		return -1;
+	}
+	m_ComponentTransforms.AddUninitialized();
+	return index;
+}
+
+//----------------------------------------------------------------------------
+
+void	SPopcornFXEmitterUpdateBatch::Clear()
+{
+	m_Emitters.Clear();
+	m_EffectInstances.Clear();
+	m_ComponentTransforms.Reset();
+	m_CurrentTransforms.Clear();
+	m_PreviousTransforms.Clear();
+	m_PreviousPositions.Clear();
+	m_CurrentVelocities.Clear();
+	m_PreviousVelocities.Clear();
+	m_TimeScales.Clear();
+	m_Flags.Clear();
+}
+
+//----------------------------------------------------------------------------
+
+void	SPopcornFXEmitterUpdateBatch::Clean()
+{
+	m_Emitters.Clean();
+	m_EffectInstances.Clean();
+	m_ComponentTransforms.Empty();
+	m_CurrentTransforms.Clean();
+	m_PreviousTransforms.Clean();
+	m_PreviousPositions.Clean();
+	m_CurrentVelocities.Clean();
+	m_PreviousVelocities.Clean();
+	m_TimeScales.Clean();
+	m_Flags.Clean();
+}
+
+//----------------------------------------------------------------------------
+
+void	SPopcornFXEmitterUpdateBatch::UpdateTransforms(u32 first, u32 end, float dt)
+{
+	using namespace PopcornFX;
+
+	PK_ASSERT(first <= end && end <= Count());
+	const float		rcpscale = FPopcornFXPlugin::GlobalScaleRcp();
+
+	// Does not touch any UObject: safe to run from any thread, for disjoint [first, end) ranges
+	for (u32 i = first; i < end; ++i)
+	{
+		CFloat4x4		&currentTr = m_CurrentTransforms[i];
+		CFloat4x4		&previousTr = m_PreviousTransforms[i];
+		CFloat3			&prevPrevPos = m_PreviousPositions[i];
+		CFloat3			&currentVel = m_CurrentVelocities[i];
+		CFloat3			&previousVel = m_PreviousVelocities[i];
+		const bool		teleport = (m_Flags[i] & Flag_Teleport) != 0;
+
+		if (!teleport)
+		{
+			// Prev = Curr
+			prevPrevPos = previousTr.StrippedTranslations();
+			previousTr = currentTr;
+			previousVel = currentVel;
+		}
+
+		// Update Position
+		currentTr = ToPk(m_ComponentTransforms[i].ToMatrixWithScale());
+		currentTr.StrippedTranslations() *= rcpscale;
+
+		// Update Velocity
+		if (!teleport && dt > 0)
+			currentVel = ParticleToolbox::PredictCurrentVelocity(currentTr.StrippedTranslations(), previousTr.StrippedTranslations(), prevPrevPos, dt);
+		else
+			currentVel = CFloat3::ZERO;
+
+		if (teleport)
+		{
+			// Make previous frame same as current
+			prevPrevPos = currentTr.StrippedTranslations();
+			previousTr = currentTr;
+			previousVel = currentVel;
+		}
+
+		CParticleEffectInstance	*effectInstance = m_EffectInstances[i];
+		PK_ASSERT(effectInstance != null);
+		effectInstance->SetVisible((m_Flags[i] & Flag_Visible) != 0);
+		effectInstance->SetTimeScale(m_TimeScales[i]);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Emitters processed per task by _PreUpdate_Emitters. Below two chunks, the batch is processed inline.
+	static const u32	kEmitterUpdateChunkSize = 128;
+} // namespace
+
+//----------------------------------------------------------------------------
+
 void	CParticleScene::_PreUpdate_Emitters(float dt)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PreUpdate_Emitters", POPCORNFX_UE_PROFILER_COLOR);
@@ -1003,11 +1170,44 @@ void	CParticleScene::_PreUpdate_Emitters(float dt)
 		return;
 	PK_SCOPEDLOCK(m_EmittersLock);
 	INC_DWORD_STAT_BY(STAT_PopcornFX_EmitterUpdateCount, m_Emitters.UsedCount());
-	for (uint32 emitteri = 0; emitteri < m_Emitters.Count(); ++emitteri)
+
+	SPopcornFXEmitterUpdateBatch	&batch = m_EmitterUpdateBatch;
+	batch.Clear();
+	if (!PK_VERIFY(batch.Reserve(m_Emitters.UsedCount())))
+		return;
+
+	// Gather: reads component transforms, visibility and time dilation (game thread only)
 	{
-		SEmitterRegister		&emitter = m_Emitters[emitteri];
-		if (emitter.Valid())
-			emitter.m_Emitter->Scene_PreUpdate(this, dt);
+		PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PreUpdate_Emitters Gather", POPCORNFX_UE_PROFILER_COLOR);
+		for (uint32 emitteri = 0; emitteri < m_Emitters.Count(); ++emitteri)
+		{
+			SEmitterRegister		&emitter = m_Emitters[emitteri];
+			if (emitter.Valid())
+				emitter.m_Emitter->Scene_PreUpdate_Gather(this, batch);
+		}
+	}
+
+	const u32	batchCount = batch.Count();
+	if (batchCount == 0)
+		return;
+
+	// Transforms, velocities, visibility and time scale
+	{
+		PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PreUpdate_Emitters Transforms", POPCORNFX_UE_PROFILER_COLOR);
+		const u32	chunkCount = (batchCount + kEmitterUpdateChunkSize - 1) / kEmitterUpdateChunkSize;
+		ParallelFor(chunkCount, [&batch, batchCount, dt](int32 chunki)
+		{
+			const u32	first = u32(chunki) * kEmitterUpdateChunkSize;
+			const u32	end = PopcornFX::PKMin(first + kEmitterUpdateChunkSize, batchCount);
+			batch.UpdateTransforms(first, end, dt);
+		}, chunkCount < 2 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	// Apply: write back and update attributes (game thread only)
+	{
+		PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PreUpdate_Emitters Apply", POPCORNFX_UE_PROFILER_COLOR);
+		for (u32 batchi = 0; batchi < batchCount; ++batchi)
+			batch.m_Emitters[batchi]->Scene_PreUpdate_Apply(this, batch, batchi, dt);
 	}
 }
 
@@ -1054,70 +1254,178 @@ void	CParticleScene::_Clear_Emitters()
 		}
 		m_Emitters.Clear();
 	}
+	m_EffectInstanceCounts.Empty();
+	m_EmitterUpdateBatch.Clean();
 }
 
 //----------------------------------------------------------------------------
 
 void CParticleScene::ClearDecals(CBatchDrawer_Decal_CPUBB *drawer, bool removeEntry)
 {
+	m_DecalCandidates.RemoveAll([drawer](const SDecalCandidate &candidate) { return candidate.m_Drawer == drawer; });
+
 	const UWorld	*world = SceneComponent()->GetWorld();
 	if (!IsValid(world))
 		return;
 
-	TPair<u32, TArray<FDeferredDecalProxy*>>	*activeDecals = m_ActiveDecals.Find(drawer);
-	if (activeDecals == nullptr)
+	SDecalProxyPool	*pool = m_DecalProxyPools.Find(drawer);
+	if (pool == nullptr)
 		return;
 
-	TArray<FDeferredDecalProxy*>	&activeDecalProxies = activeDecals->Value;
-	const u32	activeDecalProxiesCount = (u32)activeDecalProxies.Num();
-	if (activeDecalProxiesCount == 0)
-		return;
-
-	// Create deletion updates for all decals
-	m_DecalUpdates.AddDefaulted(activeDecalProxiesCount);
-	for (u32 i = 0; i < activeDecalProxiesCount; ++i)
+	TArray<FDeferredDecalProxy*>	&proxies = pool->m_Proxies;
+	const u32	proxyCount = (u32)proxies.Num();
+	if (proxyCount > 0)
 	{
-		m_DecalUpdates[i].OperationType = FDeferredDecalUpdateParams::EOperationType::RemoveFromSceneAndDelete;
-		m_DecalUpdates[i].DecalProxy = activeDecalProxies[i];
-	}
+		// Create deletion updates for all decals
+		for (u32 i = 0; i < proxyCount; ++i)
+		{
+			FDeferredDecalUpdateParams	&updateParams = m_DecalUpdates.AddDefaulted_GetRef();
+			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::RemoveFromSceneAndDelete;
+			updateParams.DecalProxy = proxies[i];
+		}
 
-	// Send updates to RT
-	world->Scene->BatchUpdateDecals(MoveTemp(m_DecalUpdates));
+		// Send updates to RT
+		world->Scene->BatchUpdateDecals(MoveTemp(m_DecalUpdates));
+		m_DecalUpdates.Reset();
+	}
 
-	// Remove batch drawer entry or clear its array
+	// Remove batch drawer entry or clear its pool
 	if (removeEntry)
-		m_ActiveDecals.Remove(drawer);
+		m_DecalProxyPools.Remove(drawer);
 	else
-		activeDecalProxies.Empty();
+		*pool = SDecalProxyPool();
 }
 
 //----------------------------------------------------------------------------
 
+namespace
+{
+	// Unused decal proxies are kept hidden in their pool for that many frames before being released
+	static const u32	kDecalProxyReleaseDelay = 60;
+} // namespace
+
+//----------------------------------------------------------------------------
+
 void CParticleScene::_PostUpdate_Decals()
 {
+	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PostUpdate_Decals", POPCORNFX_UE_PROFILER_COLOR);
+
 	const UWorld	*world = SceneComponent()->GetWorld();
 	if (!IsValid(world))
+	{
+		m_DecalCandidates.Reset();
 		return;
+	}
 
-	for (auto iter = m_ActiveDecals.CreateIterator(); iter; ++iter)
+	// Scene budget: keep the most important decals, in submission order
+	const u32	maxDecals = (u32)FMath::Max(m_SceneComponent->ResolvedRenderSettings().MaxDecals, 0);
+	const u32	candidateCount = (u32)m_DecalCandidates.Num();
+	if (maxDecals > 0 && candidateCount > maxDecals)
 	{
-		u32								&activeDecalCounter = iter.Value().Key;
-		TArray<FDeferredDecalProxy*>	&activeDecalProxies = iter.Value().Value;
+		TArray<float>	sortedImportances;
+		sortedImportances.Reserve(candidateCount);
+		for (const SDecalCandidate &candidate : m_DecalCandidates)
+			sortedImportances.Add(candidate.m_Importance);
+		sortedImportances.Sort(TGreater<float>());
 
-		// Remove any unused decals
-		while ((u32)activeDecalProxies.Num() > activeDecalCounter)
+		const float	threshold = sortedImportances[maxDecals - 1];
+		u32			equalToThresholdBudget = maxDecals;
+		while (equalToThresholdBudget > 0 && sortedImportances[maxDecals - equalToThresholdBudget] > threshold)
+			--equalToThresholdBudget;
+
+		u32		dsti = 0;
+		for (u32 srci = 0; srci < candidateCount; ++srci)
 		{
-			FDeferredDecalUpdateParams	&updateParams = m_DecalUpdates.AddDefaulted_GetRef();
-			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::RemoveFromSceneAndDelete;
-			updateParams.DecalProxy = activeDecalProxies.Pop();
+			const float	importance = m_DecalCandidates[srci].m_Importance;
+			if (importance < threshold)
+				continue;
+			if (importance == threshold)
+			{
+				if (equalToThresholdBudget == 0)
+					continue;
+				--equalToThresholdBudget;
+			}
+			if (dsti != srci)
+				m_DecalCandidates[dsti] = m_DecalCandidates[srci];
+			++dsti;
+		}
+		PK_ASSERT(dsti == maxDecals);
+		INC_DWORD_STAT_BY(STAT_PopcornFX_CulledDecalCount, candidateCount - dsti);
+		m_DecalCandidates.SetNum(dsti, EAllowShrinking::No);
+	}
+
+	// Assign a proxy to each decal, reusing pooled proxies first
+	for (const SDecalCandidate &candidate : m_DecalCandidates)
+	{
+		SDecalProxyPool	&pool = m_DecalProxyPools.FindOrAdd(candidate.m_Drawer);
+
+		FDeferredDecalUpdateParams	&updateParams = m_DecalUpdates.AddDefaulted_GetRef();
+		if (pool.m_UsedCount < (u32)pool.m_Proxies.Num())
+		{
+			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::Update;
+			updateParams.DecalProxy = pool.m_Proxies[pool.m_UsedCount];
+		}
+		else
+		{
+			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::AddToSceneAndUpdate;
+			updateParams.DecalProxy = candidate.m_Drawer->NewDecalProxy();
+			pool.m_Proxies.Push(updateParams.DecalProxy);
+		}
+		++pool.m_UsedCount;
+
+		updateParams.Transform = candidate.m_Transform;
+		updateParams.Bounds = candidate.m_Bounds;
+		updateParams.AbsSpawnTime = 0;
+		updateParams.FadeStartDelay = 0;
+		updateParams.FadeDuration = 0;
+		updateParams.FadeScreenSize = 0.01f;
+		updateParams.DecalColor = candidate.m_Color;
+		updateParams.SortOrder = 0;
+	}
+	m_DecalCandidates.Reset();
+
+	for (auto iter = m_DecalProxyPools.CreateIterator(); iter; ++iter)
+	{
+		SDecalProxyPool					&pool = iter.Value();
+		TArray<FDeferredDecalProxy*>	&proxies = pool.m_Proxies;
+		const u32						usedCount = pool.m_UsedCount;
+
+		pool.m_IdleFrames = usedCount < (u32)proxies.Num() ? pool.m_IdleFrames + 1 : 0;
+		if (pool.m_IdleFrames > kDecalProxyReleaseDelay)
+		{
+			// Release unused decals
+			while ((u32)proxies.Num() > usedCount)
+			{
+				FDeferredDecalUpdateParams	&updateParams = m_DecalUpdates.AddDefaulted_GetRef();
+				updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::RemoveFromSceneAndDelete;
+				updateParams.DecalProxy = proxies.Pop();
+			}
+			pool.m_IdleFrames = 0;
+		}
+		else
+		{
+			// Hide decals that became unused this frame: degenerate bounds, culled by their screen size
+			for (u32 i = usedCount; i < pool.m_HiddenBegin && i < (u32)proxies.Num(); ++i)
+			{
+				FDeferredDecalUpdateParams	&updateParams = m_DecalUpdates.AddDefaulted_GetRef();
+				updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::Update;
+				updateParams.DecalProxy = proxies[i];
+				updateParams.Transform = FTransform(FQuat::Identity, FVector::ZeroVector, FVector(UE_KINDA_SMALL_NUMBER));
+				updateParams.Bounds = FBoxSphereBounds(FVector::ZeroVector, FVector::ZeroVector, 0.0f);
+				updateParams.FadeScreenSize = 0.01f;
+			}
 		}
+		pool.m_HiddenBegin = usedCount;
 
 		// Remove material entries with no decals
-		if (activeDecalCounter == 0)
+		if (proxies.Num() == 0)
+		{
 			iter.RemoveCurrent();
+			continue;
+		}
 
 		// Reset per-frame counter
-		activeDecalCounter = 0;
+		pool.m_UsedCount = 0;
 	}
 
 	// Send updates to RT and reset the array
@@ -1130,9 +1438,10 @@ void CParticleScene::_PostUpdate_Decals()
 
 void CParticleScene::_Clear_Decals()
 {
-	for (auto &iter : m_ActiveDecals)
+	for (auto &iter : m_DecalProxyPools)
 		ClearDecals(iter.Key, false);
-	m_ActiveDecals.Empty();
+	m_DecalProxyPools.Empty();
+	m_DecalCandidates.Empty();
 }
 
 //----------------------------------------------------------------------------
@@ -1172,6 +1481,8 @@ void	CParticleScene::_PreUpdate_Views()
 	UWorld			*world = sceneComponent->GetWorld();
 
 	m_ParticleMediumCollection->ClearAllViews();
+	m_UpdateViewFrustums.Reset();
+	m_UpdateViewOrigins.Reset();
 
 	const EWorldType::Type	worldType = world->WorldType;
 	if (worldType == EWorldType::Inactive ||
@@ -1207,6 +1518,7 @@ void	CParticleScene::_PreUpdate_Views()
 					{
 						const CFloat4x4	worldToView = ToPk(FTranslationMatrix(-projectionData.ViewOrigin * scaleUEToPk) * projectionData.ViewRotationMatrix);
 
+						_AddUpdateView(projectionData);
 						_PatchProjectionMatrix(projectionData.ProjectionMatrix);
 
 						m_ParticleMediumCollection->UpdateView(playerViewId,
@@ -1320,6 +1632,7 @@ void	CParticleScene::_PreUpdate_Views()
 
 		const CFloat4x4	worldToView = ToPk(FTranslationMatrix(-projectionData.ViewOrigin * scaleUEToPk) * projectionData.ViewRotationMatrix);
 
+		_AddUpdateView(projectionData);
 		_PatchProjectionMatrix(projectionData.ProjectionMatrix);
 
 		m_ParticleMediumCollection->UpdateView(0,
@@ -1334,6 +1647,18 @@ void	CParticleScene::_PreUpdate_Views()
 	}
 }
 
+//----------------------------------------------------------------------------
+
+void	CParticleScene::_AddUpdateView(const FSceneViewProjectionData &projectionData)
+{
+	// Must be called before _PatchProjectionMatrix: frustum planes are built from UE's projection
+	FConvexVolume	frustum;
+	GetViewFrustumBounds(frustum, projectionData.ComputeViewProjectionMatrix(), false);
+
+	m_UpdateViewFrustums.Add(MoveTemp(frustum));
+	m_UpdateViewOrigins.Add(projectionData.ViewOrigin);
+}
+
 //----------------------------------------------------------------------------
 //
 //
@@ -1462,6 +1787,25 @@ namespace
 #endif
 
 #if PK_WITH_CHAOS
+namespace
+{
+	// Rays traced per task by CParticleScene::RayTracePacket. Below two chunks, the packet is traced inline.
+	static const u32	kRayTraceChunkSize = 64;
+
+	UPhysicalMaterial	*_ChaosExtractPhysicalMaterial(const Chaos::FPerShapeData *shape)
+	{
+		if (shape == null)
+			return null;
+		const TArray<Chaos::FMaterialHandle>	&fmatData = shape->GetMaterials();
+		if (fmatData.Num() == 0)
+			return null;
+		const Chaos::FChaosPhysicsMaterial		*fPhyMat = fmatData[0].Get();
+		if (fPhyMat == null || fPhyMat->UserData == null)
+			return null;
+		return FChaosUserData::Get<UPhysicalMaterial>(fPhyMat->UserData);
+	}
+} // namespace
+
 class FBlockQueryCallbackChaos : public ICollisionQueryFilterCallbackBase
 {
 public:
@@ -1500,6 +1844,17 @@ void	CParticleScene::RayTracePacket(
 	const PopcornFX::Colliders::STraceFilter &traceFilter,
 	const PopcornFX::Colliders::SRayPacket &packet,
 	const PopcornFX::Colliders::STracePacket &results)
+{
+	_RayTracePacket(traceFilter, packet, results, null);
+}
+
+//----------------------------------------------------------------------------
+
+void	CParticleScene::_RayTracePacket(
+	const PopcornFX::Colliders::STraceFilter &traceFilter,
+	const PopcornFX::Colliders::SRayPacket &packet,
+	const PopcornFX::Colliders::STracePacket &results,
+	u8 *outHitMask)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::RayTracePacket", POPCORNFX_UE_PROFILER_COLOR);
 
@@ -1513,7 +1868,10 @@ void	CParticleScene::RayTracePacket(
 		RayTrace_PX_Exec,
 		RayTrace_Results_Hit,
 		RayTrace_Results_Hit_Comp,
-		RayTrace_Results_Hit_Mat
+		RayTrace_Results_Hit_Mat,
+		RayTrace_CHAOS_BuildQuery,
+		RayTrace_CHAOS_Exec,
+		RayTrace_CHAOS_Results_Hit
 		);
 
 	const u32		resCount = results.Count();
@@ -1681,6 +2039,8 @@ void	CParticleScene::RayTracePacket(
 		// hitTime = PopcornFX::PKMin(hitTime, rayLen);
 
 		results.m_HitTimes_Aligned16[rayi] = hitTime;
+		if (outHitMask != null)
+			outHitMask[rayi] = 1;
 
 		IF_ASSERTS_PHYSX(
 			const CFloat3	hitPos = _Reinterpret<CFloat3>(hit.position) * scaleUEToPk;
@@ -1868,6 +2228,8 @@ void	CParticleScene::RayTracePacket(
 		const float		hitTime = hit.m_Distance * HK2UU * scaleUEToPk;
 
 		results.m_HitTimes_Aligned16[rayi] = hitTime;
+		if (outHitMask != null)
+			outHitMask[rayi] = 1;
 		FVector3f UENormal;
 		Hk2UVector(hit.m_Normal.asVec4(), UENormal);
 		CFloat3			normal = ToPk(UENormal);
@@ -1876,18 +2238,10 @@ void	CParticleScene::RayTracePacket(
 
 #elif PK_WITH_CHAOS
 
-	u32			hitResultBufferCurrentIndex = 0;
-	struct FRaycastBufferAndIndex
-	{
-		FHitLocation	m_HitLocation;
-		u32				m_RayIndex;
-	};
-	PK_STACKMEMORYVIEW(FRaycastBufferAndIndex, hitResultBuffers, resCount);
-
 	// TODO: Contact objects / surfaces with physics
 
 	EHitFlags						outFlags = PK_ONLY_IF_ASSERTS(EHitFlags::Position | ) EHitFlags::Distance | EHitFlags::Normal;
-	FBlockQueryCallbackChaos		callback;
+	FBlockQueryCallbackChaos		callback; // Stateless, shared by all tasks
 	FCollisionFilterData			filterData = FCollisionFilterData();
 	filterData.Word0 = 0; // ECollisionQuery::ObjectQuery;
 	filterData.Word1 = objectTypesToQuery;
@@ -1897,186 +2251,257 @@ void	CParticleScene::RayTracePacket(
 
 	EQueryFlags						queryFlags = EQueryFlags::AnyHit | EQueryFlags::PreFilter;
 	ChaosInterface::FQueryFilterData	queryFilterData = ChaosInterface::MakeQueryFilterData(filterData, queryFlags, FCollisionQueryParams());
-	ChaosInterface::FQueryDebugParams	debugParams;
-	FCollisionShape						sphere;
 
 	// Note: There doesn't seem to be a lock necessary for the Chaos accel struct
+	if (m_CurrentChaosScene == null || m_CurrentChaosScene->GetSpacialAcceleration() == null)
+		return;
+	const auto	&solverAccelerationStructure = m_CurrentChaosScene->GetSpacialAcceleration();
+
+	void		**contactSurfaces = queryPhysicalMaterial ? results.m_ContactSurfaces_Aligned16 : null;
+
+	// Rays are independent and each writes its own result slots: chunks can be traced concurrently.
+	// Deterministic mode traces everything on this thread, in ray order.
+	const bool	deterministic = m_SceneComponent->ResolvedSimulationSettings().bDeterministicCollisionQueries;
+	const u32	chunkCount = (resCount + kRayTraceChunkSize - 1) / kRayTraceChunkSize;
+	ParallelFor(chunkCount, [&](int32 chunki)
 	{
-		if (m_CurrentChaosScene && m_CurrentChaosScene->GetSpacialAcceleration())
+		FChaosSQAccelerator				sqAccelerator(*solverAccelerationStructure);
+		ChaosInterface::FQueryDebugParams	debugParams;
+
+		const u32	first = u32(chunki) * kRayTraceChunkSize;
+		const u32	end = PopcornFX::PKMin(first + kRayTraceChunkSize, resCount);
+		for (u32 rayi = first; rayi < end; ++rayi)
 		{
-			const auto &solverAccelerationStructure = m_CurrentChaosScene->GetSpacialAcceleration();
-			FChaosSQAccelerator sqAccelerator(*solverAccelerationStructure);
+			if (!emptyMasks && packet.m_RayMasks_Aligned16[rayi] == 0)
+				continue;
+
+			CFloat3		start;
+			CFloat3		rayDir;
+			float		rayLen;
 			{
-				for (u32 rayi = 0; rayi < resCount; ++rayi)
-				{
-					if (!emptyMasks && packet.m_RayMasks_Aligned16[rayi] == 0)
-						continue;
+				RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_BuildQuery);
+				const CFloat4	&_rayDirAndLen = packet.m_RayDirectionsAndLengths_Aligned16[rayi];
+				if (_rayDirAndLen.w() <= 0)
+					continue;
+				start = packet.m_RayOrigins_Aligned16[rayi].xyz() * scalePkToUE;
+				rayDir = _rayDirAndLen.xyz();
+				rayLen = _rayDirAndLen.w() * scalePkToUE;
+			}
 
-					CFloat3		start;
-					CFloat3		rayDir;
-					float		rayLen;
+			FHitLocation	hit;
+			bool			hasHit = false;
+			{
+				RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_Exec);
+				if (emptySphereSweeps || packet.m_RaySweepRadii_Aligned16[rayi] == 0.0f)
+				{
+					FSingleHitBuffer<FHitRaycast>	hitBuffer;
+					sqAccelerator.Raycast(FVector(ToUE(start)), FVector(ToUE(rayDir)), rayLen, hitBuffer, outFlags, queryFilterData, callback, debugParams);
+					if (hitBuffer.HasBlockingHit())
 					{
-						RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_BuildQuery);
-						const CFloat4	&_rayDirAndLen = packet.m_RayDirectionsAndLengths_Aligned16[rayi];
-
-						if (_rayDirAndLen.w() <= 0)
-							continue;
-						start = packet.m_RayOrigins_Aligned16[rayi].xyz() * scalePkToUE;
-						rayDir = _rayDirAndLen.xyz();
-						rayLen = _rayDirAndLen.w() * scalePkToUE;
+						hit = *hitBuffer.GetBlock();
+						hasHit = hit.Distance > 0.0f;
 					}
+				}
+				else
+				{
+					const FTransform	startTM = FTransform(FVector(ToUE(start)));
 
-					bool					hasHit = false;
-					FRaycastBufferAndIndex	&resultBufferAndIndex = hitResultBuffers[hitResultBufferCurrentIndex];
+					FSingleHitBuffer<FHitSweep>		hitBuffer;
+					sqAccelerator.Sweep(Chaos::TSphere<Chaos::FReal, 3>(Chaos::FVec3::ZeroVector, packet.m_RaySweepRadii_Aligned16[rayi] * scalePkToUE), startTM, FVector(ToUE(rayDir)), rayLen, hitBuffer, outFlags, queryFilterData, callback, debugParams);
+					if (hitBuffer.HasBlockingHit())
 					{
-						RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_Exec);
-
-						if (emptySphereSweeps || packet.m_RaySweepRadii_Aligned16[rayi] == 0.0f)
-						{
-							FSingleHitBuffer<FHitRaycast>	hitBuffer;
-							sqAccelerator.Raycast(FVector(ToUE(start)), FVector(ToUE(rayDir)), rayLen, hitBuffer, outFlags, queryFilterData, callback, debugParams);
-							if (hitBuffer.HasBlockingHit())
-							{
-								resultBufferAndIndex.m_HitLocation = *hitBuffer.GetBlock();
-								hasHit = resultBufferAndIndex.m_HitLocation.Distance > 0.0f;
-							}
-						}
-						else
-						{
-							const FTransform	startTM = FTransform(FVector(ToUE(start)));
-
-							FSingleHitBuffer<FHitSweep>		hitBuffer;
-							sqAccelerator.Sweep(Chaos::TSphere<Chaos::FReal, 3>(Chaos::FVec3::ZeroVector, packet.m_RaySweepRadii_Aligned16[rayi] * scalePkToUE), startTM, FVector(ToUE(rayDir)), rayLen, hitBuffer, outFlags, queryFilterData, callback, debugParams);
-							if (hitBuffer.HasBlockingHit())
-							{
-								resultBufferAndIndex.m_HitLocation = *hitBuffer.GetBlock();
-								hasHit = resultBufferAndIndex.m_HitLocation.Distance > 0.0f;
-							}
-						}
-
-						if (PK_PREDICT_LIKELY(!hasHit))
-							continue;
+						hit = *hitBuffer.GetBlock();
+						hasHit = hit.Distance > 0.0f;
 					}
-					resultBufferAndIndex.m_RayIndex = rayi;
-					++hitResultBufferCurrentIndex;
 				}
 			}
+
+			if (PK_PREDICT_LIKELY(!hasHit))
+				continue;
+
+			RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_Results_Hit);
+			if (contactSurfaces != null)
+			{
+				RAYTRACE_PROFILE_CAPTURE_CYCLES_N(RayTrace_Results_Hit_Mat, 1);
+				contactSurfaces[rayi] = _ChaosExtractPhysicalMaterial(hit.Shape);
+			}
+
+			// It seems there are odd instabilities output from Chaos ? Length(rayOrigin + rayDir * rayLength) - hit.Distance is > 0.1f in some cases
+			// 0.1 is 10cm
+			results.m_HitTimes_Aligned16[rayi] = hit.Distance * scaleUEToPk;
+			results.m_ContactNormals_Aligned16[rayi].xyz() = ToPk(hit.WorldNormal);
+			if (outHitMask != null)
+				outHitMask[rayi] = 1;
 		}
-	}
+	}, (deterministic || chunkCount < 2) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+#endif
+}
 
-	void** contactSurfaces = queryPhysicalMaterial ? results.m_ContactSurfaces_Aligned16 : null;
+//----------------------------------------------------------------------------
 
-	for (u32 hiti = 0; hiti < hitResultBufferCurrentIndex; ++hiti)
+namespace
+{
+	// A cached hit is reused for at most that many frames, to catch up with moving geometry
+	static const u32	kRayHitCacheMaxAge = 10;
+	// Minimum cosine between the cached and current ray directions
+	static const float	kRayHitCacheMinCosAngle = 0.9995f;
+	// Cache cells are larger than the tolerance, so that rays within tolerance mostly land in the same cell
+	static const float	kRayHitCacheCellSizeScale = 4.0f;
+
+	float	_Dot3(const CFloat3 &a, const CFloat3 &b)
 	{
-		RAYTRACE_PROFILE_CAPTURE_CYCLES(RayTrace_CHAOS_Results_Hit);
-		const FRaycastBufferAndIndex& resultBufferAndIndex = hitResultBuffers[hiti];
+		return a.x() * b.x() + a.y() * b.y() + a.z() * b.z();
+	}
 
-		u32					rayi = hitResultBuffers[hiti].m_RayIndex;
-		const FHitLocation	&hit = hitResultBuffers[hiti].m_HitLocation;
+	u64		_RayHitCacheKey(const CFloat3 &origin, float rcpCellSize, u32 filterFlags)
+	{
+		const u64	x = u64(FMath::FloorToInt64(origin.x() * rcpCellSize)) & 0x1FFFFF;
+		const u64	y = u64(FMath::FloorToInt64(origin.y() * rcpCellSize)) & 0x1FFFFF;
+		const u64	z = u64(FMath::FloorToInt64(origin.z() * rcpCellSize)) & 0x1FFFFF;
+		return ((x << 42) | (y << 21) | z) ^ (u64(filterFlags) * 0x9E3779B97F4A7C15ULL);
+	}
+} // namespace
 
-		PK_ASSERT(rayi < resCount);
+//----------------------------------------------------------------------------
 
-		if (contactSurfaces != null)
-		{
-			RAYTRACE_PROFILE_CAPTURE_CYCLES_N(RayTrace_Results_Hit_Mat, 1);
+void	CParticleScene::RayTracePacketTemporal(
+	const PopcornFX::Colliders::STraceFilter &traceFilter,
+	const PopcornFX::Colliders::SRayPacket &packet,
+	const PopcornFX::Colliders::STracePacket &results)
+{
+	const FPopcornFXSimulationSettings	&settings = m_SceneComponent->ResolvedSimulationSettings();
+	if (!settings.bEnableCollisionTemporalCache)
+	{
+		RayTracePacket(traceFilter, packet, results);
+		return;
+	}
 
-			if (hit.Shape)
-			{
-				const TArray<Chaos::FMaterialHandle> &fmatData = hit.Shape->GetMaterials();
+	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::RayTracePacketTemporal", POPCORNFX_UE_PROFILER_COLOR);
 
-				if (fmatData.Num() != 0)
-				{
-					const Chaos::FChaosPhysicsMaterial *fPhyMat = fmatData[0].Get();
+	typedef std::remove_cv_t<std::remove_reference_t<decltype(packet.m_RayMasks_Aligned16[0])>>	TRayMask;
 
-					if (fPhyMat)
-					{
-						void* userData = fPhyMat->UserData;
+	const u32		resCount = results.Count();
+	const bool		emptySphereSweeps = packet.m_RaySweepRadii_Aligned16.Empty();
+	const bool		emptyMasks = packet.m_RayMasks_Aligned16.Empty();
+	const float		tolerance = FMath::Max(settings.CollisionTemporalCacheTolerance, 0.0f) * FPopcornFXPlugin::GlobalScaleRcp();
+	const float		toleranceSq = tolerance * tolerance;
+	const float		rcpCellSize = 1.0f / FMath::Max(tolerance * kRayHitCacheCellSizeScale, 1.0e-3f);
+	const u32		filterFlags = traceFilter.m_FilterFlags;
+	void			**contactSurfaces = settings.bEnablePhysicalMaterials ? results.m_ContactSurfaces_Aligned16 : null;
+
+	// Read only during the update, swapped in _PreUpdate_Collisions
+	const TMap<u64, SRayHitCacheEntry>	&previousCache = m_RayHitCaches[m_RayHitCacheCurrent ^ 1];
+
+	// Per ray: the reused cache entry, or the mask of the full query and whether it hit
+	PK_STACKMEMORYVIEW(const SRayHitCacheEntry*, reusedEntries, resCount);
+	PK_STACKALIGNEDMEMORYVIEW(TRayMask, tracedMasks, resCount, 0x10);
+	PK_STACKALIGNEDMEMORYVIEW(u8, hitMask, resCount, 0x10);
+	PopcornFX::Mem::Clear(reusedEntries);
+	PopcornFX::Mem::Clear(tracedMasks);
+	PopcornFX::Mem::Clear(hitMask);
+
+	u32		cachedRayCount = 0;
+	u32		tracedRayCount = 0;
+	for (u32 rayi = 0; rayi < resCount; ++rayi)
+	{
+		if (!emptyMasks && packet.m_RayMasks_Aligned16[rayi] == 0)
+			continue;
+		const CFloat4	&rayDirAndLen = packet.m_RayDirectionsAndLengths_Aligned16[rayi];
+		if (rayDirAndLen.w() <= 0)
+			continue;
 
-						if (userData)
-						{
-							UPhysicalMaterial* uPhyMat = FChaosUserData::Get<UPhysicalMaterial>(userData);
-							contactSurfaces[rayi] = uPhyMat;
-						}
-					}
-					else
-					{
-						contactSurfaces[rayi] = null;
-					}
-				}
-				else
+		const CFloat3	origin = packet.m_RayOrigins_Aligned16[rayi].xyz();
+		const CFloat3	direction = rayDirAndLen.xyz();
+		const float		length = rayDirAndLen.w();
+		const float		sweepRadius = emptySphereSweeps ? 0.0f : packet.m_RaySweepRadii_Aligned16[rayi];
+
+		// Reuse last frame's result if the ray barely moved
+		const SRayHitCacheEntry	*entry = previousCache.Find(_RayHitCacheKey(origin, rcpCellSize, filterFlags));
+		if (entry != null &&
+			entry->m_Age < kRayHitCacheMaxAge &&
+			(origin - entry->m_Origin).LengthSquared() <= toleranceSq &&
+			_Dot3(direction, entry->m_Direction) >= kRayHitCacheMinCosAngle &&
+			PopcornFX::PKAbs(length - entry->m_Length) <= tolerance &&
+			PopcornFX::PKAbs(sweepRadius - entry->m_SweepRadius) <= tolerance)
+		{
+			bool	reused = true;
+			if (entry->m_Hit)
+			{
+				// Intersect the ray with the cached contact plane
+				const float	denom = _Dot3(entry->m_Normal, direction);
+				const float	hitTime = denom < -1.0e-4f ? (entry->m_PlaneDistance - _Dot3(entry->m_Normal, origin)) / denom : -1.0f;
+				if (hitTime < 0.0f)
+					reused = false; // Moving away from, or already behind the plane: re-trace
+				else if (entry->m_Surface.IsStale())
+					reused = false; // Contact material was garbage collected: re-trace
+				else if (hitTime <= length)
 				{
-					contactSurfaces[rayi] = null;
+					results.m_HitTimes_Aligned16[rayi] = hitTime;
+					results.m_ContactNormals_Aligned16[rayi].xyz() = entry->m_Normal;
+					if (contactSurfaces != null)
+						contactSurfaces[rayi] = entry->m_Surface.Get();
 				}
 			}
-			else
+			if (reused)
 			{
-				contactSurfaces[rayi] = null;
+				reusedEntries[rayi] = entry;
+				++cachedRayCount;
+				continue;
 			}
 		}
 
-		const float		hitTime = hit.Distance * scaleUEToPk;
+		tracedMasks[rayi] = emptyMasks ? TRayMask(1) : packet.m_RayMasks_Aligned16[rayi];
+		++tracedRayCount;
+	}
 
-		results.m_HitTimes_Aligned16[rayi] = hitTime;
+	if (tracedRayCount != 0)
+	{
+		// Full query for the other rays: masked out rays are skipped by _RayTracePacket
+		PopcornFX::Colliders::SRayPacket	tracedPacket = packet;
+		tracedPacket.m_RayMasks_Aligned16 = decltype(tracedPacket.m_RayMasks_Aligned16)(tracedMasks.Data(), resCount);
+		_RayTracePacket(traceFilter, tracedPacket, results, hitMask.Data());
+	}
 
-		// It seems there are odd instabilities output from Chaos ? Length(rayOrigin + rayDir * rayLength) - hit.Distance is > 0.1f in some cases
-		// 0.1 is 10cm
-#	if 0
-		PK_ONLY_IF_ASSERTS(
-			const CFloat3	hitPos = ToPk(hit.WorldPosition) * scaleUEToPk;
-			const float		computedTime = (hitPos - packet.m_RayOrigins_Aligned16[rayi].xyz()).Length();
-			if (emptySphereSweeps)
-			{
-				// PK_ASSERT(PopcornFX::PKAbs(computedTime - hitTime) < 1.0e-3f);
-			}
-			else
+	{
+		PK_SCOPEDLOCK(m_RaytraceLock);
+		TMap<u64, SRayHitCacheEntry>	&currentCache = m_RayHitCaches[m_RayHitCacheCurrent];
+		for (u32 rayi = 0; rayi < resCount; ++rayi)
+		{
+			if (reusedEntries[rayi] != null)
 			{
-				const float		radius = packet.m_RaySweepRadii_Aligned16[rayi];
-				PK_ASSERT(PopcornFX::PKAbs(computedTime - hitTime - radius) < 1.0e-2f);
+				SRayHitCacheEntry	&entry = currentCache.Add(_RayHitCacheKey(reusedEntries[rayi]->m_Origin, rcpCellSize, filterFlags), *reusedEntries[rayi]);
+				++entry.m_Age;
+				continue;
 			}
-			)
-#	endif
-		CFloat3			normal = ToPk(hit.WorldNormal);
-		results.m_ContactNormals_Aligned16[rayi].xyz() = normal;
-	}
-#endif
-}
+			if (tracedMasks[rayi] == 0)
+				continue;
 
-//----------------------------------------------------------------------------
+			const CFloat4		&rayDirAndLen = packet.m_RayDirectionsAndLengths_Aligned16[rayi];
+			SRayHitCacheEntry	entry;
+			entry.m_Origin = packet.m_RayOrigins_Aligned16[rayi].xyz();
+			entry.m_Direction = rayDirAndLen.xyz();
+			entry.m_Length = rayDirAndLen.w();
+			entry.m_SweepRadius = emptySphereSweeps ? 0.0f : packet.m_RaySweepRadii_Aligned16[rayi];
+			entry.m_Hit = hitMask[rayi] != 0;
+			entry.m_Normal = entry.m_Hit ? results.m_ContactNormals_Aligned16[rayi].xyz() : CFloat3::ZERO;
+			entry.m_PlaneDistance = entry.m_Hit ? _Dot3(entry.m_Normal, entry.m_Origin + entry.m_Direction * results.m_HitTimes_Aligned16[rayi]) : 0.0f;
+			if (entry.m_Hit && contactSurfaces != null)
+				entry.m_Surface = static_cast<UPhysicalMaterial*>(contactSurfaces[rayi]);
+			entry.m_Age = 0;
+			currentCache.Add(_RayHitCacheKey(entry.m_Origin, rcpCellSize, filterFlags), entry);
+		}
+	}
 
-void	CParticleScene::RayTracePacketTemporal(
-	const PopcornFX::Colliders::STraceFilter &traceFilter,
-	const PopcornFX::Colliders::SRayPacket &packet,
-	const PopcornFX::Colliders::STracePacket &results)
-{
-	RayTracePacket(traceFilter, packet, results);
+	INC_DWORD_STAT_BY(STAT_PopcornFX_CachedRayCount, cachedRayCount);
 }
 
 //----------------------------------------------------------------------------
 
-void	CParticleScene::ResolveContactMaterials(const PopcornFX::TMemoryView<void * const>									&contactObjects,
-												const PopcornFX::TMemoryView<void * const>									&contactSurfaces,
-												const PopcornFX::TMemoryView<PopcornFX::Colliders::SSurfaceProperties>		&outSurfaceProperties) const
+namespace
 {
-	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::ResolveContactMaterials", POPCORNFX_UE_PROFILER_COLOR);
-
-	const bool		queryPhysicalMaterial = m_SceneComponent->ResolvedSimulationSettings().bEnablePhysicalMaterials;
-	if (!queryPhysicalMaterial)
-		return; // no need to use kDefaultSurface, everyone returns or no one.
-
-	PK_ASSERT(contactObjects.Count() == contactSurfaces.Count());
-	PK_ASSERT(contactObjects.Count() == outSurfaceProperties.Count());
-
-	static const PopcornFX::Colliders::SSurfaceProperties		kDefaultSurface;
-
-	const u32		materialCount = contactSurfaces.Count();
-	for (u32 iMaterial = 0; iMaterial < materialCount; ++iMaterial)
+	PopcornFX::Colliders::SSurfaceProperties	_ResolveSurfaceProperties(const UPhysicalMaterial *pMat)
 	{
-		PopcornFX::Colliders::SSurfaceProperties	&surface = outSurfaceProperties[iMaterial];
-		surface = kDefaultSurface;
-
-		const UPhysicalMaterial		*pMat = reinterpret_cast<const UPhysicalMaterial*>(contactSurfaces[iMaterial]);
-		if (pMat == null)
-			continue;
+		PopcornFX::Colliders::SSurfaceProperties	surface;
 
 		surface.m_Restitution = pMat->Restitution;
 		surface.m_StaticFriction = pMat->Friction;
@@ -2107,6 +2532,90 @@ void	CParticleScene::ResolveContactMaterials(const PopcornFX::TMemoryView<void *
 		REMAP_COMBINE_MODE(m_RestitutionCombineMode, pMat->RestitutionCombineMode.GetValue());
 
 #undef REMAP_COMBINE_MODE
+
+		return surface;
+	}
+
+	bool	_SameSurfaceProperties(const PopcornFX::Colliders::SSurfaceProperties &a, const PopcornFX::Colliders::SSurfaceProperties &b)
+	{
+		return	a.m_Restitution == b.m_Restitution &&
+				a.m_StaticFriction == b.m_StaticFriction &&
+				a.m_DynamicFriction == b.m_DynamicFriction &&
+				a.m_SurfaceType == b.m_SurfaceType &&
+				a.m_FrictionCombineMode == b.m_FrictionCombineMode &&
+				a.m_RestitutionCombineMode == b.m_RestitutionCombineMode;
+	}
+} // namespace
+
+//----------------------------------------------------------------------------
+
+void	CParticleScene::ResolveContactMaterials(const PopcornFX::TMemoryView<void * const>									&contactObjects,
+												const PopcornFX::TMemoryView<void * const>									&contactSurfaces,
+												const PopcornFX::TMemoryView<PopcornFX::Colliders::SSurfaceProperties>		&outSurfaceProperties) const
+{
+	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::ResolveContactMaterials", POPCORNFX_UE_PROFILER_COLOR);
+
+	const bool		queryPhysicalMaterial = m_SceneComponent->ResolvedSimulationSettings().bEnablePhysicalMaterials;
+	if (!queryPhysicalMaterial)
+		return; // no need to use kDefaultSurface, everyone returns or no one.
+
+	PK_ASSERT(contactObjects.Count() == contactSurfaces.Count());
+	PK_ASSERT(contactObjects.Count() == outSurfaceProperties.Count());
+
+	static const PopcornFX::Colliders::SSurfaceProperties		kDefaultSurface;
+
+	// Contacts are mostly on a handful of materials: lookup the scene cache, consecutive contacts often share the same material
+	TArray<u32, TInlineAllocator<16>>	missingMaterials;
+	const u32		materialCount = contactSurfaces.Count();
+	{
+		FReadScopeLock	readLock(m_SurfacePropertiesCacheLock);
+
+		const UPhysicalMaterial							*lastMat = null;
+		const PopcornFX::Colliders::SSurfaceProperties	*lastSurface = &kDefaultSurface;
+		for (u32 iMaterial = 0; iMaterial < materialCount; ++iMaterial)
+		{
+			const UPhysicalMaterial		*pMat = reinterpret_cast<const UPhysicalMaterial*>(contactSurfaces[iMaterial]);
+			if (pMat != lastMat)
+			{
+				const PopcornFX::Colliders::SSurfaceProperties	*surface = pMat != null ? m_SurfacePropertiesCache.Find(pMat) : null;
+				if (pMat != null && surface == null)
+				{
+					missingMaterials.Add(iMaterial);
+					continue;
+				}
+				lastMat = pMat;
+				lastSurface = surface != null ? surface : &kDefaultSurface;
+			}
+			outSurfaceProperties[iMaterial] = *lastSurface;
+		}
+	}
+
+	if (!missingMaterials.IsEmpty())
+	{
+		FWriteScopeLock	writeLock(m_SurfacePropertiesCacheLock);
+		for (const u32 iMaterial : missingMaterials)
+		{
+			const UPhysicalMaterial						*pMat = reinterpret_cast<const UPhysicalMaterial*>(contactSurfaces[iMaterial]);
+			PopcornFX::Colliders::SSurfaceProperties	*surface = m_SurfacePropertiesCache.Find(pMat);
+			if (surface == null)
+				surface = &m_SurfacePropertiesCache.Add(pMat, _ResolveSurfaceProperties(pMat));
+			outSurfaceProperties[iMaterial] = *surface;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	CParticleScene::_PreUpdate_SurfacePropertiesCache()
+{
+	// Drop materials that were garbage collected or edited since they were cached.
+	// No simulation is running: no need to lock.
+	for (auto iter = m_SurfacePropertiesCache.CreateIterator(); iter; ++iter)
+	{
+		const UPhysicalMaterial		*pMat = iter.Key().Get();
+		if (pMat == null ||
+			!_SameSurfaceProperties(_ResolveSurfaceProperties(pMat), iter.Value()))
+			iter.RemoveCurrent();
 	}
 }
 
@@ -2114,6 +2623,20 @@ void	CParticleScene::ResolveContactMaterials(const PopcornFX::TMemoryView<void *
 
 void	CParticleScene::_PreUpdate_Collisions()
 {
+	_PreUpdate_SurfacePropertiesCache();
+
+	// Last frame's hits become the read-only cache of this frame
+	if (SceneComponent() != null && m_SceneComponent->ResolvedSimulationSettings().bEnableCollisionTemporalCache)
+	{
+		m_RayHitCacheCurrent ^= 1;
+		m_RayHitCaches[m_RayHitCacheCurrent].Reset();
+	}
+	else
+	{
+		m_RayHitCaches[0].Empty();
+		m_RayHitCaches[1].Empty();
+	}
+
 #if PK_WITH_PHYSX
 	m_CurrentPhysxScene = null;
 	if (SceneComponent() != null)
@@ -2910,8 +3433,10 @@ CParticleScene::SPopcornFXPayloadView	CParticleScene::SPopcornFXPayloadView::Inv
 
 //----------------------------------------------------------------------------
 
-CParticleScene::SPopcornFXEventListener::SPopcornFXEventListener(const PopcornFX::CStringId &eventName)
+CParticleScene::SPopcornFXEventListener::SPopcornFXEventListener(const PopcornFX::CStringId &eventName, PopcornFX::CEffectID effectID, UPopcornFXEffect *effect)
 :	m_EventName(eventName)
+,	m_EffectID(effectID)
+,	m_Effect(effect)
 {
 }
 
@@ -2945,9 +3470,12 @@ CParticleScene::SPopcornFXPayloadView::SPopcornFXPayloadView(const PopcornFX::CP
 
 //----------------------------------------------------------------------------
 
-bool	operator==(const CParticleScene::SPopcornFXEventListener &other, const PopcornFX::CStringId &eventName)
+void	CParticleScene::SPopcornFXEventQueue::Clear()
 {
-	return eventName == other.m_EventName;
+	m_PayloadViews.Clear();
+	m_PayloadViewIndices.Reset();
+	m_EffectIDs.Clear();
+	m_Events.Clear();
 }
 
 //----------------------------------------------------------------------------
@@ -2965,9 +3493,11 @@ void	CParticleScene::_Clear_Events()
 
 	UnregisterAllEventListeners();
 
-	m_PayloadViews.Clean();
-	m_PendingEventAssocs.Clear();
-	m_EventListeners.Clear();
+	for (u32 iQueue = 0; iQueue < PK_ARRAY_COUNT(m_EventQueues); ++iQueue)
+		m_EventQueues[iQueue].Clear();
+	m_CurrentPayloadView = &SPopcornFXPayloadView::Invalid;
+	m_EventListeners.Reset();
+	m_EmitterEventNames.Reset();
 	m_RegisteredEvents.Clear();
 }
 
@@ -2976,55 +3506,83 @@ void	CParticleScene::_Clear_Events()
 void	CParticleScene::ClearPendingEvents_NoLock()
 {
 	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::ClearPendingEvents", POPCORNFX_UE_PROFILER_COLOR);
-	const u32	payloadViewsCount = m_PayloadViews.Count();
-	for (u32 iPayloadView = 0; iPayloadView < payloadViewsCount; ++iPayloadView)
+	for (u32 iQueue = 0; iQueue < PK_ARRAY_COUNT(m_EventQueues); ++iQueue)
 	{
-		SPopcornFXPayloadView	&payloadView = m_PayloadViews[iPayloadView];
+		SPopcornFXEventQueue	&queue = m_EventQueues[iQueue];
 
-		if (payloadView.Valid())
+		// Payload views are kept alive (see m_KillTimer) to reuse their allocations, only drop their values
+		const u32	payloadViewsCount = queue.m_PayloadViews.Count();
+		for (u32 iPayloadView = 0; iPayloadView < payloadViewsCount; ++iPayloadView)
 		{
-			payloadView.m_PayloadMedium = null;
-			payloadView.m_Payloads.Clear();
+			SPopcornFXPayloadView	&payloadView = queue.m_PayloadViews[iPayloadView];
+
+			const u32	payloadsCount = payloadView.m_Payloads.Count();
+			for (u32 iPayload = 0; iPayload < payloadsCount; ++iPayload)
+				payloadView.m_Payloads[iPayload].m_Values.Clear();
 			payloadView.m_CurrentParticle = 0;
 		}
+		queue.m_EffectIDs.Clear();
+		queue.m_Events.Clear();
 	}
-	m_PendingEventAssocs.Clear();
+	m_CurrentPayloadView = &SPopcornFXPayloadView::Invalid;
 }
 
 //----------------------------------------------------------------------------
 
 void	CParticleScene::_PostUpdate_Events()
 {
-	INC_DWORD_STAT_BY(STAT_PopcornFX_BroadcastedEventsCount, m_PendingEventAssocs.Count());
-
 	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PostUpdate_Events", POPCORNFX_UE_PROFILER_COLOR);
 
-	const u32	elAssocCount = m_PendingEventAssocs.Count();
-	for (u32 iAssoc = 0; iAssoc < elAssocCount; ++iAssoc)
+	// Update is done: no more BroadcastEvent, queues can be read without locks.
+	// Queues are merged in thread order, events of each queue in the order they were raised.
+	for (u32 iQueue = 0; iQueue < PK_ARRAY_COUNT(m_EventQueues); ++iQueue)
 	{
-		const SPopcornFXEventListenerAssoc				&assoc = m_PendingEventAssocs[iAssoc];
-		const PopcornFX::TArray<PopcornFX::CEffectID>	&effectIDs = assoc.m_EffectIDs;
-		const u32										eventCount = effectIDs.Count();
+		SPopcornFXEventQueue	&queue = m_EventQueues[iQueue];
 
-		m_CurrentPayloadView = &m_PayloadViews[assoc.m_PayloadViewIndex];
-		m_CurrentPayloadView->m_KillTimer = 3.f;
+		INC_DWORD_STAT_BY(STAT_PopcornFX_BroadcastedEventsCount, queue.m_Events.Count());
 
-		PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PostUpdate_Events_TreatEventAssoc", POPCORNFX_UE_PROFILER_COLOR);
-		for (u32 iEvent = 0; iEvent < eventCount; ++iEvent)
+		// Counts are re-read each iteration: delegates can unregister all listeners, which clears pending events
+		for (u32 iEvent = 0; iEvent < queue.m_Events.Count(); ++iEvent)
 		{
-			// execute callbacks that match with effect ID
-			const u32	delegateCount = assoc.m_Event->m_Delegates.Count();
+			PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PostUpdate_Events_TreatEvent", POPCORNFX_UE_PROFILER_COLOR);
+
+			const SPopcornFXPendingEvent	event = queue.m_Events[iEvent];
+
+			m_CurrentPayloadView = &queue.m_PayloadViews[event.m_PayloadViewIndex];
+			m_CurrentPayloadView->m_KillTimer = 3.f;
 
-			PK_ASSERT(delegateCount == assoc.m_Event->m_EffectIDs.Count());
-			for (u32 iDelegate = 0; iDelegate < delegateCount; ++iDelegate)
+			// Consecutive particles usually come from the same emitter: only hash when the effect ID changes,
+			// or when a delegate (un)registered listeners, as 'listener' might be dangling.
+			const SPopcornFXEventListener	*listener = null;
+			PopcornFX::CEffectID			listenerEffectID = 0;
+			u32								listenerSerial = 0;
+			for (u32 iParticle = 0; iParticle < event.m_EffectIDCount && event.m_FirstEffectID + iParticle < queue.m_EffectIDs.Count(); ++iParticle)
 			{
-				PK_NAMEDSCOPEDPROFILE_C("CParticleScene::_PostUpdate_Events_TreatSingleDelegate", POPCORNFX_UE_PROFILER_COLOR);
+				const PopcornFX::CEffectID	effectID = queue.m_EffectIDs[event.m_FirstEffectID + iParticle];
+				if (iParticle == 0 || effectID != listenerEffectID || listenerSerial != m_EventListenersSerial)
+				{
+					listener = m_EventListeners.Find(_EventListenerKey(effectID, event.m_EventName));
+					listenerEffectID = effectID;
+					listenerSerial = m_EventListenersSerial;
+				}
 
-				if (assoc.m_Event->m_EffectIDs[iDelegate] == assoc.m_EffectIDs[iEvent])
-					assoc.m_Event->m_Delegates[iDelegate].ExecuteIfBound();
-			}
+				for (u32 iDelegate = 0; listener != null && iDelegate < listener->m_Delegates.Count(); ++iDelegate)
+				{
+					listener->m_Delegates[iDelegate].ExecuteIfBound();
+					if (m_CurrentPayloadView == &SPopcornFXPayloadView::Invalid)
+						break;
+					if (listenerSerial != m_EventListenersSerial)
+					{
+						listener = m_EventListeners.Find(_EventListenerKey(effectID, event.m_EventName));
+						listenerSerial = m_EventListenersSerial;
+					}
+				}
 
-			++m_CurrentPayloadView->m_CurrentParticle;
+				// Pending events were cleared by a delegate: 'm_CurrentPayloadView' is the shared Invalid view, don't touch it
+				if (m_CurrentPayloadView == &SPopcornFXPayloadView::Invalid)
+					break;
+				++m_CurrentPayloadView->m_CurrentParticle;
+			}
 		}
 	}
 
@@ -3032,17 +3590,33 @@ void	CParticleScene::_PostUpdate_Events()
 
 	const UWorld	*world = m_SceneComponent->GetWorld();
 
-	const u32		payloadViewsCount = m_PayloadViews.Count();
-	for (u32 iPayloadView = 0; iPayloadView < payloadViewsCount; ++iPayloadView)
+	for (u32 iQueue = 0; iQueue < PK_ARRAY_COUNT(m_EventQueues); ++iQueue)
 	{
-		SPopcornFXPayloadView	&payloadView = m_PayloadViews[iPayloadView];
+		SPopcornFXEventQueue	&queue = m_EventQueues[iQueue];
+		bool					removedPayloadViews = false;
 
-		if (payloadView.Valid())
+		for (u32 iPayloadView = 0; iPayloadView < queue.m_PayloadViews.Count(); )
 		{
-			payloadView.m_KillTimer -= world->DeltaTimeSeconds;
+			SPopcornFXPayloadView	&payloadView = queue.m_PayloadViews[iPayloadView];
 
+			payloadView.m_KillTimer -= world->DeltaTimeSeconds;
 			if (payloadView.m_KillTimer <= 0.f)
-				m_PayloadViews.Remove(iPayloadView);
+			{
+				queue.m_PayloadViews.Remove(iPayloadView); // swaps with the last one
+				removedPayloadViews = true;
+			}
+			else
+				++iPayloadView;
+		}
+
+		if (removedPayloadViews)
+		{
+			queue.m_PayloadViewIndices.Reset();
+			for (u32 iPayloadView = 0; iPayloadView < queue.m_PayloadViews.Count(); ++iPayloadView)
+			{
+				const SPopcornFXPayloadView	&payloadView = queue.m_PayloadViews[iPayloadView];
+				queue.m_PayloadViewIndices.Add(MakeTuple(payloadView.m_PayloadMedium, payloadView.m_EventID), iPayloadView);
+			}
 		}
 	}
 }
@@ -3073,83 +3647,89 @@ void	CParticleScene::BroadcastEvent(
 	if (!m_SceneComponent->GetWorld()->IsGameWorld())
 		return;
 
-	const PopcornFX::CGuid	eventListenerIndex = m_EventListeners.IndexOf(eventName);
-	// Is an event listener was registered for this specific event, if not, return
-	if (!eventListenerIndex.Valid())
+	if (effectIDs.Empty())
 		return;
 
-	PK_SCOPEDLOCK(m_RaiseEventLock);
-
-	// search for existing payload view
-	PopcornFX::CGuid		payloadViewIndex = PopcornFX::CGuid::INVALID;
-
-	const u32				payloadViewsCount = m_PayloadViews.Count();
-	for (u32 iPayloadView = 0; iPayloadView < payloadViewsCount; ++iPayloadView)
+	// Each PopcornFX thread owns its queue: no lock needed.
+	// Threads unknown to PopcornFX share the last queue, under m_RaiseEventLock.
+	const PopcornFX::CThreadID	threadID = PopcornFX::CCurrentThread::ThreadID();
+	if (threadID.Valid() && threadID < PopcornFX::CThreadManager::MaxThreadCount)
+		_QueueEvent(m_EventQueues[u32(threadID)], parentMedium, eventID, eventName, effectIDs, payloadView);
+	else
 	{
-		const SPopcornFXPayloadView	&currPayloadView = m_PayloadViews[iPayloadView];
-		if (currPayloadView.Valid() && currPayloadView.m_EventID == eventID && currPayloadView.m_PayloadMedium == parentMedium)
-		{
-			payloadViewIndex = iPayloadView;
-			break;
-		}
+		PK_SCOPEDLOCK(m_RaiseEventLock);
+		_QueueEvent(m_EventQueues[PopcornFX::CThreadManager::MaxThreadCount], parentMedium, eventID, eventName, effectIDs, payloadView);
 	}
+}
+
+//----------------------------------------------------------------------------
 
-	if (!payloadViewIndex.Valid()) // new payload view
+void	CParticleScene::_QueueEvent(
+	SPopcornFXEventQueue										&queue,
+	const PopcornFX::CParticleMedium							*parentMedium,
+	u32															eventID,
+	const PopcornFX::CStringId									&eventName,
+	const PopcornFX::TMemoryView<const PopcornFX::CEffectID>	&effectIDs,
+	const PopcornFX::SPayloadView								&payloadView)
+{
+	// find or create the payload view of this (medium, event)
+	const TPair<const PopcornFX::CParticleMedium*, u32>	payloadViewKey = MakeTuple(parentMedium, eventID);
+	const u32	*existingPayloadViewIndex = queue.m_PayloadViewIndices.Find(payloadViewKey);
+	u32			payloadViewIndex = 0;
+	if (existingPayloadViewIndex != null)
+		payloadViewIndex = *existingPayloadViewIndex;
+	else // new payload view
 	{
-		payloadViewIndex = m_PayloadViews.Insert(SPopcornFXPayloadView(parentMedium, eventID));
-		if (!PK_VERIFY(payloadViewIndex.Valid()))
+		const PopcornFX::CGuid	newPayloadViewIndex = queue.m_PayloadViews.PushBack(SPopcornFXPayloadView(parentMedium, eventID));
+		if (!PK_VERIFY(newPayloadViewIndex.Valid()))
 			return;
+		payloadViewIndex = newPayloadViewIndex;
+		queue.m_PayloadViewIndices.Add(payloadViewKey, payloadViewIndex);
 	}
 
-	RetrievePayloadElements(payloadView, m_PayloadViews[payloadViewIndex]);
+	RetrievePayloadElements(payloadView, queue.m_PayloadViews[payloadViewIndex]);
 
-	// create new event
-	SPopcornFXEventListenerAssoc	newAssoc(&m_EventListeners[eventListenerIndex], effectIDs, payloadViewIndex);
+	// queue the event, effect IDs are copied in the queue's shared array
+	SPopcornFXPendingEvent	newEvent;
+	newEvent.m_EventName = eventName;
+	newEvent.m_PayloadViewIndex = payloadViewIndex;
+	newEvent.m_FirstEffectID = queue.m_EffectIDs.Count();
+	newEvent.m_EffectIDCount = effectIDs.Count();
 
-	if (!PK_VERIFY(m_PendingEventAssocs.PushBack(newAssoc).Valid())) // add event listener to pending array
+	if (!PK_VERIFY(queue.m_EffectIDs.Resize(newEvent.m_FirstEffectID + newEvent.m_EffectIDCount)))
 		return;
+	PopcornFX::Mem::Copy(&queue.m_EffectIDs[newEvent.m_FirstEffectID], effectIDs.Data(), newEvent.m_EffectIDCount * sizeof(PopcornFX::CEffectID));
+
+	if (!PK_VERIFY(queue.m_Events.PushBack(newEvent).Valid()))
+		queue.m_EffectIDs.Resize(newEvent.m_FirstEffectID);
 }
 
 //----------------------------------------------------------------------------
 
-template <typename _OutType>
 void	CParticleScene::FillPayload(const PopcornFX::SPayloadElementView &srcPayloadElementData, SPopcornFXPayload &dstPayload)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::FillPayload", POPCORNFX_UE_PROFILER_COLOR);
 
+	// Values keep their simulation layout (bools included, as u32): a single copy per payload, packed
+	const u32		dim = EPopcornFXPayloadType::Dim(dstPayload.m_PayloadType);
+	const u32		valueSize = dim * sizeof(u32);
 	const u32		valueOffset = dstPayload.m_Values.Count();
 	const u32		particleCount = srcPayloadElementData.m_Data.m_Count;
 	const u32		particleStride = srcPayloadElementData.m_Data.m_Stride;
+	const u8		*srcPtr = srcPayloadElementData.m_Data.m_RawDataPtr;
 
-	if (!PK_VERIFY(dstPayload.m_Values.Resize(valueOffset + particleCount)))
+	if (particleCount == 0 || !PK_VERIFY(particleStride >= valueSize))
 		return;
-
-	for (u32 iParticle = 0; iParticle < particleCount; ++iParticle)
-	{
-		SPopcornFXPayloadValue	&value = dstPayload.m_Values[valueOffset + iParticle];
-
-		FGenericPlatformMemory::Memcpy(value.m_ValueBool, srcPayloadElementData.m_Data.m_RawDataPtr + iParticle * particleStride, sizeof(_OutType));
-	}
-}
-
-//----------------------------------------------------------------------------
-
-void    CParticleScene::FillPayloadBool(const PopcornFX::SPayloadElementView &srcPayloadElementData, SPopcornFXPayload &dstPayload, u32 dim)
-{
-	const u32	valueOffset = dstPayload.m_Values.Count();
-	const u32	particleCount = srcPayloadElementData.m_Data.m_Count;
-	const u32	particleStride = srcPayloadElementData.m_Data.m_Stride;
-
-	if (!PK_VERIFY(dstPayload.m_Values.Resize(valueOffset + particleCount)))
+	if (!PK_VERIFY(dstPayload.m_Values.Resize(valueOffset + particleCount * dim)))
 		return;
 
-	for (u32 iParticle = 0; iParticle < particleCount; ++iParticle)
+	u32		*dstPtr = &dstPayload.m_Values[valueOffset];
+	if (particleStride == valueSize)
+		FGenericPlatformMemory::Memcpy(dstPtr, srcPtr, particleCount * valueSize);
+	else
 	{
-		SPopcornFXPayloadValue	&value = dstPayload.m_Values[valueOffset + iParticle];
-		const u32				*srcPtr = (u32*)&srcPayloadElementData.m_Data.m_RawDataPtr[iParticle * particleStride];
-
-		for (u32 dimIdx = 0; dimIdx < dim; dimIdx++)
-			value.m_ValueBool[dimIdx] = (srcPtr[dimIdx] == 0) ? false : true;
+		for (u32 iParticle = 0; iParticle < particleCount; ++iParticle)
+			FGenericPlatformMemory::Memcpy(dstPtr + iParticle * dim, srcPtr + iParticle * particleStride, valueSize);
 	}
 }
 
@@ -3168,7 +3748,8 @@ void	CParticleScene::RetrievePayloadElements(const PopcornFX::SPayloadView &srcP
 		const PopcornFX::SParticleDeclaration::SEvent::SPayload	&srcPayload = srcPayloadView.m_EventDesc->m_Payload[iPayloadElement];
 
 		// search for existing payload
-		PopcornFX::CGuid					payloadIndex = dstPayloadView.m_Payloads.IndexOf(srcPayload.m_NameGUID);
+		const u32							*existingPayloadIndex = dstPayloadView.m_PayloadIndices.Find(srcPayload.m_NameGUID.Id());
+		PopcornFX::CGuid					payloadIndex = existingPayloadIndex != null ? PopcornFX::CGuid(*existingPayloadIndex) : PopcornFX::CGuid::INVALID;
 
 		const EPopcornFXPayloadType::Type	payloadElementType = EPopcornFXPayloadType::FromPopcornFXBaseTypeID(srcPayload.m_Type);
 
@@ -3177,71 +3758,27 @@ void	CParticleScene::RetrievePayloadElements(const PopcornFX::SPayloadView &srcP
 			payloadIndex = dstPayloadView.m_Payloads.PushBack(SPopcornFXPayload(srcPayload.m_NameGUID, payloadElementType));
 			if (!PK_VERIFY(payloadIndex.Valid()))
 				continue;
+			dstPayloadView.m_PayloadIndices.Add(srcPayload.m_NameGUID.Id(), payloadIndex);
 		}
 
 		// fill payload element data into m_PayloadViews
-		switch (payloadElementType)
-		{
-			case	EPopcornFXPayloadType::Type::Bool:
-				FillPayloadBool(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex], 1);
-				break;
-			case	EPopcornFXPayloadType::Type::Bool2:
-				FillPayloadBool(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex], 2);
-				break;
-			case	EPopcornFXPayloadType::Type::Bool3:
-				FillPayloadBool(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex], 3);
-				break;
-			case	EPopcornFXPayloadType::Type::Bool4:
-				FillPayloadBool(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex], 4);
-				break;
-			case	EPopcornFXPayloadType::Type::Float:
-				FillPayload<float>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Float2:
-				FillPayload<CFloat2>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Float3:
-				FillPayload<CFloat3>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Float4:
-			case	EPopcornFXPayloadType::Type::Quaternion:
-				FillPayload<CFloat4>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Int:
-				FillPayload<u32>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Int2:
-				FillPayload<CInt2>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Int3:
-				FillPayload<CInt3>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			case	EPopcornFXPayloadType::Type::Int4:
-				FillPayload<CInt4>(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
-				break;
-			default:
-				break;
-		}
+		if (payloadElementType != EPopcornFXPayloadType::Invalid)
+			FillPayload(srcPayloadView.m_PayloadElements[iPayloadElement], dstPayloadView.m_Payloads[payloadIndex]);
 	}
 
-	// Check that all SPopcornFXPayload::m_Values.Count() are the same for all SPopcornFXPayload
+	// Check that all SPopcornFXPayload hold the same particle count
 	PK_ONLY_IF_ASSERTS(
-		const u32	payloadViewsCount = m_PayloadViews.Count();
-		for (u32 iPayloadView = 0; iPayloadView < payloadViewsCount; ++iPayloadView)
-		{
-			const PopcornFX::TArray<SPopcornFXPayload>	&payloads = m_PayloadViews[iPayloadView].m_Payloads;
+		const PopcornFX::TArray<SPopcornFXPayload>	&payloads = dstPayloadView.m_Payloads;
 
-			if (payloads.Count() > 0)
-			{
-				const u32	firstPayloadValuesCount = payloads[0].m_Values.Count();
+		if (payloads.Count() > 0)
+		{
+			const u32	firstPayloadValuesCount = payloads[0].m_Values.Count() / EPopcornFXPayloadType::Dim(payloads[0].m_PayloadType);
 
-				const u32	payloadsCount = payloads.Count();
-				for (u32 iPayloadIndex = 1; iPayloadIndex < payloadsCount; ++iPayloadIndex)
-					PK_ASSERT(firstPayloadValuesCount == payloads[iPayloadIndex].m_Values.Count());
-			}
+			const u32	payloadsCount = payloads.Count();
+			for (u32 iPayloadIndex = 1; iPayloadIndex < payloadsCount; ++iPayloadIndex)
+				PK_ASSERT(firstPayloadValuesCount == payloads[iPayloadIndex].m_Values.Count() / EPopcornFXPayloadType::Dim(payloads[iPayloadIndex].m_PayloadType));
 		}
 	);
-}
 
 //----------------------------------------------------------------------------
 
@@ -3257,42 +3794,70 @@ bool	CParticleScene::RegisterEventListener(UPopcornFXEffect* particleEffect, Pop
 	if (!m_SceneComponent->GetWorld()->IsGameWorld())
 		return false;
 
-	const PopcornFX::FastDelegate<PopcornFX::CParticleEffect::EventCallback>	broadcastCallback(this, &CParticleScene::BroadcastEvent);
-
-	const SPopcornFXRegisteredEvent	probe(eventNameID, particleEffect);
-	if (!m_RegisteredEvents.Contains(probe))
+	const u64				listenerKey = _EventListenerKey(effectID, eventNameID);
+	SPopcornFXEventListener	*eventListener = m_EventListeners.Find(listenerKey);
+	if (eventListener == null)
 	{
-		if (!particleEffect->Effect()->RegisterEventCallback(broadcastCallback, eventNameID))
+		// First listener registered by this emitter for this event
+		const PopcornFX::FastDelegate<PopcornFX::CParticleEffect::EventCallback>	broadcastCallback(this, &CParticleScene::BroadcastEvent);
+
+		const SPopcornFXRegisteredEvent	probe(eventNameID, particleEffect);
+		PopcornFX::CGuid				rEventId = m_RegisteredEvents.IndexOf(probe);
+		if (!rEventId.Valid())
 		{
-			UE_LOG(LogPopcornFXScene, Warning, TEXT("Register Event Listener: Couldn't register callback to event '%s' on effect '%s'"), *ToUE(eventNameID.ToString()), *particleEffect->GetName());
-			return false;
+			if (!particleEffect->Effect()->RegisterEventCallback(broadcastCallback, eventNameID))
+			{
+				UE_LOG(LogPopcornFXScene, Warning, TEXT("Register Event Listener: Couldn't register callback to event '%s' on effect '%s'"), *ToUE(eventNameID.ToString()), *particleEffect->GetName());
+				return false;
+			}
+			// add event name ID : don't register a callback several times for the same event
+			rEventId = m_RegisteredEvents.PushBack(probe);
+			if (!PK_VERIFY(rEventId.Valid()))
+			{
+				particleEffect->Effect()->UnregisterEventCallback(broadcastCallback, eventNameID);
+				return false;
+			}
 		}
-		// add event name ID : don't register a callback several times for the same event
-		if (!PK_VERIFY(m_RegisteredEvents.PushBack(probe).Valid()))
+
+		if (!PK_VERIFY(m_EmitterEventNames.FindOrAdd(effectID).PushBack(eventNameID).Valid()))
 			return false;
+		++m_RegisteredEvents[rEventId].m_ListenerCount;
+		eventListener = &m_EventListeners.Add(listenerKey, SPopcornFXEventListener(eventNameID, effectID, particleEffect));
 	}
+	PK_ASSERT(eventListener->m_Effect == particleEffect);
 
-	PopcornFX::CGuid	eventListenerIndex = m_EventListeners.IndexOf(eventNameID);
-	if (!eventListenerIndex.Valid())
+	++m_EventListenersSerial;
+	return PK_VERIFY(eventListener->m_Delegates.PushBack(callback).Valid());
+}
+
+//----------------------------------------------------------------------------
+
+void	CParticleScene::_RemoveEventListener(UPopcornFXEffect* particleEffect, PopcornFX::CEffectID effectID, const PopcornFX::CStringId &eventNameID)
+{
+	if (m_EventListeners.Remove(_EventListenerKey(effectID, eventNameID)) == 0)
+		return;
+	++m_EventListenersSerial;
+
+	PopcornFX::TArray<PopcornFX::CStringId>	*eventNames = m_EmitterEventNames.Find(effectID);
+	if (PK_VERIFY(eventNames != null))
 	{
-		// First listener registered for this event, register it.
-		eventListenerIndex = m_EventListeners.PushBack(eventNameID);
+		const PopcornFX::CGuid	eventNameIndex = eventNames->IndexOf(eventNameID);
+		if (PK_VERIFY(eventNameIndex.Valid()))
+			eventNames->Remove(eventNameIndex);
+		if (eventNames->Empty())
+			m_EmitterEventNames.Remove(effectID);
 	}
 
-	if (PK_VERIFY(eventListenerIndex.Valid()))
+	const PopcornFX::CGuid	rEventId = m_RegisteredEvents.IndexOf(SPopcornFXRegisteredEvent(eventNameID, particleEffect));
+	if (!PK_VERIFY(rEventId.Valid()))
+		return;
+	SPopcornFXRegisteredEvent	&registeredEvent = m_RegisteredEvents[rEventId];
+	PK_ASSERT(registeredEvent.m_ListenerCount > 0);
+	if (--registeredEvent.m_ListenerCount == 0) // No more emitters listening to this event, unregister from the effect for this event slot.
 	{
-		SPopcornFXEventListener	&eventListener = m_EventListeners[eventListenerIndex];
-
-		if (!PK_VERIFY(eventListener.m_Delegates.PushBack(callback).Valid()) ||
-			!PK_VERIFY(eventListener.m_EffectIDs.PushBack(effectID).Valid()) ||
-			!PK_VERIFY(eventListener.m_Effects.PushBack(particleEffect).Valid()))
-			return false;
-
-		PK_ASSERT(eventListener.m_Delegates.Count() == eventListener.m_EffectIDs.Count());
-		PK_ASSERT(eventListener.m_Effects.Count() == eventListener.m_EffectIDs.Count());
-		return true;
+		m_RegisteredEvents.Remove(rEventId);
+		particleEffect->Effect()->UnregisterEventCallback(PopcornFX::FastDelegate<PopcornFX::CParticleEffect::EventCallback>(this, &CParticleScene::BroadcastEvent), eventNameID);
 	}
-	return false;
 }
 
 //----------------------------------------------------------------------------
@@ -3302,39 +3867,18 @@ void	CParticleScene::UnregisterEventListener(UPopcornFXEffect* particleEffect, P
 	PK_SCOPEDPROFILE();
 	PK_ASSERT(IsInGameThread());
 
-	if (m_EventListeners.Empty())
+	SPopcornFXEventListener	*eventListener = m_EventListeners.Find(_EventListenerKey(effectID, eventNameID));
+	if (eventListener == null)
 		return;
 
-	const PopcornFX::CGuid	eventListenerIndex = m_EventListeners.IndexOf(eventNameID);
-	if (eventListenerIndex.Valid())
+	const PopcornFX::CGuid	delegateIndex = eventListener->m_Delegates.IndexOf(callback);
+	if (delegateIndex.Valid())
 	{
-		SPopcornFXEventListener	&eventListener = m_EventListeners[eventListenerIndex];
-		const u32				delegateCount = eventListener.m_Delegates.Count();
-
-		PK_ASSERT(eventListener.m_Delegates.Count() == eventListener.m_EffectIDs.Count());
-		PK_ASSERT(eventListener.m_Effects.Count() == eventListener.m_EffectIDs.Count());
-		for (u32 iDelegate = 0; iDelegate < delegateCount; ++iDelegate)
-		{
-			if (eventListener.m_Delegates[iDelegate] == callback)
-			{
-				PK_ASSERT(effectID == eventListener.m_EffectIDs[iDelegate]); // Should not happen
-				eventListener.m_Delegates.Remove(iDelegate);
-				eventListener.m_EffectIDs.Remove(iDelegate);
-				eventListener.m_Effects.Remove(iDelegate);
-				ClearPendingEvents_NoLock();
-				break;
-			}
-		}
-		if (!eventListener.m_Effects.Contains(particleEffect)) // No more emitters listening to this event, unregister from the effect for this event slot.
-		{
-			const PopcornFX::CGuid	rEventId = m_RegisteredEvents.IndexOf(SPopcornFXRegisteredEvent(eventListener.m_EventName, particleEffect));
-			if (rEventId.Valid())
-			{
-				m_RegisteredEvents.Remove(rEventId);
-				particleEffect->Effect()->UnregisterEventCallback(PopcornFX::FastDelegate<PopcornFX::CParticleEffect::EventCallback>(this, &CParticleScene::BroadcastEvent), eventNameID);
-			}
-		}
+		eventListener->m_Delegates.Remove_AndKeepOrder(delegateIndex);
+		++m_EventListenersSerial;
 	}
+	if (eventListener->m_Delegates.Empty())
+		_RemoveEventListener(particleEffect, effectID, eventNameID);
 }
 
 //----------------------------------------------------------------------------
@@ -3344,35 +3888,15 @@ void	CParticleScene::UnregisterAllEventListeners(UPopcornFXEffect* particleEffec
 	PK_SCOPEDPROFILE();
 	PK_ASSERT(IsInGameThread());
 
-	if (m_EventListeners.Empty())
+	const PopcornFX::TArray<PopcornFX::CStringId>	*eventNames = m_EmitterEventNames.Find(effectID);
+	if (eventNames == null)
 		return;
 
-	const PopcornFX::FastDelegate<PopcornFX::CParticleEffect::EventCallback>	broadcastCallback(this, &CParticleScene::BroadcastEvent);
-
-	for (u32 iEventListener = 0; iEventListener < m_EventListeners.Count(); ++iEventListener)
-	{
-		SPopcornFXEventListener	&eventListener = m_EventListeners[iEventListener];
-
-		PK_ASSERT(eventListener.m_Delegates.Count() == eventListener.m_EffectIDs.Count());
-		PK_ASSERT(eventListener.m_Effects.Count() == eventListener.m_EffectIDs.Count());
-		const PopcornFX::CGuid	eventId = eventListener.m_EffectIDs.IndexOf(effectID);
-		if (eventId.Valid())
-		{
-			eventListener.m_Delegates.Remove(eventId);
-			eventListener.m_EffectIDs.Remove(eventId);
-			eventListener.m_Effects.Remove(eventId);
-		}
-		if (!eventListener.m_Effects.Contains(particleEffect)) // No more emitters listening to this event, unregister from the effect for this event slot.
-		{
-			const PopcornFX::CGuid	rEventId = m_RegisteredEvents.IndexOf(SPopcornFXRegisteredEvent(eventListener.m_EventName, particleEffect));
-			if (rEventId.Valid())
-			{
-				m_RegisteredEvents.Remove(rEventId);
-				particleEffect->Effect()->UnregisterEventCallback(broadcastCallback, eventListener.m_EventName);
-			}
-		}
-	}
-	ClearPendingEvents_NoLock();
+	// _RemoveEventListener() modifies m_EmitterEventNames
+	const PopcornFX::TArray<PopcornFX::CStringId>	eventNamesCopy = *eventNames;
+	const u32										eventNamesCount = eventNamesCopy.Count();
+	for (u32 iEventName = 0; iEventName < eventNamesCount; ++iEventName)
+		_RemoveEventListener(particleEffect, effectID, eventNamesCopy[iEventName]);
 }
 
 //----------------------------------------------------------------------------
@@ -3394,61 +3918,80 @@ void	CParticleScene::UnregisterAllEventListeners()
 		event.m_Effect->Effect()->UnregisterEventCallback(broadcastCallback, event.m_EventName);
 	}
 	m_RegisteredEvents.Clear();
-	m_EventListeners.Clear();
+	m_EventListeners.Reset();
+	m_EmitterEventNames.Reset();
+	++m_EventListenersSerial;
 	ClearPendingEvents_NoLock();
 }
 
 //----------------------------------------------------------------------------
 
-namespace	EPopcornFXPayloadType
-{
-	inline u32	Dimension(Type type) { return (u32(type) % 4) + 1; }
-}
-
-//----------------------------------------------------------------------------
-
-bool	CParticleScene::GetPayloadValue(const FString &payloadName, EPopcornFXPayloadType::Type expectedPayloadType, void *outValue) const
+bool	CParticleScene::GetPayloadView(const FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedPayloadType, FPopcornFXPayloadView &outView) const
 {
 	PK_ASSERT(IsInGameThread());
-	PK_ASSERT(!payloadName.IsEmpty());
-	PK_ASSERT(outValue != null);
+	PK_ASSERT(payloadHandle.Valid());
 
-	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::GetPayloadValue", POPCORNFX_UE_PROFILER_COLOR);
+	PK_NAMEDSCOPEDPROFILE_C("CParticleScene::GetPayloadView", POPCORNFX_UE_PROFILER_COLOR);
 
+	outView = FPopcornFXPayloadView();
 	if (!m_CurrentPayloadView->Valid())
 	{
 		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: Payload's data not setup. Are you trying to call this function in a BeginPlay?"));
 		return false;
 	}
 
-	const PopcornFX::CStringId		payloadNameID(ToPk(payloadName)); // Expensive
-	const PopcornFX::CGuid			payloadIndex = m_CurrentPayloadView->m_Payloads.IndexOf(payloadNameID);
-
-	if (!payloadIndex.Valid())
+	const u32	*payloadIndex = m_CurrentPayloadView->m_PayloadIndices.Find(payloadHandle.PayloadNameId);
+	if (payloadIndex == null)
 	{
-		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: Cannot retrieve event payload '%s', no event payload registered."), *payloadName);
+		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: Cannot retrieve event payload '%s', no event payload registered."), *payloadHandle.PayloadName);
 		return false;
 	}
 
-	const SPopcornFXPayload		&payload = m_CurrentPayloadView->m_Payloads[payloadIndex];
+	const SPopcornFXPayload		&payload = m_CurrentPayloadView->m_Payloads[*payloadIndex];
 
 	if (payload.m_PayloadType != expectedPayloadType)
 	{
-		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: mismatching types for event payload '%s'"), *payloadName);
+		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: mismatching types for event payload '%s'"), *payloadHandle.PayloadName);
 		return false;
 	}
 
-	if (!PK_VERIFY(m_CurrentPayloadView->m_CurrentParticle < payload.m_Values.Count()))
+	const u32	dim = EPopcornFXPayloadType::Dim(payload.m_PayloadType);
+	const u32	valueCount = payload.m_Values.Count() / dim;
+	if (!PK_VERIFY(m_CurrentPayloadView->m_CurrentParticle < valueCount))
 	{
-		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: Couldn't find event payload '%s' (payload doesn't exist)"), *payloadName);
+		UE_LOG(LogPopcornFXScene, Warning, TEXT("Get Payload Value: Couldn't find event payload '%s' (payload doesn't exist)"), *payloadHandle.PayloadName);
 		return false;
 	}
 
-	const SPopcornFXPayloadValue	&value = payload.m_Values[m_CurrentPayloadView->m_CurrentParticle];
+	outView.Type = payload.m_PayloadType;
+	outView.Data = reinterpret_cast<const uint8*>(payload.m_Values.RawDataPointer());
+	outView.Stride = dim * sizeof(u32);
+	outView.Count = valueCount;
+	outView.CurrentIndex = m_CurrentPayloadView->m_CurrentParticle;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+bool	CParticleScene::GetPayloadValue(const FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedPayloadType, void *outValue) const
+{
+	PK_ASSERT(outValue != null);
 
-	const uint32					payloadValueDim = EPopcornFXPayloadType::Dimension(expectedPayloadType);
+	FPopcornFXPayloadView	view;
+	if (!GetPayloadView(payloadHandle, expectedPayloadType, view))
+		return false;
 
-	FGenericPlatformMemory::Memcpy(outValue, value.m_ValueBool, sizeof(int32) * payloadValueDim);
+	const u32	*value = &view.Current<u32>();
+	const u32	dim = EPopcornFXPayloadType::Dim(expectedPayloadType);
+	if (expectedPayloadType <= EPopcornFXPayloadType::Bool4)
+	{
+		// Stored as u32 components, output as bools
+		bool	*outBool = static_cast<bool*>(outValue);
+		for (u32 iDim = 0; iDim < dim; ++iDim)
+			outBool[iDim] = value[iDim] != 0;
+	}
+	else
+		FGenericPlatformMemory::Memcpy(outValue, value, sizeof(u32) * dim);
 	return true;
 }
 
@@ -18,6 +18,7 @@
 #include "PrimitiveSceneProxy.h"
 #include "Engine/EngineTypes.h"
 #include "Math/BoxSphereBounds.h"
+#include "ConvexVolume.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 #include "Assets/PopcornFXEffect.h"
 #include "PopcornFXEmitterComponent.h" // TWeakObjectPtr
@@ -32,9 +33,11 @@
 #include <pk_kernel/include/kr_timers.h>
 
 class	UPopcornFXSceneComponent;
+class	UPhysicalMaterial;
 class	FPopcornFXSceneProxy;
 class	FDeferredDecalProxy;
 struct	FDeferredDecalUpdateParams;
+struct	FSceneViewProjectionData;
 class	CBatchDrawer_Decal_CPUBB;
 
 #	define PK_WITH_PHYSX	0
@@ -72,6 +75,38 @@ PK_FORWARD_DECLARE(RenderBatchManager);
 // Statement to help the UE Header Parser not crash on FWD_PK_API_...
 class	FPopcornFXPlugin;
 
+//----------------------------------------------------------------------------
+
+// Structure of arrays holding the per-emitter state updated each frame by CParticleScene::_PreUpdate_Emitters.
+// Filled on the game thread (UObject reads), processed in parallel chunks, then written back on the game thread.
+struct	SPopcornFXEmitterUpdateBatch
+{
+	enum	EFlags
+	{
+		Flag_Teleport	= (1U << 0),
+		Flag_Visible	= (1U << 1),
+	};
+
+	PopcornFX::TArray<UPopcornFXEmitterComponent*>			m_Emitters;
+	PopcornFX::TArray<PopcornFX::CParticleEffectInstance*>	m_EffectInstances;
+	::TArray<FTransform>									m_ComponentTransforms;
+	PopcornFX::TArray<PopcornFX::CFloat4x4>					m_CurrentTransforms;
+	PopcornFX::TArray<PopcornFX::CFloat4x4>					m_PreviousTransforms;
+	PopcornFX::TArray<PopcornFX::CFloat3>					m_PreviousPositions; // 2 frames of lag
+	PopcornFX::TArray<PopcornFX::CFloat3>					m_CurrentVelocities;
+	PopcornFX::TArray<PopcornFX::CFloat3>					m_PreviousVelocities;
+	PopcornFX::TArray<float>								m_TimeScales;
+	PopcornFX::TArray<u8>									m_Flags;
+
+	u32		Count() const { return m_Emitters.Count(); }
+	bool	Reserve(u32 count);
+	s32		Add(UPopcornFXEmitterComponent *emitter); // returns -1 on allocation failure
+	void	Clear();
+	void	Clean();
+
+	void	UpdateTransforms(u32 first, u32 end, float dt);
+};
+
 class	CParticleScene : public PopcornFX::IParticleScene
 {
 public:
@@ -221,7 +256,8 @@ public:
 	struct SEmitterRegister
 	{
 		TWeakObjectPtr<class UPopcornFXEmitterComponent>	m_Emitter;
-		SEmitterRegister(class UPopcornFXEmitterComponent *emitter) : m_Emitter(emitter) { PK_ASSERT(Valid()); }
+		const PopcornFX::CParticleEffect					*m_ParentEffect = null; // Key in m_EffectInstanceCounts, compare value only
+		SEmitterRegister(class UPopcornFXEmitterComponent *emitter, const PopcornFX::CParticleEffect *parentEffect = null) : m_Emitter(emitter), m_ParentEffect(parentEffect) { PK_ASSERT(Valid()); }
 		SEmitterRegister() : m_Emitter(null) { }
 		PK_FORCEINLINE bool						operator == (class UPopcornFXEmitterComponent *other) const { return m_Emitter == other; }
 		PK_FORCEINLINE bool						Valid() const { return m_Emitter.IsValid(); }
@@ -234,16 +270,22 @@ public:
 	bool				Emitter_Register(class UPopcornFXEmitterComponent *emitter);
 	bool				Emitter_Unregister(class UPopcornFXEmitterComponent *emitter);
 
+	// Number of registered emitters currently running an instance of that effect, O(1)
+	u32					EffectInstanceCount(const UPopcornFXEffect *effect);
+
 	bool				Effect_Install(PopcornFX::PCParticleEffect &effect);
 
 private:
 	void				_PreUpdate_Emitters(float dt);
 	void				_PostUpdate_Emitters(float dt);
 	void				_Clear_Emitters();
+	void				_DecrementEffectInstanceCount(const PopcornFX::CParticleEffect *parentEffect);
 
 	PopcornFX::TChunkedSlotArray<SEmitterRegister>	m_PreInitEmitters;
 	PopcornFX::Threads::CCriticalSection			m_EmittersLock;
 	PopcornFX::TChunkedSlotArray<SEmitterRegister>	m_Emitters;
+	SPopcornFXEmitterUpdateBatch					m_EmitterUpdateBatch;
+	TMap<const PopcornFX::CParticleEffect*, u32>	m_EffectInstanceCounts; // Maintained by Emitter_Register/Emitter_Unregister
 
 	//----------------------------------------------------------------------------
 	//
@@ -251,19 +293,44 @@ private:
 	//
 	//----------------------------------------------------------------------------
 public:
-	u32											&ActiveDecalCounter(CBatchDrawer_Decal_CPUBB *mat)	{ return m_ActiveDecals.FindOrAdd(mat).Key; }
-	TArray<FDeferredDecalProxy*>				&ActiveDecalProxies(CBatchDrawer_Decal_CPUBB *mat)	{ return m_ActiveDecals.FindOrAdd(mat).Value; }
-	TPair<u32, TArray<FDeferredDecalProxy*>>	&ActiveDecals(CBatchDrawer_Decal_CPUBB * mat)		{ return m_ActiveDecals.FindOrAdd(mat); }
-	TArray<FDeferredDecalUpdateParams>			&DecalUpdates()										{ return m_DecalUpdates; }
+	// Decal that passed the decal drawers culling, proxies are assigned in _PostUpdate_Decals once the scene budget is applied
+	struct	SDecalCandidate
+	{
+		CBatchDrawer_Decal_CPUBB	*m_Drawer;
+		float						m_Importance;
+		FTransform					m_Transform;
+		FBoxSphereBounds			m_Bounds;
+		FLinearColor				m_Color;
+	};
+
+	TArray<SDecalCandidate>			&DecalCandidates() { return m_DecalCandidates; }
+
+	// Views registered by _PreUpdate_Views (UE units), used by update pass renderers
+	const TArray<FConvexVolume>		&UpdateViewFrustums() const { return m_UpdateViewFrustums; }
+	const TArray<FVector>			&UpdateViewOrigins() const { return m_UpdateViewOrigins; }
 
 	void	ClearDecals(CBatchDrawer_Decal_CPUBB *mat, bool removeEntry = true);
 
 private:
+	// Decal proxies of a decal drawer, recycled across frames.
+	// Unused proxies are hidden rather than deleted, and are only released after staying unused for a while.
+	struct	SDecalProxyPool
+	{
+		TArray<FDeferredDecalProxy*>	m_Proxies;
+		u32								m_UsedCount = 0;	// [0, m_UsedCount[ are rendered this frame
+		u32								m_HiddenBegin = 0;	// [m_HiddenBegin, m_Proxies.Num()[ are already hidden
+		u32								m_IdleFrames = 0;	// Consecutive frames with unused proxies
+	};
+
+	void	_AddUpdateView(const FSceneViewProjectionData &projectionData);
 	void	_PostUpdate_Decals();
 	void	_Clear_Decals();
 
-	TMap<CBatchDrawer_Decal_CPUBB*, TPair<u32, TArray<FDeferredDecalProxy*>>>	m_ActiveDecals;
-	TArray<FDeferredDecalUpdateParams>											m_DecalUpdates;
+	TMap<CBatchDrawer_Decal_CPUBB*, SDecalProxyPool>	m_DecalProxyPools;
+	TArray<SDecalCandidate>								m_DecalCandidates;
+	TArray<FDeferredDecalUpdateParams>					m_DecalUpdates;
+	TArray<FConvexVolume>								m_UpdateViewFrustums;
+	TArray<FVector>										m_UpdateViewOrigins;
 
 	//----------------------------------------------------------------------------
 	//
@@ -285,8 +352,39 @@ private:
 													const PopcornFX::TMemoryView<void * const>									&contactSurfaces,
 													const PopcornFX::TMemoryView<PopcornFX::Colliders::SSurfaceProperties>		&outSurfaceProperties) const override;
 
+	// RayTracePacket, also flagging rays that hit something in outHitMask (can be null)
+	void					_RayTracePacket(
+		const PopcornFX::Colliders::STraceFilter &traceFilter,
+		const PopcornFX::Colliders::SRayPacket &packet,
+		const PopcornFX::Colliders::STracePacket &results,
+		u8 *outHitMask);
+
 	PopcornFX::Threads::CCriticalSection		m_RaytraceLock;
 
+	// Temporal ray hit cache used by RayTracePacketTemporal, PopcornFX units.
+	// Rays are keyed by their quantized origin: settled particles keep hitting the same entry.
+	struct	SRayHitCacheEntry
+	{
+		CFloat3		m_Origin;			// Ray of the last full query
+		CFloat3		m_Direction;
+		float		m_Length;
+		float		m_SweepRadius;
+		CFloat3		m_Normal;			// Contact plane, passing through the ray origin (sphere center for sweeps) at contact
+		float		m_PlaneDistance;
+		TWeakObjectPtr<UPhysicalMaterial>	m_Surface;	// Not kept alive: stale entries are re-traced
+		u32			m_Age;				// Frames since the last full query
+		bool		m_Hit;
+	};
+
+	TMap<u64, SRayHitCacheEntry>	m_RayHitCaches[2];
+	u32								m_RayHitCacheCurrent = 0; // Filled this frame (under m_RaytraceLock), the other one is read
+
+	// UPhysicalMaterial -> SSurfaceProperties, filled by ResolveContactMaterials.
+	// Weak keys: a material reallocated at the address of a collected one does not match its entry.
+	mutable TMap<TWeakObjectPtr<const UPhysicalMaterial>, PopcornFX::Colliders::SSurfaceProperties>	m_SurfacePropertiesCache;
+	mutable FRWLock																					m_SurfacePropertiesCacheLock;
+
+	void					_PreUpdate_SurfacePropertiesCache();
 	void					_PreUpdate_Collisions();
 #if PK_WITH_PHYSX
 	physx::PxScene		*m_CurrentPhysxScene = null;
@@ -398,39 +496,24 @@ public:
 	//
 	//----------------------------------------------------------------------------
 public:
+	// All delegates bound to an event by one emitter, see m_EventListeners
 	struct	SPopcornFXEventListener
 	{
 		typedef class FPopcornFXRaiseEventSignature	RaiseEventDelegate;
 
 		PopcornFX::CStringId					m_EventName;
+		PopcornFX::CEffectID					m_EffectID;
+		UPopcornFXEffect						*m_Effect = null; // (!do not deref!)
 		PopcornFX::TArray<RaiseEventDelegate>	m_Delegates; // List of unique delegates
-		PopcornFX::TArray<PopcornFX::CEffectID>	m_EffectIDs; // Can contain same effect ids, but bound to different delegates
-		PopcornFX::TArray<UPopcornFXEffect*>	m_Effects; // List of effects associated to each effect id (!do not deref!)
 
-		SPopcornFXEventListener(const PopcornFX::CStringId &eventName);
-	};
-
-	struct	SPopcornFXEventListenerAssoc
-	{
-		SPopcornFXEventListener					*m_Event;
-		PopcornFX::TArray<PopcornFX::CEffectID>	m_EffectIDs;
-		PopcornFX::CGuid						m_PayloadViewIndex;
-
-		SPopcornFXEventListenerAssoc(SPopcornFXEventListener *eventListener)
-		:	m_Event(eventListener)
-		,	m_EffectIDs()
-		,	m_PayloadViewIndex(PopcornFX::CGuid::INVALID) { }
-
-		SPopcornFXEventListenerAssoc(SPopcornFXEventListener *eventListener, const PopcornFX::TArray<PopcornFX::CEffectID> &effectIDs, const PopcornFX::CGuid &payloadViewIndex)
-		:	m_Event(eventListener)
-		,	m_EffectIDs(effectIDs)
-		,	m_PayloadViewIndex(payloadViewIndex) { }
+		SPopcornFXEventListener(const PopcornFX::CStringId &eventName, PopcornFX::CEffectID effectID, UPopcornFXEffect *effect);
 	};
 
 	struct	SPopcornFXRegisteredEvent
 	{
 		PopcornFX::CStringId	m_EventName;
 		UPopcornFXEffect		*m_Effect = null;
+		u32						m_ListenerCount = 0; // Emitters of m_Effect listening to m_EventName
 
 		SPopcornFXRegisteredEvent(PopcornFX::CStringId eventName, UPopcornFXEffect *effect)
 		:	m_EventName(eventName)
@@ -445,22 +528,12 @@ public:
 		}
 	};
 
-	struct	SPopcornFXPayloadValue
-	{
-		union
-		{
-			bool	m_ValueBool[4];
-			uint32	m_ValueInt[4];
-			float	m_ValueFloat[4];
-		};
-	};
-
 	struct	SPopcornFXPayload
 	{
 		PopcornFX::CStringId						m_PayloadName;
 		EPopcornFXPayloadType::Type					m_PayloadType;
 
-		PopcornFX::TArray<SPopcornFXPayloadValue>	m_Values;
+		PopcornFX::TArray<u32>						m_Values; // Packed, EPopcornFXPayloadType::Dim(m_PayloadType) components per particle
 
 		SPopcornFXPayload(const PopcornFX::CStringId &payloadName, const EPopcornFXPayloadType::Type payloadType);
 	};
@@ -471,6 +544,7 @@ public:
 		u32										m_EventID;
 
 		PopcornFX::TArray<SPopcornFXPayload>	m_Payloads;
+		TMap<u32, u32>							m_PayloadIndices; // Payload name ID -> m_Payloads index
 
 		u32										m_CurrentParticle;
 		float									m_KillTimer;
@@ -479,7 +553,27 @@ public:
 		SPopcornFXPayloadView(const PopcornFX::CParticleMedium *medium, u32 eventID);
 
 		PK_FORCEINLINE bool						Valid() const { return m_PayloadMedium != null; }
-		static SPopcornFXPayloadView			Invalid; // needed by TChunkedSlotArray
+		static SPopcornFXPayloadView			Invalid; // Current payload view outside of _PostUpdate_Events
+	};
+
+	// Event raised by BroadcastEvent, dispatched in _PostUpdate_Events
+	struct	SPopcornFXPendingEvent
+	{
+		PopcornFX::CStringId					m_EventName;
+		u32										m_PayloadViewIndex;
+		u32										m_FirstEffectID; // Index in SPopcornFXEventQueue::m_EffectIDs
+		u32										m_EffectIDCount; // One per particle
+	};
+
+	// Events raised by a single thread during the update, merged in _PostUpdate_Events
+	struct	SPopcornFXEventQueue
+	{
+		PopcornFX::TArray<SPopcornFXPayloadView>			m_PayloadViews;
+		TMap<TPair<const PopcornFX::CParticleMedium*, u32>, u32>	m_PayloadViewIndices; // (medium, eventID) -> m_PayloadViews index
+		PopcornFX::TArray<PopcornFX::CEffectID>			m_EffectIDs;
+		PopcornFX::TArray<SPopcornFXPendingEvent>		m_Events;
+
+		void	Clear();
 	};
 
 	bool	RegisterEventListener(
@@ -501,10 +595,15 @@ public:
 	void	UnregisterAllEventListeners();
 
 	bool	GetPayloadValue(
-		const FString &payloadName,
+		const struct FPopcornFXPayloadHandle &payloadHandle,
 		EPopcornFXPayloadType::Type expectedPayloadType,
 		void *outValue) const;
 
+	bool	GetPayloadView(
+		const struct FPopcornFXPayloadHandle &payloadHandle,
+		EPopcornFXPayloadType::Type expectedPayloadType,
+		FPopcornFXPayloadView &outView) const;
+
 public:
 	void	BroadcastEvent(
 		PopcornFX::Threads::SThreadContext							*threadCtx,
@@ -522,18 +621,31 @@ private:
 	void	_Clear_Events();
 	void	_PostUpdate_Events();
 
+	static u64	_EventListenerKey(PopcornFX::CEffectID effectID, const PopcornFX::CStringId &eventName) { return (u64(effectID) << 32) | u64(eventName.Id()); }
+	void		_QueueEvent(
+		SPopcornFXEventQueue										&queue,
+		const PopcornFX::CParticleMedium							*parentMedium,
+		u32															eventID,
+		const PopcornFX::CStringId									&eventName,
+		const PopcornFX::TMemoryView<const PopcornFX::CEffectID>	&effectIDs,
+		const PopcornFX::SPayloadView								&payloadView);
+	void		_RemoveEventListener(UPopcornFXEffect *particleEffect, PopcornFX::CEffectID effectID, const PopcornFX::CStringId &eventNameID);
+
 private:
-	template <typename _OutType>
 	void	FillPayload(const PopcornFX::SPayloadElementView &srcPayloadElementData, SPopcornFXPayload &dstPayload);
-	void	FillPayloadBool(const PopcornFX::SPayloadElementView &srcPayloadElementData, SPopcornFXPayload &dstPayload, u32 dim);
 
 	void	RetrievePayloadElements(const PopcornFX::SPayloadView &srcPayloadView, SPopcornFXPayloadView &dstPayloadView);
 
 private:
-	SPopcornFXPayloadView									*m_CurrentPayloadView;
-	PopcornFX::Threads::CCriticalSection					m_RaiseEventLock;
-	PopcornFX::TArray<SPopcornFXEventListener>				m_EventListeners;
-	PopcornFX::TChunkedSlotArray<SPopcornFXPayloadView>		m_PayloadViews;
-	PopcornFX::TArray<SPopcornFXEventListenerAssoc>			m_PendingEventAssocs;
+	SPopcornFXPayloadView									*m_CurrentPayloadView = &SPopcornFXPayloadView::Invalid;
+	PopcornFX::Threads::CCriticalSection					m_RaiseEventLock; // Only guards the last queue of m_EventQueues
+
+	// One queue per PopcornFX thread ID, written without locks by BroadcastEvent.
+	// The last one receives events raised by threads not registered to PopcornFX.
+	SPopcornFXEventQueue									m_EventQueues[PopcornFX::CThreadManager::MaxThreadCount + 1];
+
+	TMap<u64, SPopcornFXEventListener>						m_EventListeners; // _EventListenerKey(effectID, eventName) -> listener
+	TMap<PopcornFX::CEffectID, PopcornFX::TArray<PopcornFX::CStringId> >	m_EmitterEventNames; // Events listened by each emitter
+	u32														m_EventListenersSerial = 0; // Bumped on each (un)registration, to detect changes made by delegates
 	PopcornFX::TArray<SPopcornFXRegisteredEvent>			m_RegisteredEvents;
 };
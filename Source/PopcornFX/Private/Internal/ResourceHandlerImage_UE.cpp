@@ -6,16 +6,21 @@
 #include "ResourceHandlerImage_UE.h"
 
 #include "PopcornFXPlugin.h"
+#include "PopcornFXSettings.h"
 #include "GPUSim/PopcornFXGPUSim.h"
 #include "Platforms/PopcornFXPlatform.h"
+#include "Internal/ImageDecompression.h"
 
 #include "Engine/Texture.h"
+#include "Async/Async.h"
 
 #include "PopcornFXSDK.h"
 #include <pk_kernel/include/kr_refcounted_buffer.h>
 
 #if	WITH_EDITOR
 #	include "Misc/MessageDialog.h"
+#	include "TextureResource.h"
+#	include "TargetPlatform.h"
 #endif // WITH_EDITOR
 
 //----------------------------------------------------------------------------
@@ -130,7 +135,17 @@ const char*	 _My_GetPixelFormatStringANSI(EPixelFormat InPixelFormat)
 	}
 }
 
-PopcornFX::CImage::EFormat	_UE2PKImageFormat(const EPixelFormat pixelFormat, bool srgb)
+namespace
+{
+	const TCHAR	*kMipPathSuffix = TEXT("?mip=");
+
+	// Prefetched images kept while no one loaded them
+	const int32	kMaxUnclaimedImages = 32;
+}
+
+//----------------------------------------------------------------------------
+
+static PopcornFX::CImage::EFormat	_TryUE2PKImageFormat(const EPixelFormat pixelFormat, bool srgb)
 {
 #define		UE2PK_IMAGE(__ue, __pk) case __ue: return PopcornFX::CImage:: __pk
 #define		UE2PK_IMAGE_SRGB(__ue, __pk) case __ue: return (srgb ? (PopcornFX::CImage:: __pk ## _sRGB) : (PopcornFX::CImage:: __pk))
@@ -196,26 +211,122 @@ PopcornFX::CImage::EFormat	_UE2PKImageFormat(const EPixelFormat pixelFormat, boo
 		default:
 			break;
 	}
-	PK_ASSERT_NOT_REACHED_MESSAGE("UE EPixelFormat '%s' not recognized by PopcornFX", _My_GetPixelFormatStringANSI(pixelFormat));
 #undef UE2PK_IMAGE
+#undef UE2PK_IMAGE_SRGB
 	return PopcornFX::CImage::Format_Invalid;
 }
 
+PopcornFX::CImage::EFormat	_UE2PKImageFormat(const EPixelFormat pixelFormat, bool srgb)
+{
+	const PopcornFX::CImage::EFormat	format = _TryUE2PKImageFormat(pixelFormat, srgb);
+	if (format == PopcornFX::CImage::Format_Invalid)
+		PK_ASSERT_NOT_REACHED_MESSAGE("UE EPixelFormat '%s' not recognized by PopcornFX", _My_GetPixelFormatStringANSI(pixelFormat));
+	return format;
+}
+
+//----------------------------------------------------------------------------
+
+#if	WITH_EDITOR
+static bool	_IsCPUReadablePixelFormat(const EPixelFormat pixelFormat)
+{
+	return	PopcornFXImage_DecompressedFormat(pixelFormat) != PopcornFX::CImage::Format_Invalid ||
+			_TryUE2PKImageFormat(pixelFormat, false) != PopcornFX::CImage::Format_Invalid;
+}
+
+// Texture format names (see ITargetPlatform::GetTextureFormats) that build to a CPU readable pixel format.
+// Anything else (ASTC, PVRTC, BC6H, platform specific formats, ..) is considered unreadable.
+static bool	_IsCPUReadableTextureFormatName(const FName formatName)
+{
+	static const TCHAR	*kReadableFormats[] =
+	{
+		TEXT("DXT1"), TEXT("DXT3"), TEXT("DXT5"), TEXT("DXT5n"), TEXT("AutoDXT"),
+		TEXT("BC4"), TEXT("BC5"), TEXT("BC7"),
+		TEXT("ETC2_RGB"), TEXT("ETC2_RGBA"), TEXT("AutoETC2"),
+		TEXT("BGRA8"), TEXT("G8"), TEXT("R16F"), TEXT("R32F"), TEXT("RGBA16F"), TEXT("RGBA32F"),
+	};
+
+	// Formats can be prefixed by the compressor or platform (ie. "OODLE_DXT1")
+	const FString	name = formatName.ToString();
+	for (const TCHAR *readableFormat : kReadableFormats)
+	{
+		if (name.Equals(readableFormat) || name.EndsWith(FString(TEXT("_")) + readableFormat))
+			return true;
+	}
+	return false;
+}
+
+// Can PopcornFXPlatform_NewImageFromTexture read the texture as it is currently built,
+// and as it will be cooked for every target platform
+static bool	_IsCPUReadableTexture(UTexture *texture)
+{
+	FTexturePlatformData	**platformDataPP = texture->GetRunningPlatformData();
+	if (platformDataPP == null || *platformDataPP == null)
+		return false;
+	if (!_IsCPUReadablePixelFormat((*platformDataPP)->PixelFormat))
+		return false;
+
+	// The running platform's format says nothing about cooked ones: a texture compressed as BC on PC can be ASTC on mobile
+	ITargetPlatformManagerModule	*targetPlatformManager = GetTargetPlatformManager();
+	if (targetPlatformManager == null)
+		return false;
+	for (const ITargetPlatform *targetPlatform : targetPlatformManager->GetTargetPlatforms())
+	{
+		if (targetPlatform == null || targetPlatform->IsServerOnly())
+			continue; // No rendering data cooked
+		TArray<TArray<FName>>	layerFormats;
+		targetPlatform->GetTextureFormats(texture, layerFormats);
+		for (const TArray<FName> &formats : layerFormats)
+		{
+			for (const FName format : formats)
+			{
+				if (!_IsCPUReadableTextureFormatName(format))
+					return false;
+			}
+		}
+	}
+	return true;
+}
+#endif // WITH_EDITOR
+
+//----------------------------------------------------------------------------
+
 //static
-static PopcornFX::CImage		*_NewFromTexture(UTexture *texture)
+static PopcornFX::CImage		*_NewFromTexture(UTexture *texture, u32 mipIndex)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::_NewFromTexture", POPCORNFX_UE_PROFILER_COLOR);
 
-	return PopcornFXPlatform_NewImageFromTexture(texture);
+	return PopcornFXPlatform_NewImageFromTexture(texture, mipIndex);
 }
 
 //----------------------------------------------------------------------------
 
-PopcornFX::CImage		*CResourceHandlerImage_UE::NewFromTexture(UTexture *texture)
+PopcornFX::CString	CResourceHandlerImage_UE::BuildMipPath(const PopcornFX::CString &path, u32 mipIndex)
+{
+	if (mipIndex == 0)
+		return path;
+	return ToPk(FString::Printf(TEXT("%s%s%u"), *ToUE(path), kMipPathSuffix, mipIndex));
+}
+
+//----------------------------------------------------------------------------
+
+u32	CResourceHandlerImage_UE::ExtractMipIndex(PopcornFX::CString &inOutPath)
+{
+	const FString	path = ToUE(inOutPath);
+	FString			texturePath;
+	FString			mipIndex;
+	if (!path.Split(kMipPathSuffix, &texturePath, &mipIndex, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		return 0;
+	inOutPath = ToPk(texturePath);
+	return static_cast<u32>(FMath::Max(FCString::Atoi(*mipIndex), 0));
+}
+
+//----------------------------------------------------------------------------
+
+PopcornFX::CImage		*CResourceHandlerImage_UE::NewFromTexture(UTexture *texture, u32 mipIndex)
 {
 	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::NewFromTexture", POPCORNFX_UE_PROFILER_COLOR);
 
-	PopcornFX::CImage		*image = _NewFromTexture(texture);
+	PopcornFX::CImage		*image = _NewFromTexture(texture, mipIndex);
 	if (image == null)
 	{
 		UE_LOG(LogPopcornFXResourceHandlerImage, Warning, TEXT("Failed converting to PopcornFX image \"%s\""), *texture->GetPathName());
@@ -225,9 +336,51 @@ PopcornFX::CImage		*CResourceHandlerImage_UE::NewFromTexture(UTexture *texture)
 
 //----------------------------------------------------------------------------
 
-PopcornFX::CImage	*CResourceHandlerImage_UE::NewFromPath(const PopcornFX::CString &path, bool pathNotVirtual)
+// Editor fixups so the texture's data can be read on CPU
+static bool		_PrepareTextureForSampling(UTexture *texture, u32 mipIndex)
 {
-	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::NewFromPath", POPCORNFX_UE_PROFILER_COLOR);
+#if	WITH_EDITOR
+	// The texture's mips must stay resident to be read on CPU.
+	// Compressed formats that can't be decompressed on CPU, on the editor or any cook target platform,
+	// need the LOD Group to be ColorLookupTable, which builds the texture uncompressed.
+	const bool	needsColorLookupTable = texture->LODGroup != TEXTUREGROUP_ColorLookupTable && !_IsCPUReadableTexture(texture);
+	const bool	needsNeverStream = texture->LODGroup != TEXTUREGROUP_ColorLookupTable && !texture->NeverStream;
+	if (needsColorLookupTable || needsNeverStream)
+	{
+		// Too late: don't allow modifying the resource from a worker thread when an effect is baked.
+		// This should occur on the game thread prior, not now.
+		if (IsRunningCommandlet() && !IsInGameThread())
+			return false;
+
+		const FText		title = FText::FromString(FString("PopcornFX: Texture used for sampling"));
+		const FText		message = needsColorLookupTable ?
+			FText::Format(FText::FromString(FString("Texture \"{0}\" is used for CPU sampling and its format can't be read on CPU, so its LOD Group will be set to 'ColorLookupTable'.\n")), FText::FromString(texture->GetPathName())) :
+			FText::Format(FText::FromString(FString("Texture \"{0}\" is used for CPU sampling so it will be set to 'Never Stream'.\n")), FText::FromString(texture->GetPathName()));
+		OpenMessageBox(EAppMsgCategory::Info, EAppMsgType::Ok, message, title);
+		{
+			texture->Modify();
+			if (needsColorLookupTable)
+			{
+				if (mipIndex == 0)
+					texture->MipGenSettings = TMGS_NoMipmaps;
+				texture->LODGroup = TEXTUREGROUP_ColorLookupTable;
+			}
+			else
+				texture->NeverStream = true;
+			texture->UpdateResource();
+		}
+	}
+#endif // WITH_EDITOR
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+// Loads the UObject and makes sure it can be read on CPU.
+// Touches UObjects: runs on the requesting thread, never on the image load workers.
+static UTexture		*_LoadTextureForSampling(const PopcornFX::CString &path, bool pathNotVirtual, u32 mipIndex)
+{
+	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::_LoadTextureForSampling", POPCORNFX_UE_PROFILER_COLOR);
 
 	UObject			*obj = FPopcornFXPlugin::Get().LoadUObjectFromPkPath(path, pathNotVirtual);
 	if (obj == null)
@@ -241,29 +394,22 @@ PopcornFX::CImage	*CResourceHandlerImage_UE::NewFromPath(const PopcornFX::CStrin
 		UE_LOG(LogPopcornFXResourceHandlerImage, Warning, TEXT("UObject is not a UTexture \"%s\""), *obj->GetPathName());
 		return null;
 	}
+	if (!_PrepareTextureForSampling(texture, mipIndex))
+		return null;
+	return texture;
+}
 
-#if	WITH_EDITOR
-	// We need the LOD Group to be ColorLookupTable otherwise the texture's data is not available on CPU
-	if (texture->LODGroup != TEXTUREGROUP_ColorLookupTable)
-	{
-		// Too late: don't allow modifying the resource from a worker thread when an effect is baked.
-		// This should occur on the game thread prior, not now.
-		if (IsRunningCommandlet() && !IsInGameThread())
-			return null;
+//----------------------------------------------------------------------------
 
-		const FText		title = FText::FromString(FString("PopcornFX: Texture used for sampling"));
-		const FText		message = FText::Format(FText::FromString(FString("Texture \"{0}\" is used for CPU sampling so its LOD Group will be set to 'ColorLookupTable'.\n")), FText::FromString(texture->GetPathName()));
-		OpenMessageBox(EAppMsgCategory::Info, EAppMsgType::Ok, message, title);
-		{
-			texture->Modify();
-			texture->MipGenSettings = TMGS_NoMipmaps;
-			texture->LODGroup = TEXTUREGROUP_ColorLookupTable;
-			texture->UpdateResource();
-		}
-	}
-#endif // WITH_EDITOR
+PopcornFX::CImage	*CResourceHandlerImage_UE::NewFromPath(const PopcornFX::CString &path, bool pathNotVirtual, u32 mipIndex)
+{
+	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::NewFromPath", POPCORNFX_UE_PROFILER_COLOR);
+
+	UTexture	*texture = _LoadTextureForSampling(path, pathNotVirtual, mipIndex);
+	if (texture == null)
+		return null;
 
-	PopcornFX::CImage	*image = _NewFromTexture(texture);
+	PopcornFX::CImage	*image = _NewFromTexture(texture, mipIndex);
 	if (image == null)
 	{
 		UE_LOG(LogPopcornFXResourceHandlerImage, Warning, TEXT("Failed to create texture for PopcornFX \"%s\""), *texture->GetPathName());
@@ -282,9 +428,25 @@ CResourceHandlerImage_UE::CResourceHandlerImage_UE()
 
 CResourceHandlerImage_UE::~CResourceHandlerImage_UE()
 {
+	// Cancel loads no worker picked up yet, and wait for the running ones: they complete into this handler
+	TArray<PPendingLoad>		canceledLoads;
+	TArray<UE::Tasks::FTask>	workers;
+	{
+		PK_SCOPEDLOCK(m_Lock);
+		canceledLoads = MoveTemp(m_QueuedLoads);
+		workers = MoveTemp(m_Workers);
+	}
+	for (const PPendingLoad &pendingLoad : canceledLoads)
+	{
+		pendingLoad->m_Texture.Reset();
+		_CompletePendingLoad(pendingLoad);
+	}
+	UE::Tasks::Wait(workers);
+
 	for (CResourcesHashMap::ConstIterator it = m_Images.Begin(), itEnd = m_Images.End(); it != itEnd; ++it)
 	{
-		PK_ASSERT(it->m_ReferenceCount > 0);
+		if (it->m_ReferenceCount == 0) // Prefetched, never loaded
+			continue;
 		UE_LOG(LogPopcornFXResourceHandlerImage, Warning, TEXT("Texture leak: \"%s\" %s"), *ToUE(it.Key()), it->m_Virtual ? TEXT("(Virtual Texture)") : TEXT(""));
 	}
 }
@@ -304,13 +466,15 @@ void	*CResourceHandlerImage_UE::Load(
 
 	PK_ASSERT(resourceTypeID == PopcornFX::TResourceRouter<PopcornFX::CImage>::ResourceTypeID());
 
-	PopcornFX::CString			_fullPath = resourcePath;
+	PopcornFX::CString			_texturePath = resourcePath;
+	const u32					mipIndex = ExtractMipIndex(_texturePath);
 	if (!pathNotVirtual) // if virtual path
-		_fullPath = ToPk(FPopcornFXPlugin::Get().BuildPathFromPkPath(_fullPath, true)); // prepend Pack Path
+		_texturePath = ToPk(FPopcornFXPlugin::Get().BuildPathFromPkPath(_texturePath, true)); // prepend Pack Path
 
-	PopcornFX::CFilePath::StripExtensionInPlace(_fullPath);
-	const PopcornFX::CString	&fullPath = _fullPath;
-	if (!/*PK_VERIFY*/(!fullPath.Empty()))
+	PopcornFX::CFilePath::StripExtensionInPlace(_texturePath);
+	const PopcornFX::CString	&texturePath = _texturePath;
+	const PopcornFX::CString	fullPath = BuildMipPath(texturePath, mipIndex); // Each loaded mip is a separate resource
+	if (!/*PK_VERIFY*/(!texturePath.Empty()))
 	{
 		if (asyncLoadStatus != null)
 		{
@@ -323,22 +487,79 @@ void	*CResourceHandlerImage_UE::Load(
 
 	if (!loadCtl.m_Reload)
 	{
-		PK_SCOPEDLOCK(m_Lock);
-		SResourceEntry	*existingEntry = m_Images.Find(fullPath);
-		if (existingEntry != null)
+		PPendingLoad	pendingLoad;
+		bool			isNewLoad = false;
+		bool			stolenLoad = false;
 		{
+			PK_SCOPEDLOCK(m_Lock);
+			SResourceEntry	*existingEntry = m_Images.Find(fullPath);
+			if (existingEntry != null)
+			{
+				if (existingEntry->m_ReferenceCount++ == 0)
+					m_UnclaimedImages.Remove(fullPath);
+				if (asyncLoadStatus != null)
+				{
+					asyncLoadStatus->m_Resource = null;
+					asyncLoadStatus->m_Done = true;
+					asyncLoadStatus->m_Progress = 1.0f;
+				}
+				return existingEntry->m_Image.Get();
+			}
+
+			// Join the in-flight load of the same image, if any
+			pendingLoad = _FindOrAddPendingLoad(fullPath, mipIndex, isNewLoad);
+			if (!PK_VERIFY(pendingLoad != null))
+				return null;
+			++pendingLoad->m_RequestCount;
 			if (asyncLoadStatus != null)
 			{
 				asyncLoadStatus->m_Resource = null;
-				asyncLoadStatus->m_Done = true;
-				asyncLoadStatus->m_Progress = 1.0f;
+				asyncLoadStatus->m_Done = false;
+				asyncLoadStatus->m_Progress = 0.0f;
+				PK_VERIFY(pendingLoad->m_AsyncLoadStatuses.PushBack(asyncLoadStatus).Valid());
 			}
-			++existingEntry->m_ReferenceCount;
-			return existingEntry->m_Image.Get();
+			else if (isNewLoad)
+				pendingLoad->m_State = SPendingLoad::State_Running;
+			else if (pendingLoad->m_State == SPendingLoad::State_Queued)
+			{
+				// No worker picked it up yet: don't wait for one, load it right away
+				m_QueuedLoads.Remove(pendingLoad);
+				pendingLoad->m_State = SPendingLoad::State_Running;
+				stolenLoad = true;
+			}
+		}
+
+		if (isNewLoad)
+		{
+			// Resolve the UObject on the requesting thread, workers only copy and decompress the texture data
+			UTexture	*texture = _LoadTextureForSampling(texturePath, true, mipIndex);
+			if (texture != null)
+				pendingLoad->m_Texture.Reset(texture);
+			if (asyncLoadStatus != null)
+			{
+				if (texture != null)
+					_QueuePendingLoad(pendingLoad);
+				else
+					_CompletePendingLoad(pendingLoad);
+				return null;
+			}
+			_RunPendingLoad(pendingLoad);
+		}
+		else if (asyncLoadStatus != null)
+			return null;
+		else if (stolenLoad)
+			_RunPendingLoad(pendingLoad);
+		else
+		{
+			PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::Load Wait", POPCORNFX_UE_PROFILER_COLOR);
+			pendingLoad->m_DoneEvent.Wait();
 		}
+		PK_ASSERT(pendingLoad->m_State == SPendingLoad::State_Done);
+		return pendingLoad->m_Image.Get();
 	}
 
-	PopcornFX::PImage	resource = NewFromPath(fullPath, true);
+	// Reloads stay synchronous: the existing image is patched in place
+	PopcornFX::PImage	resource = NewFromPath(texturePath, true, mipIndex);
 
 	if (resource != null)
 	{
@@ -393,6 +614,215 @@ void	*CResourceHandlerImage_UE::Load(
 	return Load(resourceManager, resourceTypeID, resourcePath.Path(), false, loadCtl, loadReport, asyncLoadStatus);
 }
 
+//----------------------------------------------------------------------------
+//
+//	Asynchronous loads
+//
+//----------------------------------------------------------------------------
+
+//static
+void	CResourceHandlerImage_UE::Prefetch(UTexture *texture, u32 mipIndex, FOnImageLoaded onLoaded)
+{
+	PK_ASSERT(IsInGameThread());
+	if (g_ResourceHandlerImage_UE == null || texture == null)
+	{
+		if (onLoaded)
+			onLoaded(null);
+		return;
+	}
+	g_ResourceHandlerImage_UE->_Prefetch(texture, mipIndex, MoveTemp(onLoaded));
+}
+
+//----------------------------------------------------------------------------
+
+void	CResourceHandlerImage_UE::_Prefetch(UTexture *texture, u32 mipIndex, FOnImageLoaded &&onLoaded)
+{
+	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::Prefetch", POPCORNFX_UE_PROFILER_COLOR);
+
+	PopcornFX::CString	texturePath = ToPk(texture->GetPathName());
+	PopcornFX::CFilePath::StripExtensionInPlace(texturePath);
+	const PopcornFX::CString	fullPath = BuildMipPath(texturePath, mipIndex);
+
+	PPendingLoad		pendingLoad;
+	PopcornFX::PImage	loadedImage;
+	bool				isNewLoad = false;
+	{
+		PK_SCOPEDLOCK(m_Lock);
+		SResourceEntry	*existingEntry = m_Images.Find(fullPath);
+		if (existingEntry != null)
+			loadedImage = existingEntry->m_Image;
+		else
+		{
+			pendingLoad = _FindOrAddPendingLoad(fullPath, mipIndex, isNewLoad);
+			if (pendingLoad != null && onLoaded)
+				pendingLoad->m_OnLoaded.Add(MoveTemp(onLoaded));
+		}
+	}
+	if (pendingLoad == null)
+	{
+		// Already loaded (or failed to track the load): callbacks are never called with the lock held
+		if (onLoaded)
+			onLoaded(loadedImage.Get());
+		return;
+	}
+
+	if (isNewLoad)
+	{
+		if (_PrepareTextureForSampling(texture, mipIndex))
+		{
+			pendingLoad->m_Texture.Reset(texture);
+			_QueuePendingLoad(pendingLoad);
+		}
+		else
+			_CompletePendingLoad(pendingLoad);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+// m_Lock must be held
+CResourceHandlerImage_UE::PPendingLoad	CResourceHandlerImage_UE::_FindOrAddPendingLoad(const PopcornFX::CString &fullPath, u32 mipIndex, bool &outAdded)
+{
+	outAdded = false;
+	PPendingLoad	*existingLoad = m_PendingLoads.Find(fullPath);
+	if (existingLoad != null)
+		return *existingLoad;
+
+	PPendingLoad	pendingLoad = MakeShared<SPendingLoad, ESPMode::ThreadSafe>();
+	pendingLoad->m_FullPath = fullPath;
+	pendingLoad->m_MipIndex = mipIndex;
+	if (m_PendingLoads.Insert(fullPath, pendingLoad) == null)
+		return null;
+	outAdded = true;
+	return pendingLoad;
+}
+
+//----------------------------------------------------------------------------
+
+void	CResourceHandlerImage_UE::_QueuePendingLoad(const PPendingLoad &pendingLoad)
+{
+	// Effects referencing lots of textures shouldn't take over the task graph: loads are spread over a bounded number of workers
+	const int32	maxWorkers = FMath::Max(FPopcornFXPlugin::Get().Settings()->MaxConcurrentImageLoads, 1);
+
+	PK_SCOPEDLOCK(m_Lock);
+	PK_ASSERT(pendingLoad->m_State == SPendingLoad::State_Resolving);
+	pendingLoad->m_State = SPendingLoad::State_Queued;
+	m_QueuedLoads.Add(pendingLoad);
+
+	// A worker that found the queue empty left the count in the same critical section: it can't miss this load
+	if (m_ActiveWorkerCount < u32(maxWorkers))
+	{
+		++m_ActiveWorkerCount;
+		m_Workers.RemoveAll([](const UE::Tasks::FTask &worker) { return worker.IsCompleted(); });
+		m_Workers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]() { _WorkerLoop(); }, UE::Tasks::ETaskPriority::BackgroundNormal));
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	CResourceHandlerImage_UE::_WorkerLoop()
+{
+	for (;;)
+	{
+		PPendingLoad	pendingLoad;
+		{
+			PK_SCOPEDLOCK(m_Lock);
+			if (m_QueuedLoads.IsEmpty())
+			{
+				PK_ASSERT(m_ActiveWorkerCount > 0);
+				--m_ActiveWorkerCount;
+				return;
+			}
+			pendingLoad = m_QueuedLoads[0];
+			m_QueuedLoads.RemoveAt(0, EAllowShrinking::No);
+			PK_ASSERT(pendingLoad->m_State == SPendingLoad::State_Queued);
+			pendingLoad->m_State = SPendingLoad::State_Running;
+		}
+		_RunPendingLoad(pendingLoad);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	CResourceHandlerImage_UE::_RunPendingLoad(const PPendingLoad &pendingLoad)
+{
+	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::_RunPendingLoad", POPCORNFX_UE_PROFILER_COLOR);
+
+	PK_ASSERT(pendingLoad->m_State == SPendingLoad::State_Running);
+	UTexture	*texture = pendingLoad->m_Texture.Get();
+	if (texture != null)
+	{
+		pendingLoad->m_Image = _NewFromTexture(texture, pendingLoad->m_MipIndex);
+		if (pendingLoad->m_Image == null)
+			UE_LOG(LogPopcornFXResourceHandlerImage, Warning, TEXT("Failed to create texture for PopcornFX \"%s\""), *texture->GetPathName());
+	}
+	_CompletePendingLoad(pendingLoad);
+}
+
+//----------------------------------------------------------------------------
+
+void	CResourceHandlerImage_UE::_CompletePendingLoad(const PPendingLoad &pendingLoad)
+{
+	PopcornFX::PImage	evictedImage; // Released outside the lock
+	{
+		PK_SCOPEDLOCK(m_Lock);
+		PopcornFX::PImage	image = pendingLoad->m_Image;
+		if (image != null)
+		{
+			SResourceEntry	*entry = m_Images.Find(pendingLoad->m_FullPath);
+			if (entry == null) // Otherwise, a reload or a virtual texture registered it in the meantime
+				entry = m_Images.Insert(pendingLoad->m_FullPath, SResourceEntry(image, 0));
+			if (PK_VERIFY(entry != null))
+			{
+				image = entry->m_Image;
+				entry->m_ReferenceCount += pendingLoad->m_RequestCount;
+				if (entry->m_ReferenceCount == 0)
+				{
+					// Prefetched only: keep a bounded number of them until someone loads them
+					m_UnclaimedImages.Add(pendingLoad->m_FullPath);
+					if (m_UnclaimedImages.Num() > kMaxUnclaimedImages)
+					{
+						const PopcornFX::CString	evictedPath = m_UnclaimedImages[0];
+						m_UnclaimedImages.RemoveAt(0);
+						SResourceEntry	*evictedEntry = m_Images.Find(evictedPath);
+						if (evictedEntry != null && evictedEntry->m_ReferenceCount == 0)
+						{
+							evictedImage = evictedEntry->m_Image;
+							m_Images.Remove(evictedPath);
+						}
+					}
+				}
+			}
+			else
+				image = null;
+		}
+		pendingLoad->m_Image = image;
+		pendingLoad->m_State = SPendingLoad::State_Done;
+		m_PendingLoads.Remove(pendingLoad->m_FullPath);
+	}
+
+	// No new request can join the load anymore: notify the ones that did
+	PopcornFX::CImage	*image = pendingLoad->m_Image.Get();
+	for (SAsyncLoadStatus *asyncLoadStatus : pendingLoad->m_AsyncLoadStatuses)
+	{
+		asyncLoadStatus->m_Resource = image;
+		asyncLoadStatus->m_Progress = 1.0f;
+		FPlatformMisc::MemoryBarrier();
+		asyncLoadStatus->m_Done = true;
+	}
+	for (const FOnImageLoaded &onLoaded : pendingLoad->m_OnLoaded)
+		onLoaded(image);
+	pendingLoad->m_AsyncLoadStatuses.Clear();
+	pendingLoad->m_OnLoaded.Empty();
+
+	// The texture reference was taken on the requesting thread, release it on the game thread too
+	if (pendingLoad->m_Texture.IsValid() && !IsInGameThread())
+		AsyncTask(ENamedThreads::GameThread, [texture = pendingLoad->m_Texture]() { });
+	pendingLoad->m_Texture.Reset();
+
+	pendingLoad->m_DoneEvent.Trigger();
+}
+
 //----------------------------------------------------------------------------
 
 void	CResourceHandlerImage_UE::Unload(
@@ -469,19 +899,28 @@ void	CResourceHandlerImage_UE::BroadcastResourceChanged(const PopcornFX::CResour
 {
 	PK_NAMEDSCOPEDPROFILE_C("CResourceHandlerImage_UE::BroadcastResourceChanged", POPCORNFX_UE_PROFILER_COLOR);
 
-	const PopcornFX::CString		fullPath = PopcornFX::CFilePath::StripExtension(resourcePath.FullPath());
+	const PopcornFX::CString		texturePath = PopcornFX::CFilePath::StripExtension(resourcePath.FullPath());
 
+	// Reload all the loaded mips of the texture
+	PopcornFX::TArray<u32>	mipIndices;
 	{
 		PK_SCOPEDLOCK(m_Lock);
-		SResourceEntry	*foundResource = m_Images.Find(fullPath);
-		if (foundResource == null || !PK_VERIFY(foundResource->m_Image != null))
-			return;
+		for (CResourcesHashMap::ConstIterator it = m_Images.Begin(), itEnd = m_Images.End(); it != itEnd; ++it)
+		{
+			PopcornFX::CString	entryTexturePath = it.Key();
+			const u32			mipIndex = ExtractMipIndex(entryTexturePath);
+			if (entryTexturePath == texturePath && PK_VERIFY(it->m_Image != null))
+				PK_VERIFY(mipIndices.PushBack(mipIndex).Valid());
+		}
 	}
 
-	PopcornFX::PImage	resource = NewFromPath(fullPath, true);
-
-	if (resource != null)
+	for (u32 mipIndex : mipIndices)
 	{
+		PopcornFX::PImage	resource = NewFromPath(texturePath, true, mipIndex);
+		if (resource == null)
+			continue;
+
+		const PopcornFX::CString	fullPath = BuildMipPath(texturePath, mipIndex);
 		PK_SCOPEDLOCK(m_Lock);
 		SResourceEntry	*foundResource = m_Images.Find(fullPath);
 		if (foundResource != null)	// could have been Unload-ed in the meantime
@@ -514,9 +953,8 @@ bool	CResourceHandlerImage_UE::IsUsed(const PopcornFX::CString &virtualPath, boo
 	{
 		PK_SCOPEDLOCK(m_Lock);
 		const SResourceEntry		*entry = m_Images.Find(fullPath);
-		if (entry == null)
+		if (entry == null || entry->m_ReferenceCount == 0) // Prefetched images aren't used until loaded
 			return false;
-		PK_ASSERT(entry->m_ReferenceCount > 0);
 		if (entry->m_Virtual) // Register Virtual inc m_ReferenceCount once
 			return entry->m_ReferenceCount > 1;
 		return true;
@@ -8,6 +8,8 @@
 #include "PopcornFXMinimal.h"
 
 #include "PixelFormat.h"
+#include "Tasks/Task.h"
+#include "StrongObjectPtrViaShared.h"
 
 #include "PopcornFXSDK.h"
 #include <pk_kernel/include/kr_resources.h>
@@ -32,8 +34,20 @@ public:
 	static void					Shutdown();
 
 public:
-	static PopcornFX::CImage	*NewFromPath(const PopcornFX::CString &path, bool pathNotVirtual);
-	static PopcornFX::CImage	*NewFromTexture(UTexture *texture);
+	static PopcornFX::CImage	*NewFromPath(const PopcornFX::CString &path, bool pathNotVirtual, u32 mipIndex = 0);
+	static PopcornFX::CImage	*NewFromTexture(UTexture *texture, u32 mipIndex = 0);
+
+	// Called once the image is loaded (null if the load failed), from the thread that completed the load: can be a worker thread, or the calling thread if the image is already loaded.
+	// The image is kept alive by the handler during the call only, take a PopcornFX::PImage to keep it.
+	typedef TFunction<void(PopcornFX::CImage *image)>	FOnImageLoaded;
+
+	// Starts loading the CPU image of 'texture' on a worker thread so later synchronous loads of the same texture and mip don't stall.
+	// Game thread only: the texture is prepared for CPU sampling before being handed to the worker.
+	static void					Prefetch(UTexture *texture, u32 mipIndex = 0, FOnImageLoaded onLoaded = FOnImageLoaded());
+
+	// CPU images can be loaded from a lower resolution mip of the texture, with "<texture path>?mip=<mipIndex>" resource paths
+	static PopcornFX::CString	BuildMipPath(const PopcornFX::CString &path, u32 mipIndex);
+	static u32					ExtractMipIndex(PopcornFX::CString &inOutPath); // Strips the mip suffix
 
 	struct	SResourceEntry
 	{
@@ -47,9 +61,44 @@ public:
 
 	typedef PopcornFX::THashMap<SResourceEntry, PopcornFX::CString>		CResourcesHashMap;
 
+	// In-flight load, keyed like SResourceEntry: concurrent requests of the same image join it instead of loading it again
+	struct	SPendingLoad
+	{
+		enum EState
+		{
+			State_Resolving,	// The first requester is loading the UObject
+			State_Queued,		// Waiting for a worker, a synchronous request can run it itself
+			State_Running,
+			State_Done,
+		};
+
+		PopcornFX::CString						m_FullPath;
+		u32										m_MipIndex = 0;
+		TStrongObjectPtrViaShared<UTexture>		m_Texture;			// Resolved on the requesting thread, only read back on the worker
+		PopcornFX::PImage						m_Image;
+		u32										m_RequestCount = 0;	// References the resulting SResourceEntry starts with, 0 when only prefetched
+		EState									m_State = State_Resolving;
+		UE::Tasks::FTaskEvent					m_DoneEvent{ UE_SOURCE_LOCATION };
+		PopcornFX::TArray<SAsyncLoadStatus*>	m_AsyncLoadStatuses;
+		TArray<FOnImageLoaded>					m_OnLoaded;
+	};
+	typedef TSharedPtr<SPendingLoad, ESPMode::ThreadSafe>				PPendingLoad;
+
 private:
 	PopcornFX::Threads::CCriticalSection		m_Lock;
 	CResourcesHashMap							m_Images;
+	PopcornFX::THashMap<PPendingLoad, PopcornFX::CString>	m_PendingLoads;
+	TArray<PPendingLoad>						m_QueuedLoads;
+	TArray<UE::Tasks::FTask>					m_Workers; // Only kept to wait for them on destruction
+	u32											m_ActiveWorkerCount = 0; // Workers that didn't find the queue empty yet
+	TArray<PopcornFX::CString>					m_UnclaimedImages; // Prefetched images no one loaded yet, oldest first
+
+	PPendingLoad	_FindOrAddPendingLoad(const PopcornFX::CString &fullPath, u32 mipIndex, bool &outAdded);
+	void			_QueuePendingLoad(const PPendingLoad &pendingLoad);
+	void			_RunPendingLoad(const PPendingLoad &pendingLoad);
+	void			_CompletePendingLoad(const PPendingLoad &pendingLoad);
+	void			_WorkerLoop();
+	void			_Prefetch(UTexture *texture, u32 mipIndex, FOnImageLoaded &&onLoaded);
 
 public:
 	CResourceHandlerImage_UE();
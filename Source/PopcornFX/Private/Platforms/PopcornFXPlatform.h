@@ -32,7 +32,7 @@ FWD_PK_API_END
 
 //----------------------------------------------------------------------------
 
-PopcornFX::CImage			*PopcornFXPlatform_NewImageFromTexture(class UTexture *texture);
+PopcornFX::CImage			*PopcornFXPlatform_NewImageFromTexture(class UTexture *texture, u32 mipIndex = 0); // mipIndex is clamped to the last available mip
 extern PopcornFX::CImage	*_CreateFallbackImage();
 
 //----------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #include "PopcornFXPlatform.h"
 
 #include "Internal/ResourceHandlerImage_UE.h"
+#include "Internal/ImageDecompression.h"
 
 #include "Engine/Texture2D.h"
 
@@ -71,7 +72,7 @@ PopcornFX::CImage		*_CreateFallbackImage()
 
 #if (PKFX_COMMON_NewImageFromTexture != 0)
 
-PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture)
+PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture, u32 mipIndex)
 {
 #define	TEXTURE_ERROR_COMMONF(__msg, ...)	do {														\
 		/*UE_LOG(LogPopcornFXPlatformCommon, Warning, __msg TEXT(": Texture 'LOD Group' must be 'ColorLookupTable': \"%s\""), ## __VA_ARGS__, *texture->GetPathName()); */\
@@ -101,9 +102,12 @@ PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture)
 		return null;
 	}
 
+	// Mips that are not cooked for the running platform fall back to the last available one
+	const u32	mip = platformData->Mips.Num() > 0 ? PopcornFX::PKMin(mipIndex, u32(platformData->Mips.Num() - 1)) : 0;
+
 #if WITH_EDITOR
 	// Ugly workarround for cooking: create a fallback image.
-	if (IsRunningCommandlet() && (platformData->Mips.Num() == 0 || !platformData->Mips[0].BulkData.IsBulkDataLoaded()))
+	if (IsRunningCommandlet() && (platformData->Mips.Num() == 0 || !platformData->Mips[mip].BulkData.IsBulkDataLoaded()))
 	{
 		//
 		// During cooking, we cannot get a valid platformData because:
@@ -121,12 +125,19 @@ PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture)
 		return null;
 	}
 
-	/*const*/ FByteBulkData		&mipData = platformData->Mips[0].BulkData;
+	const FTexture2DMipMap		&mipMap = platformData->Mips[mip];
+	/*const*/ FByteBulkData		&mipData = platformData->Mips[mip].BulkData;
 
 	const EPixelFormat			srcFormat = platformData->PixelFormat;
-	const CUint3				imageSize(platformData->SizeX, platformData->SizeY, 1);
+	const CUint3				imageSize(mipMap.SizeX, mipMap.SizeY, 1);
 	const u32					bulkDataSize = mipData.GetBulkDataSize();
 
+	if (!mipData.IsBulkDataLoaded() && !mipData.CanLoadFromDisk())
+	{
+		TEXTURE_ERROR_COMMONF(TEXT("Mip %d data is not available on the CPU (the texture must not be streamed)"), mip);
+		return null;
+	}
+
 	if (!/*PK_VERIFY*/(All(imageSize.xy() > 0)) ||
 		!/*PK_VERIFY*/(bulkDataSize > 0))
 	{
@@ -134,14 +145,20 @@ PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture)
 		return null;
 	}
 
-	const PopcornFX::CImage::EFormat	dstFormat = _UE2PKImageFormat(srcFormat, false);
+	// Block-compressed formats PopcornFX images can't hold are decompressed on the CPU
+	const PopcornFX::CImage::EFormat	decompressedFormat = PopcornFXImage_DecompressedFormat(srcFormat);
+	const bool							decompress = decompressedFormat != PopcornFX::CImage::Format_Invalid;
+	const PopcornFX::CImage::EFormat	dstFormat = decompress ? decompressedFormat : _UE2PKImageFormat(srcFormat, false);
 	if (dstFormat == PopcornFX::CImage::Format_Invalid)
 	{
 		TEXTURE_ERROR_COMMONF(TEXT("Format '%s' not supported"), _My_GetPixelFormatString(srcFormat));
 		return null;
 	}
 
-	const u32				expectedSizeInBytes = PopcornFX::CImage::GetFormatPixelBufferSizeInBytes(dstFormat, imageSize);
+	const FPixelFormatInfo	&srcFormatInfo = GPixelFormats[srcFormat];
+	const u32				expectedSizeInBytes = decompress ?
+		FMath::DivideAndRoundUp<u32>(imageSize.x(), srcFormatInfo.BlockSizeX) * FMath::DivideAndRoundUp<u32>(imageSize.y(), srcFormatInfo.BlockSizeY) * srcFormatInfo.BlockBytes :
+		PopcornFX::CImage::GetFormatPixelBufferSizeInBytes(dstFormat, imageSize);
 	if (!/*PK_VERIFY*/(bulkDataSize >= expectedSizeInBytes)) // don't mind if there is padding
 	{
 		TEXTURE_ERROR_COMMONF(TEXT("Mismatching texture size for format '%s' %dx%dx%d (got 0x%x bytes, expected 0x%x)"),
@@ -168,6 +185,22 @@ PopcornFX::CImage	*PopcornFXPlatform_NewImageFromTexture(UTexture *texture)
 		}
 	}
 
+	if (decompress)
+	{
+		// Only the decompressed pixels are kept, the compressed copy is released at the end of the scope
+		const PopcornFX::PRefCountedMemoryBuffer	compressedBuffer = dstBuffer;
+		const u32									dstSizeInBytes = PopcornFX::CImage::GetFormatPixelBufferSizeInBytes(dstFormat, imageSize);
+
+		dstBuffer = PopcornFX::CRefCountedMemoryBuffer::AllocAligned(dstSizeInBytes + kAlignment, kAlignment);
+		if (!PK_VERIFY(dstBuffer != null))
+			return null;
+		if (!PopcornFXImage_Decompress(srcFormat, imageSize.xy(), compressedBuffer->Data<void>(), bulkDataSize, dstBuffer->Data<void>(), dstSizeInBytes))
+		{
+			TEXTURE_ERROR_COMMONF(TEXT("Failed to decompress format '%s'"), _My_GetPixelFormatString(srcFormat));
+			return null;
+		}
+	}
+
 	PopcornFX::CImage	*image = PK_NEW(PopcornFX::CImage);
 	if (!PK_VERIFY(image != null) ||
 		!PK_VERIFY(image->m_Frames.Resize(1)) ||
@@ -92,7 +92,7 @@ UPopcornFXEmitterComponent*	UPopcornFXFunctions::SpawnEmitterAtLocation(UObject*
 	UPopcornFXEmitterComponent	*emitter = null;
 	if (FApp::CanEverRender() && !world->IsNetMode(NM_DedicatedServer))
 	{
-		emitter = UPopcornFXEmitterComponent::CreateStandaloneEmitterComponent(Effect, null, world, null, bAutoDestroy);
+		emitter = UPopcornFXEmitterComponent::AcquireStandaloneEmitterComponent(Effect, null, world, bAutoDestroy);
 		if (emitter == null)
 		{
 			UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Spawn Emitter At Location: Failed to create Effect '%s'"), *Effect->GetName());
@@ -137,7 +137,7 @@ UPopcornFXEmitterComponent *UPopcornFXFunctions::SpawnEmitterAttached(class UPop
 	UPopcornFXEmitterComponent	*emitter = null;
 	if (FApp::CanEverRender() && !world->IsNetMode(NM_DedicatedServer))
 	{
-		emitter = UPopcornFXEmitterComponent::CreateStandaloneEmitterComponent(Effect, null, world, null, bAutoDestroy);
+		emitter = UPopcornFXEmitterComponent::AcquireStandaloneEmitterComponent(Effect, null, world, bAutoDestroy);
 		if (emitter == null)
 		{
 			UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Spawn Emitter Attached: Failed to create Effect '%s'"), *Effect->GetName());
@@ -163,6 +163,30 @@ UPopcornFXEmitterComponent *UPopcornFXFunctions::SpawnEmitterAttached(class UPop
 
 //----------------------------------------------------------------------------
 
+void	UPopcornFXFunctions::PrewarmEmitterPool(UObject* WorldContextObject, class UPopcornFXEffect* Effect, int32 Count)
+{
+	if (Effect == null)
+	{
+		UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Prewarm Emitter Pool: No effect specified"));
+		return;
+	}
+	const UWorld			*world = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	UPopcornFXEmitterPool	*pool = UPopcornFXEmitterPool::Get(world);
+	if (pool != null)
+		pool->Prewarm(Effect, Count);
+}
+
+//----------------------------------------------------------------------------
+
+FPopcornFXEmitterPoolStats	UPopcornFXFunctions::GetEmitterPoolStats(UObject* WorldContextObject)
+{
+	const UWorld				*world = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	const UPopcornFXEmitterPool	*pool = UPopcornFXEmitterPool::Get(world);
+	return pool != null ? pool->Stats() : FPopcornFXEmitterPoolStats();
+}
+
+//----------------------------------------------------------------------------
+
 void		UPopcornFXFunctions::NotifyObjectChanged(class UObject *object)
 {
 	FPopcornFXPlugin::Get().NotifyObjectChanged(object);
@@ -300,22 +324,149 @@ bool		UPopcornFXFunctions::UnregisterVirtualTextureOverride_GPU(const FString &v
 //----------------------------------------------------------------------------
 
 bool	UPopcornFXFunctions::GetEventPayloadAsFloat(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValue, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsFloatFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsFloat2FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsVector2D(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FVector2D &OutValue, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsVector2DFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, float &OutValueZ, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsFloat3FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsVector(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FVector &OutValue, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsVectorFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, float &OutValueZ, float &OutValueW, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsFloat4FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ, OutValueW, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsLinearColor(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FLinearColor &OutValue)
+{
+	return GetEventPayloadAsLinearColorFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsInt(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValue)
+{
+	return GetEventPayloadAsIntFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsInt2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY)
+{
+	return GetEventPayloadAsInt2FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsInt3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ)
+{
+	return GetEventPayloadAsInt3FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsInt4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ, int32 &OutValueW)
+{
+	return GetEventPayloadAsInt4FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ, OutValueW);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsBool(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValue)
+{
+	return GetEventPayloadAsBoolFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsBool2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY)
+{
+	return GetEventPayloadAsBool2FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsBool3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY, bool &OutValueZ)
+{
+	return GetEventPayloadAsBool3FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsBool4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY, bool &OutValueZ, bool &OutValueW)
+{
+	return GetEventPayloadAsBool4FromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValueX, OutValueY, OutValueZ, OutValueW);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsRotator(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FRotator &OutValue, bool InApplyGlobalScale)
+{
+	return GetEventPayloadAsRotatorFromHandle(Emitter, MakeEventPayloadHandle(PayloadName), OutValue, InApplyGlobalScale);
+}
+
+//----------------------------------------------------------------------------
+
+FPopcornFXPayloadHandle	UPopcornFXFunctions::MakeEventPayloadHandle(const FString &PayloadName)
+{
+	FPopcornFXPayloadHandle	handle;
+	if (PayloadName.IsEmpty())
+		return handle;
+
+	handle.PayloadName = PayloadName;
+	handle.PayloadNameId = PopcornFX::CStringId(ToPk(PayloadName)).Id(); // Expensive, done once
+	return handle;
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXFunctions::GetEventPayloadAsFloatFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValue, bool InApplyGlobalScale)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
 		UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Get Event Payload: Invalid Emitter"));
 		return false;
 	}
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Float, &OutValue))
+		return false;
 
 	if (InApplyGlobalScale)
 		OutValue *= FPopcornFXPlugin::GlobalScale();
 
-	return Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Float, &OutValue);
+	return true;
 }
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsFloat2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, bool InApplyGlobalScale)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -323,7 +474,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat2(const UPopcornFXEmitterCompone
 		return false;
 	}
 	PK_ALIGN(0x10) float	outValue[2];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Float2, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Float2, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -341,10 +492,10 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat2(const UPopcornFXEmitterCompone
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsVector2D(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FVector2D &OutValue, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsVector2DFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FVector2D &OutValue, bool InApplyGlobalScale)
 {
 	float	outValues[2];
-	if (!GetEventPayloadAsFloat2(Emitter, PayloadName, outValues[0], outValues[1], InApplyGlobalScale))
+	if (!GetEventPayloadAsFloat2FromHandle(Emitter, PayloadHandle, outValues[0], outValues[1], InApplyGlobalScale))
 		return false;
 	OutValue.X = outValues[0];
 	OutValue.Y = outValues[1];
@@ -353,7 +504,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsVector2D(const UPopcornFXEmitterCompo
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsFloat3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, float &OutValueZ, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, float &OutValueZ, bool InApplyGlobalScale)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -361,7 +512,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat3(const UPopcornFXEmitterCompone
 		return false;
 	}
 	PK_ALIGN(0x10) float	outValue[3];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Float3, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Float3, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -381,10 +532,10 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat3(const UPopcornFXEmitterCompone
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsVector(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FVector &OutValue, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsVectorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FVector &OutValue, bool InApplyGlobalScale)
 {
 	float	outValues[3];
-	if (!GetEventPayloadAsFloat3(Emitter, PayloadName, outValues[0], outValues[1], outValues[2], InApplyGlobalScale))
+	if (!GetEventPayloadAsFloat3FromHandle(Emitter, PayloadHandle, outValues[0], outValues[1], outValues[2], InApplyGlobalScale))
 		return false;
 	OutValue.X = outValues[0];
 	OutValue.Y = outValues[1];
@@ -394,7 +545,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsVector(const UPopcornFXEmitterCompone
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsFloat4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, float &OutValueX, float &OutValueY, float &OutValueZ, float &OutValueW, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsFloat4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, float &OutValueZ, float &OutValueW, bool InApplyGlobalScale)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -402,7 +553,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat4(const UPopcornFXEmitterCompone
 		return false;
 	}
 	PK_ALIGN(0x10) float	outValue[4];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Float4, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Float4, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -424,26 +575,26 @@ bool	UPopcornFXFunctions::GetEventPayloadAsFloat4(const UPopcornFXEmitterCompone
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsLinearColor(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FLinearColor &OutValue)
+bool	UPopcornFXFunctions::GetEventPayloadAsLinearColorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FLinearColor &OutValue)
 {
-	return GetEventPayloadAsFloat4(Emitter, PayloadName, OutValue.R, OutValue.G, OutValue.B, OutValue.A, false);
+	return GetEventPayloadAsFloat4FromHandle(Emitter, PayloadHandle, OutValue.R, OutValue.G, OutValue.B, OutValue.A, false);
 }
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsInt(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValue)
+bool	UPopcornFXFunctions::GetEventPayloadAsIntFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValue)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
 		UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Get Event Payload: Invalid Emitter"));
 		return false;
 	}
-	return Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Int, &OutValue);
+	return Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Int, &OutValue);
 }
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsInt2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY)
+bool	UPopcornFXFunctions::GetEventPayloadAsInt2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -451,7 +602,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt2(const UPopcornFXEmitterComponent
 		return false;
 	}
 	PK_ALIGN(0x10) int32	outValue[2];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Int2, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Int2, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -461,7 +612,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt2(const UPopcornFXEmitterComponent
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsInt3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ)
+bool	UPopcornFXFunctions::GetEventPayloadAsInt3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -469,7 +620,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt3(const UPopcornFXEmitterComponent
 		return false;
 	}
 	PK_ALIGN(0x10) int32	outValue[3];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Int3, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Int3, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -479,7 +630,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt3(const UPopcornFXEmitterComponent
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsInt4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ, int32 &OutValueW)
+bool	UPopcornFXFunctions::GetEventPayloadAsInt4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ, int32 &OutValueW)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -487,7 +638,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt4(const UPopcornFXEmitterComponent
 		return false;
 	}
 	PK_ALIGN(0x10) int32	outValue[4];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Int4, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Int4, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -498,19 +649,19 @@ bool	UPopcornFXFunctions::GetEventPayloadAsInt4(const UPopcornFXEmitterComponent
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsBool(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValue)
+bool	UPopcornFXFunctions::GetEventPayloadAsBoolFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValue)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
 		UE_LOG(LogPopcornFXFunctions, Warning, TEXT("Get Event Payload: Invalid Emitter"));
 		return false;
 	}
-	return Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Bool, &OutValue);
+	return Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Bool, &OutValue);
 }
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsBool2(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY)
+bool	UPopcornFXFunctions::GetEventPayloadAsBool2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -518,7 +669,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool2(const UPopcornFXEmitterComponen
 		return false;
 	}
 	PK_ALIGN(0x10) bool	outValue[2];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Bool2, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Bool2, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -527,7 +678,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool2(const UPopcornFXEmitterComponen
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsBool3(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY, bool &OutValueZ)
+bool	UPopcornFXFunctions::GetEventPayloadAsBool3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY, bool &OutValueZ)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -535,7 +686,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool3(const UPopcornFXEmitterComponen
 		return false;
 	}
 	PK_ALIGN(0x10) bool	outValue[3];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Bool3, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Bool3, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -545,7 +696,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool3(const UPopcornFXEmitterComponen
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsBool4(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, bool &OutValueX, bool &OutValueY, bool &OutValueZ, bool &OutValueW)
+bool	UPopcornFXFunctions::GetEventPayloadAsBool4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY, bool &OutValueZ, bool &OutValueW)
 {
 	if (!PK_VERIFY(Emitter != null))
 	{
@@ -553,7 +704,7 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool4(const UPopcornFXEmitterComponen
 		return false;
 	}
 	PK_ALIGN(0x10) bool	outValue[4];
-	if (!Emitter->GetPayloadValue(PayloadName, EPopcornFXPayloadType::Bool4, outValue))
+	if (!Emitter->GetPayloadValue(PayloadHandle, EPopcornFXPayloadType::Bool4, outValue))
 		return false;
 	OutValueX = outValue[0];
 	OutValueY = outValue[1];
@@ -564,10 +715,10 @@ bool	UPopcornFXFunctions::GetEventPayloadAsBool4(const UPopcornFXEmitterComponen
 
 //----------------------------------------------------------------------------
 
-bool	UPopcornFXFunctions::GetEventPayloadAsRotator(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FRotator &OutValue, bool InApplyGlobalScale)
+bool	UPopcornFXFunctions::GetEventPayloadAsRotatorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FRotator &OutValue, bool InApplyGlobalScale)
 {
 	PK_ALIGN(0x10) float	outValue[4];
-	if (GetEventPayloadAsFloat4(Emitter, PayloadName, outValue[0], outValue[1], outValue[2], outValue[3], InApplyGlobalScale))
+	if (GetEventPayloadAsFloat4FromHandle(Emitter, PayloadHandle, outValue[0], outValue[1], outValue[2], outValue[3], InApplyGlobalScale))
 	{
 		OutValue = FQuat(outValue[0], outValue[1], outValue[2], outValue[3]).Rotator();
 		return true;
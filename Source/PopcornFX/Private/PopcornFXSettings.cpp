@@ -67,6 +67,10 @@ UPopcornFXSettings::UPopcornFXSettings(const FObjectInitializer& PCIP)
 ,	GPUParticleCountLimitPerEffect(10000)
 ,	CPUParticleCountLimitTotal(30000)
 ,	GPUParticleCountLimitTotal(50000)
+,	bEnableEmitterPool(false)
+,	MaxPooledEmittersPerEffect(32)
+,	MaxCachedImageDensityTables(16)
+,	MaxConcurrentImageLoads(2)
 ,	DebugBoundsLinesThickness(2.0f)
 ,	DebugParticlePointSize(5.0f)
 ,	EffectsProfilerSortMode(EPopcornFXEffectsProfilerSortMode::SimulationCost)
@@ -190,6 +194,12 @@ UMaterialInterface	*UPopcornFXSettings::GetConfigLegacyMaterial(uint32 ePopcornF
 FPopcornFXSimulationSettings::FPopcornFXSimulationSettings()
 	: bOverride_bEnablePhysicalMaterials(0)
 	, bEnablePhysicalMaterials(true)
+	, bOverride_bDeterministicCollisionQueries(0)
+	, bDeterministicCollisionQueries(false)
+	, bOverride_bEnableCollisionTemporalCache(0)
+	, bEnableCollisionTemporalCache(false)
+	, bOverride_CollisionTemporalCacheTolerance(0)
+	, CollisionTemporalCacheTolerance(1.0f)
 	, bOverride_LocalizedPagesMode(0)
 	, LocalizedPagesMode(EPopcornFXLocalizedPagesMode::EnableDefaultsToOff)
 	, bOverride_SceneUpdateTickGroup(0)
@@ -215,6 +225,9 @@ void	FPopcornFXSimulationSettings::ResolveSettingsTo(FPopcornFXSimulationSetting
 	const FPopcornFXSimulationSettings				&configValues = FPopcornFXPlugin::Get().Settings()->SimulationSettings;
 
 	RESOLVE_SETTING(bEnablePhysicalMaterials);
+	RESOLVE_SETTING(bDeterministicCollisionQueries);
+	RESOLVE_SETTING(bEnableCollisionTemporalCache);
+	RESOLVE_SETTING(CollisionTemporalCacheTolerance);
 	RESOLVE_SETTING(LocalizedPagesMode);
 	RESOLVE_SETTING(SceneUpdateTickGroup);
 }
@@ -230,6 +243,26 @@ FPopcornFXRenderSettings::FPopcornFXRenderSettings()
 	, bDisableStatelessCollecting(true)
 	, bOverride_bForceLightsLitTranslucent(0)
 	, bForceLightsLitTranslucent(false)
+	, bOverride_bEnableLightsCulling(0)
+	, bEnableLightsCulling(true)
+	, bOverride_MaxLights(0)
+	, MaxLights(0)
+	, bOverride_MaxLightsPerRenderer(0)
+	, MaxLightsPerRenderer(0)
+	, bOverride_bEnableDecalsCulling(0)
+	, bEnableDecalsCulling(true)
+	, bOverride_DecalsCullDistance(0)
+	, DecalsCullDistance(0.0f)
+	, bOverride_MaxDecals(0)
+	, MaxDecals(0)
+	, bOverride_MaxSoundVoices(0)
+	, MaxSoundVoices(0)
+	, bOverride_RayTracingCullMethod(0)
+	, RayTracingCullMethod(EPopcornFXRayTracingCullMethod::None)
+	, bOverride_RayTracingCullDistance(0)
+	, RayTracingCullDistance(10000.0f)
+	, bOverride_RayTracingMinScreenSize(0)
+	, RayTracingMinScreenSize(0.005f)
 {
 }
 
@@ -244,6 +277,16 @@ void	FPopcornFXRenderSettings::ResolveSettingsTo(FPopcornFXRenderSettings &outVa
 	RESOLVE_SETTING(bEnableEarlyFrameRelease);
 	RESOLVE_SETTING(bDisableStatelessCollecting);
 	RESOLVE_SETTING(bForceLightsLitTranslucent);
+	RESOLVE_SETTING(bEnableLightsCulling);
+	RESOLVE_SETTING(MaxLights);
+	RESOLVE_SETTING(MaxLightsPerRenderer);
+	RESOLVE_SETTING(bEnableDecalsCulling);
+	RESOLVE_SETTING(DecalsCullDistance);
+	RESOLVE_SETTING(MaxDecals);
+	RESOLVE_SETTING(MaxSoundVoices);
+	RESOLVE_SETTING(RayTracingCullMethod);
+	RESOLVE_SETTING(RayTracingCullDistance);
+	RESOLVE_SETTING(RayTracingMinScreenSize);
 }
 
 #undef RESOLVE_SETTING
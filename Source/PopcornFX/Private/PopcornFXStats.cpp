@@ -20,6 +20,8 @@ DEFINE_STAT(STAT_PopcornFX_DeadParticleCount);
 DEFINE_STAT(STAT_PopcornFX_DrawCallCount);
 DEFINE_STAT(STAT_PopcornFX_EmitterUpdateCount);
 DEFINE_STAT(STAT_PopcornFX_SoundParticleCount);
+DEFINE_STAT(STAT_PopcornFX_VirtualSoundCount);
+DEFINE_STAT(STAT_PopcornFX_CachedRayCount);
 DEFINE_STAT(STAT_PopcornFX_DrawRequestsCount);
 DEFINE_STAT(STAT_PopcornFX_DrawCallsCount);
 DEFINE_STAT(STAT_PopcornFX_DrawCallsBillboardCount);
@@ -29,6 +31,8 @@ DEFINE_STAT(STAT_PopcornFX_DrawCallsMeshCount);
 DEFINE_STAT(STAT_PopcornFX_DrawCallsSkelMeshCount);
 DEFINE_STAT(STAT_PopcornFX_DrawCallsDecalCount);
 DEFINE_STAT(STAT_PopcornFX_LightCount);
+DEFINE_STAT(STAT_PopcornFX_CulledLightCount);
+DEFINE_STAT(STAT_PopcornFX_CulledDecalCount);
 DEFINE_STAT(STAT_PopcornFX_SoundCount);
 DEFINE_STAT(STAT_PopcornFX_RayTracing_DrawCallsCount);
 DEFINE_STAT(STAT_PopcornFX_BatchesCount);
@@ -37,6 +41,8 @@ DEFINE_STAT(STAT_PopcornFX_MediumCount);
 DEFINE_STAT(STAT_PopcornFX_ActiveMediumCount);
 
 DEFINE_STAT(STAT_PopcornFX_BroadcastedEventsCount);
+DEFINE_STAT(STAT_PopcornFX_EmitterPoolHitCount);
+DEFINE_STAT(STAT_PopcornFX_EmitterPoolMissCount);
 
 DEFINE_STAT(STAT_PopcornFX_PopcornFXUpdateTime);
 DEFINE_STAT(STAT_PopcornFX_PreUpdateFenceTime);
@@ -62,3 +68,7 @@ DEFINE_STAT(STAT_PopcornFX_CulledDrawReqCount);
 
 DEFINE_STAT(STAT_PopcornFX_SkinningWaitTime);
 DEFINE_STAT(STAT_PopcornFX_FetchClothData);
+DEFINE_STAT(STAT_PopcornFX_SkinnedMeshCount);
+DEFINE_STAT(STAT_PopcornFX_SharedSkinningCount);
+DEFINE_STAT(STAT_PopcornFX_ImageDensityBuildCount);
+DEFINE_STAT(STAT_PopcornFX_ImageDensityReuseCount);
@@ -29,6 +29,8 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw calls"), STAT_PopcornFX_DrawCallCou
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Raytraced draw calls"), STAT_PopcornFX_RayTracing_DrawCallsCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Emitters updated"), STAT_PopcornFX_EmitterUpdateCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sound particles"), STAT_PopcornFX_SoundParticleCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sound particles (virtualized)"), STAT_PopcornFX_VirtualSoundCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Collisions: Cached rays"), STAT_PopcornFX_CachedRayCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawRequests"), STAT_PopcornFX_DrawRequestsCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawCalls"), STAT_PopcornFX_DrawCallsCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawCalls (Billboard)"), STAT_PopcornFX_DrawCallsBillboardCount, STATGROUP_PopcornFX, );
@@ -38,6 +40,8 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawCalls (Mesh)"), STAT_Popcorn
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawCalls (Skeletal Mesh)"), STAT_PopcornFX_DrawCallsSkelMeshCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: DrawCalls (Decal)"), STAT_PopcornFX_DrawCallsDecalCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Lights"), STAT_PopcornFX_LightCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Culled lights"), STAT_PopcornFX_CulledLightCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Culled decals"), STAT_PopcornFX_CulledDecalCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Sounds"), STAT_PopcornFX_SoundCount, STATGROUP_PopcornFX, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Batches"), STAT_PopcornFX_BatchesCount, STATGROUP_PopcornFX, );
 
@@ -45,6 +49,8 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PopcornFX Mediums"), STAT_PopcornFX_Medi
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PopcornFX Active Mediums"), STAT_PopcornFX_ActiveMediumCount, STATGROUP_PopcornFX, );
 
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Broadcasted events"), STAT_PopcornFX_BroadcastedEventsCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Emitter pool hits"), STAT_PopcornFX_EmitterPoolHitCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Emitter pool misses"), STAT_PopcornFX_EmitterPoolMissCount, STATGROUP_PopcornFX, );
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Update: PopcornFX update time"), STAT_PopcornFX_PopcornFXUpdateTime, STATGROUP_PopcornFX, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Update1: pre-UpdateFence"), STAT_PopcornFX_PreUpdateFenceTime, STATGROUP_PopcornFX, );
@@ -71,3 +77,7 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render: Culled drawReq count"), STAT_Pop
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Samplers: Skinning wait time"), STAT_PopcornFX_SkinningWaitTime, STATGROUP_PopcornFX, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Samplers: Fetch cloth data"), STAT_PopcornFX_FetchClothData, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Samplers: Skinned meshes"), STAT_PopcornFX_SkinnedMeshCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Samplers: Shared skinning reuses"), STAT_PopcornFX_SharedSkinningCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Samplers: Image density tables built"), STAT_PopcornFX_ImageDensityBuildCount, STATGROUP_PopcornFX, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Samplers: Image density tables reused"), STAT_PopcornFX_ImageDensityReuseCount, STATGROUP_PopcornFX, );
@@ -80,11 +80,33 @@ bool	CSoundDescriptor::Playing() const
 
 //----------------------------------------------------------------------------
 
-void	CSoundDescriptor::Update(SUpdateCtx &updCtx, const SSoundInsertDesc &insertDesc)
+UAudioComponent		*CSoundDescriptor::_CreateAudioComponent(SUpdateCtx &updCtx, const SSoundInsertDesc &insertDesc)
 {
-	UWorld				*world = updCtx.m_World;
-	USoundBase			*sound = updCtx.m_Sound;
+	UAudioComponent		*comp = null;
+#if (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
+	comp = UGameplayStatics::SpawnSoundAtLocation(updCtx.m_World, updCtx.m_Sound, insertDesc.m_Position, FRotator::ZeroRotator, 1.f, 1.f, 0.f, null, null, false);
+	if (!PK_VERIFY(comp != null))
+		return null;
+	comp->bStopWhenOwnerDestroyed = true;
+#else
+	FAudioDevice::FCreateComponentParams	params(updCtx.m_World);
+	params.bAutoDestroy = false;
+	params.bPlay = false;
+	params.bStopWhenOwnerDestroyed = true;
+	params.SetLocation(insertDesc.m_Position);
+	comp = FAudioDevice::CreateComponent(updCtx.m_Sound, params);
+	if (!PK_VERIFY(comp != null))
+		return null;
+#endif // (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
+	m_AudioComponent = comp;
+	m_LastPosition = insertDesc.m_Position;
+	return comp;
+}
+
+//----------------------------------------------------------------------------
 
+void	CSoundDescriptor::Update(SUpdateCtx &updCtx, const SSoundInsertDesc &insertDesc)
+{
 	m_UsedUpdateId = updCtx.m_CurrentUpdateId;
 
 	PK_ASSERT(m_SelfID == insertDesc.m_SelfID);
@@ -92,24 +114,9 @@ void	CSoundDescriptor::Update(SUpdateCtx &updCtx, const SSoundInsertDesc &insert
 	UAudioComponent		*comp = GetAudioComponentIFP();
 	if (comp == null)
 	{
-		// Create one
-#if (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
-		comp = UGameplayStatics::SpawnSoundAtLocation(updCtx.m_World, updCtx.m_Sound, insertDesc.m_Position, FRotator::ZeroRotator, 1.f, 1.f, 0.f, null, null, false);
-		if (!PK_VERIFY(comp != null))
+		comp = _CreateAudioComponent(updCtx, insertDesc);
+		if (comp == null)
 			return;
-		comp->bStopWhenOwnerDestroyed = true;
-		m_AudioComponent = comp;
-#else
-		FAudioDevice::FCreateComponentParams	params(updCtx.m_World);
-		params.bAutoDestroy = false;
-		params.bPlay = false;
-		params.bStopWhenOwnerDestroyed = true;
-		params.SetLocation(insertDesc.m_Position);
-		comp = FAudioDevice::CreateComponent(updCtx.m_Sound, params);
-		PK_ASSERT(comp != null);
-		m_AudioComponent = comp;
-		comp->Play(0);//insertDesc.m_Age);
-#endif // (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
 	}
 
 	if (m_LastPosition != insertDesc.m_Position)
@@ -123,7 +130,6 @@ void	CSoundDescriptor::Update(SUpdateCtx &updCtx, const SSoundInsertDesc &insert
 		comp->SetVolumeMultiplier(insertDesc.m_Volume);
 	}
 
-
 	bool	isPlaying = comp->IsPlaying();
 	// @TODO if playing access FActiveSound for faster seek without full re-setup ?
 	if (!isPlaying)
@@ -134,47 +140,26 @@ void	CSoundDescriptor::Update(SUpdateCtx &updCtx, const SSoundInsertDesc &insert
 
 void	CSoundDescriptor::Spawn(SUpdateCtx &updCtx, const SSoundInsertDesc &insertDesc)
 {
-	UWorld				*world = updCtx.m_World;
-	USoundBase			*sound = updCtx.m_Sound;
-
 	m_UsedUpdateId = updCtx.m_CurrentUpdateId;
 
 	m_SelfID = insertDesc.m_SelfID;
 
+	// Slots keep their audio component when unused or stolen: restart it for the new particle instead of creating a new one
 	UAudioComponent		*comp = GetAudioComponentIFP();
 	if (comp != null)
 	{
-		comp->ConditionalBeginDestroy();
-		comp = null;
-		m_AudioComponent = null;
+		if (comp->IsPlaying())
+			comp->Stop();
+		if (comp->Sound != updCtx.m_Sound)
+			comp->SetSound(updCtx.m_Sound);
+		m_LastPosition = insertDesc.m_Position;
+		comp->SetWorldLocation(m_LastPosition);
 	}
-
-	if (comp == null)
+	else
 	{
-		// Create one
-#if (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
-		comp = UGameplayStatics::SpawnSoundAtLocation(updCtx.m_World, updCtx.m_Sound, insertDesc.m_Position, FRotator::ZeroRotator, 1.f, 1.f, 0.f, null, null, false);
-		if (!PK_VERIFY(comp != null))
+		comp = _CreateAudioComponent(updCtx, insertDesc);
+		if (comp == null)
 			return;
-		comp->bStopWhenOwnerDestroyed = true;
-		m_AudioComponent = comp;
-#else
-		FAudioDevice::FCreateComponentParams	params(updCtx.m_World);
-		params.bAutoDestroy = false;
-		params.bPlay = false;
-		params.bStopWhenOwnerDestroyed = true;
-		params.SetLocation(insertDesc.m_Position);
-		comp = FAudioDevice::CreateComponent(updCtx.m_Sound, params);
-		PK_ASSERT(comp != null);
-		m_AudioComponent = comp;
-		comp->Play(0/*m_LastAge*/);
-#endif // (PK_SPAWN_SOUNDS_WITH_GAMEPLAYSTATICS != 0)
-	}
-
-	if (m_LastPosition != insertDesc.m_Position)
-	{
-		m_LastPosition = insertDesc.m_Position;
-		comp->SetWorldLocation(m_LastPosition);
 	}
 
 	if (comp->VolumeMultiplier != insertDesc.m_Volume)
@@ -182,12 +167,7 @@ void	CSoundDescriptor::Spawn(SUpdateCtx &updCtx, const SSoundInsertDesc &insertD
 		comp->SetVolumeMultiplier(insertDesc.m_Volume);
 	}
 
-	bool	isPlaying = comp->IsPlaying();
-	// @TODO if playing access FActiveSound for faster seek without full re-setup ?
-	if (!isPlaying)
-	{
-		comp->Play(0/*m_LastAge*/);
-	}
+	comp->Play(0/*m_LastAge*/);
 }
 
 //----------------------------------------------------------------------------
@@ -226,6 +206,10 @@ void	CSoundDescriptorPool::Clear()
 {
 	for (u32 i = 0, slotCount = m_Slots.Count(); i < slotCount; ++i)
 		m_Slots[i].Clear();
+	m_SlotIndices.Reset();
+	m_Inserted.Clear();
+	m_ToSpawn.Clear();
+	m_LastUpdatedSlotCount = 0;
 	m_SoundsPlaying = 0;
 }
 
@@ -264,59 +248,53 @@ bool	CSoundDescriptorPool::Setup(CSoundDescriptorPoolCollection *poolCollection,
 void	CSoundDescriptorPool::BeginInsert(UWorld *world)
 {
 	m_SoundsPlaying = 0;
+	m_Sound = GetOrLoadSound();
+	PK_ASSERT(m_Inserted.Empty());
 }
 
 //----------------------------------------------------------------------------
 
 void	CSoundDescriptorPool::InsertSoundIFP(const SSoundInsertDesc &insertDesc)
 {
-	UWorld			*world = m_PoolCollection->World();
-	const uint32	currentUpdateId = m_PoolCollection->CurrentUpdateId();
+	// Voices are assigned in EndInsert, once the collection resolved its voice budget
+	if (m_Sound != null)
+		m_Inserted.PushBack(insertDesc);
+}
 
-	USoundBase		*sound = GetOrLoadSound();
-	if (!PK_VERIFY(sound != null))
+//----------------------------------------------------------------------------
+
+void	CSoundDescriptorPool::EndInsert(UWorld *world, SSoundVoiceBudget &budget)
+{
+	PK_ASSERT(world == m_PoolCollection->World());
+
+	const uint32					currentUpdateId = m_PoolCollection->CurrentUpdateId();
+	USoundBase						*sound = m_Sound;
+	CSoundDescriptor::SUpdateCtx	updCtx(currentUpdateId, world, sound);
+
+	if (sound == null)
 	{
+		PK_ASSERT(m_Inserted.Empty());
 		Clear();
 		return;
 	}
 
-	CSoundDescriptor::SUpdateCtx	updCtx(currentUpdateId, world, sound);
-	PK_ASSERT(m_LastUpdatedSlotCount <= m_Slots.Count());
-	bool	spawnLater = true;
-	if (m_SoundsPlaying < m_Slots.Count())
+	// Sounds that already had a voice last frame keep it, others are spawned below in free slots
+	for (u32 inserti = 0; inserti < m_Inserted.Count(); ++inserti)
 	{
-		PopcornFX::CGuid	slot;
-		const CInt2			insertSelfID = insertDesc.m_SelfID;
-		for (u32 i = 0; i < m_LastUpdatedSlotCount; ++i)
-		{
-			const CSoundDescriptor		&sd = m_Slots[i];
-			if (sd.SelfID() != insertSelfID)
-				continue;
-			slot = i;
-			break;
-		}
-		if (slot.Valid())
+		const SSoundInsertDesc	&insertDesc = m_Inserted[inserti];
+		if (!budget.Accept(insertDesc.m_Priority))
+			continue; // Virtualized: its voice, if any, gets stolen or stopped below
+
+		const u32	*slot = m_SlotIndices.Find(_SlotKey(insertDesc.m_SelfID));
+		if (slot != null && !m_Slots[*slot].UsedThisUpdate(currentUpdateId))
 		{
 			m_SoundsPlaying++;
-			m_Slots[slot].Update(updCtx, insertDesc);
-			spawnLater = false;
+			m_Slots[*slot].Update(updCtx, insertDesc);
 		}
+		else
+			m_ToSpawn.PushBack(insertDesc);
 	}
-	if (spawnLater)
-	{
-		m_ToSpawn.PushBack(insertDesc);
-	}
-}
-
-//----------------------------------------------------------------------------
-
-void	CSoundDescriptorPool::EndInsert(UWorld *world)
-{
-	PK_ASSERT(world == m_PoolCollection->World());
-
-	const uint32					currentUpdateId = m_PoolCollection->CurrentUpdateId();
-	USoundBase						*sound = GetOrLoadSound();
-	CSoundDescriptor::SUpdateCtx	updCtx(currentUpdateId, world, sound);
+	m_Inserted.Clear();
 
 	u32					tospawni = 0;
 
@@ -332,7 +310,7 @@ void	CSoundDescriptorPool::EndInsert(UWorld *world)
 			lastUsed = i;
 			continue;
 		}
-		if (sound != null && tospawni < m_ToSpawn.Count())
+		if (tospawni < m_ToSpawn.Count())
 		{
 			sd.Spawn(updCtx, m_ToSpawn[tospawni]);
 			++m_SoundsPlaying;
@@ -345,19 +323,23 @@ void	CSoundDescriptorPool::EndInsert(UWorld *world)
 		}
 	}
 	// new sounds:
-	if (sound != null && tospawni < m_ToSpawn.Count())
+	if (tospawni < m_ToSpawn.Count())
 	{
 		const u32	remainingToSpawnCount = m_ToSpawn.Count() - tospawni;
 		const u32	finalCount = i + remainingToSpawnCount;
 		if (m_Slots.Count() < finalCount)
 		{
 			if (!PK_VERIFY(m_Slots.Resize(finalCount)))
+			{
+				m_ToSpawn.Clear();
 				return;
+			}
 		}
 		for (; tospawni < m_ToSpawn.Count(); ++i)
 		{
 			CSoundDescriptor	&sd = m_Slots[i];
 			sd.Spawn(updCtx, m_ToSpawn[tospawni]);
+			++m_SoundsPlaying;
 			++tospawni;
 			lastUsed = i;
 		}
@@ -365,6 +347,14 @@ void	CSoundDescriptorPool::EndInsert(UWorld *world)
 
 	m_LastUpdatedSlotCount = lastUsed.Valid() ? u32(lastUsed) + 1U : 0U;
 
+	// Rebuild the SelfID -> slot map for next frame's lookups
+	m_SlotIndices.Reset();
+	for (u32 sloti = 0; sloti < m_LastUpdatedSlotCount; ++sloti)
+	{
+		if (m_Slots[sloti].UsedThisUpdate(currentUpdateId))
+			m_SlotIndices.Add(_SlotKey(m_Slots[sloti].SelfID()), sloti);
+	}
+
 	INC_DWORD_STAT_BY(STAT_PopcornFX_SoundParticleCount, m_SoundsPlaying);
 
 	m_ToSpawn.Clear();
@@ -399,11 +389,37 @@ void	CSoundDescriptorPoolCollection::BeginInsert(UWorld *world)
 
 //----------------------------------------------------------------------------
 
-void	CSoundDescriptorPoolCollection::EndInsert(UWorld *world)
+void	CSoundDescriptorPoolCollection::EndInsert(UWorld *world, u32 maxVoices)
 {
 	PK_ASSERT(m_World == world);
+
+	// Over budget: only the highest priority sounds get a voice
+	SSoundVoiceBudget	budget;
+	u32					insertedCount = 0;
+	for (u32 i = 0; i < m_Pools.Count(); ++i)
+		insertedCount += m_Pools[i].Inserted().Count();
+	if (maxVoices > 0 && insertedCount > maxVoices)
+	{
+		TArray<float>	sortedPriorities;
+		sortedPriorities.Reserve(insertedCount);
+		for (u32 i = 0; i < m_Pools.Count(); ++i)
+		{
+			const PopcornFX::TArray<SSoundInsertDesc>	&inserted = m_Pools[i].Inserted();
+			for (u32 inserti = 0; inserti < inserted.Count(); ++inserti)
+				sortedPriorities.Add(inserted[inserti].m_Priority);
+		}
+		sortedPriorities.Sort(TGreater<float>());
+
+		budget.m_MinPriority = sortedPriorities[maxVoices - 1];
+		budget.m_MinPriorityVoiceCount = maxVoices;
+		while (budget.m_MinPriorityVoiceCount > 0 && sortedPriorities[maxVoices - budget.m_MinPriorityVoiceCount] > budget.m_MinPriority)
+			--budget.m_MinPriorityVoiceCount;
+
+		INC_DWORD_STAT_BY(STAT_PopcornFX_VirtualSoundCount, insertedCount - maxVoices);
+	}
+
 	for (u32 i = 0; i < m_Pools.Count(); ++i)
-		m_Pools[i].EndInsert(world);
+		m_Pools[i].EndInsert(world, budget);
 }
 
 //----------------------------------------------------------------------------
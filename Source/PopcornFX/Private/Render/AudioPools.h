@@ -26,6 +26,24 @@ struct	SSoundInsertDesc
 	float		m_DopplerLevel;
 	float		m_Volume;
 	bool		m_Audible;
+	float		m_Priority;	// Used to pick which sounds get a voice when over budget, inaudible sounds should have the lowest
+};
+
+// Priority threshold resolved by CSoundDescriptorPoolCollection::EndInsert, sounds it rejects are virtualized (no voice)
+struct	SSoundVoiceBudget
+{
+	float		m_MinPriority = TNumericLimits<float>::Lowest();
+	u32			m_MinPriorityVoiceCount = TNumericLimits<u32>::Max();	// Voices left for sounds with exactly m_MinPriority
+
+	bool		Accept(float priority)
+	{
+		if (priority > m_MinPriority)
+			return true;
+		if (priority < m_MinPriority || m_MinPriorityVoiceCount == 0)
+			return false;
+		--m_MinPriorityVoiceCount;
+		return true;
+	}
 };
 
 class	CSoundDescriptor
@@ -63,6 +81,7 @@ public:
 
 private:
 	UAudioComponent		*GetAudioComponentIFP() const;
+	UAudioComponent		*_CreateAudioComponent(SUpdateCtx &updCtx, const SSoundInsertDesc &insertDesc);
 
 private:
 	CInt2		m_SelfID = CInt2(0);
@@ -85,10 +104,16 @@ public:
 
 	void			BeginInsert(UWorld *world);
 	void			InsertSoundIFP(const SSoundInsertDesc &insertDesc);
-	void			EndInsert(UWorld *world);
+	void			EndInsert(UWorld *world, SSoundVoiceBudget &budget);
+
+	const PopcornFX::TArray<SSoundInsertDesc>	&Inserted() const { return m_Inserted; }
+
+private:
+	static u64		_SlotKey(const CInt2 &selfID) { return (u64(u32(selfID.x())) << 32) | u64(u32(selfID.y())); }
 
 private:
 	CSoundDescriptorPoolCollection		*m_PoolCollection = null;
+	USoundBase							*m_Sound = null; // Resolved once per frame in BeginInsert
 
 	u32			m_SoundsPlaying = 0;
 	u32			m_LastUpdatedSlotCount = 0;
@@ -99,6 +124,8 @@ private:
 	double		m_MaxDeltaPlaying = 0.0;
 
 	PopcornFX::TArray<CSoundDescriptor>		m_Slots;
+	TMap<u64, u32>							m_SlotIndices;	// SelfID -> slot of the sounds updated last frame
+	PopcornFX::TArray<SSoundInsertDesc>		m_Inserted;
 	PopcornFX::TArray<SSoundInsertDesc>		m_ToSpawn;
 };
 
@@ -117,7 +144,8 @@ public:
 	UWorld	*World() const { return m_World; }
 
 	void	BeginInsert(UWorld *world);
-	void	EndInsert(UWorld *world);
+	// 'maxVoices': maximum sounds playing across all pools of the collection (0 = unlimited)
+	void	EndInsert(UWorld *world, u32 maxVoices);
 
 private:
 	uint32		m_CurrentUpdateId = 0;
@@ -14,6 +14,7 @@
 #include "Assets/PopcornFXRendererMaterial.h"
 #include "Render/PopcornFXVertexFactory.h"
 #include "Render/PopcornFXVertexFactoryCommon.h"
+#include "Render/SimulationCacheRecorder.h"
 #include "PopcornFXStats.h"
 
 #include <pk_render_helpers/include/render_features/rh_features_basic.h>
@@ -773,7 +774,39 @@ bool	CBatchDrawer_Billboard_CPUBB::EmitDrawCall(PopcornFX::SRenderContext &ctx,
 #endif // WITH_EDITOR
 
 	_IssueDrawCall_Billboard(renderContext, toEmit);
+
+	if (FPopcornFXSimulationCacheRecorder::RenderThread_HasRecorders())
+		_RecordSimulationCache(renderContext, toEmit);
 	return true;
 }
 
 //----------------------------------------------------------------------------
+
+void	CBatchDrawer_Billboard_CPUBB::_RecordSimulationCache(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc)
+{
+	const CParticleScene	*scene = &renderContext.m_RenderBatchManager->ParticleScene();
+	const u32	drCount = desc.m_DrawRequests.Count();
+	const u32	rendererCacheCount = desc.m_RendererCaches.Count();
+	for (u32 iDr = 0; iDr < drCount; ++iDr)
+	{
+		const PopcornFX::Drawers::SBillboard_DrawRequest			*dr = static_cast<const PopcornFX::Drawers::SBillboard_DrawRequest*>(desc.m_DrawRequests[iDr]);
+		const PopcornFX::Drawers::SBillboard_BillboardingRequest	&br = dr->m_BB;
+		const PopcornFX::CParticleStreamToRender_MainMemory			*lockedStream = dr->StreamToRender_MainMemory();
+		const CRendererCache										*matCache = static_cast<const CRendererCache*>((iDr < rendererCacheCount ? desc.m_RendererCaches[iDr] : desc.m_RendererCaches.First()).Get());
+		if (lockedStream == null || matCache == null)
+			continue;
+
+		FPopcornFXSimulationCacheRecorder::SStreamIds	streamIds;
+		streamIds.m_Positions = br.m_PositionStreamId;
+		streamIds.m_Sizes = br.m_SizeStreamId;
+		streamIds.m_Rotations = br.m_RotationStreamId;
+		streamIds.m_Enabled = br.m_EnabledStreamId;
+		const SStreamOffset	&colorsOffset = m_AdditionalStreamOffsets[StreamOffset_Colors];
+		if (colorsOffset.m_ValidInputId && colorsOffset.m_InputId < br.m_AdditionalInputs.Count())
+			streamIds.m_Colors = br.m_AdditionalInputs[colorsOffset.m_InputId].m_StreamId;
+
+		FPopcornFXSimulationCacheRecorder::RenderThread_Capture(scene, matCache->RenderThread_Desc().m_Renderer.Get(), *lockedStream, streamIds);
+	}
+}
+
+//----------------------------------------------------------------------------
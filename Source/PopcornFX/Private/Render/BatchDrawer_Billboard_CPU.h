@@ -72,6 +72,7 @@ public:
 
 private:
 	void		_IssueDrawCall_Billboard(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc);
+	void		_RecordSimulationCache(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc);
 	bool		_IsAdditionalInputSupported(const PopcornFX::CStringId& fieldName, PopcornFX::EBaseTypeID type, EPopcornFXAdditionalStreamOffsets& outStreamOffsetType);
 
 	void		_ClearBuffers();
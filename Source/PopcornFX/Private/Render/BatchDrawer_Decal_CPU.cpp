@@ -194,40 +194,51 @@ void CBatchDrawer_Decal_CPUBB::_GetDecalStreams(SDecalStreams &outStreams, const
 
 //----------------------------------------------------------------------------
 
-void CBatchDrawer_Decal_CPUBB::_BuildDecalUpdates(const SDecalStreams &ds, u32 pcount, float globalScale)
+void CBatchDrawer_Decal_CPUBB::_BuildDecalCandidates(const SDecalStreams &ds, u32 pcount, float globalScale, const SDecalCulling &culling, u32 &outCulledCount)
 {
-	const UPopcornFXSceneComponent				*sceneComp			= m_WeakSceneComp.Get();
-	CParticleScene								*scene				= sceneComp->ParticleScene();
-	TArray<FDeferredDecalUpdateParams>			&decalUpdates		= scene->DecalUpdates();
-	TPair<u32, TArray<FDeferredDecalProxy*>>	&activeDecals		= scene->ActiveDecals(this);
-	u32											&activeDecalCounter	= activeDecals.Key;
-	TArray<FDeferredDecalProxy*>				&activeDecalProxies	= activeDecals.Value;
-
+	CParticleScene								*scene			= m_WeakSceneComp.Get()->ParticleScene();
+	TArray<CParticleScene::SDecalCandidate>		&candidates		= scene->DecalCandidates();
+	const TArray<FConvexVolume>					&frustums		= scene->UpdateViewFrustums();
+	const TArray<FVector>						&viewOrigins	= scene->UpdateViewOrigins();
+	const u32									viewCount		= (u32)viewOrigins.Num();
+	PK_ASSERT(frustums.Num() == viewOrigins.Num());
+
+	// Rotation has offset in Y because decals face up in PK and right in UE by default
+	const FQuat		rotOffset		= FQuat::MakeFromEuler({ 0, -90, 0 });
+	const FQuat		rotOffsetInv	= rotOffset.Inverse();
+
+	candidates.Reserve(candidates.Num() + pcount);
 	for (u32 parti = 0; parti < pcount; ++parti)
 	{
 		if (!ds.enableds[parti])
 			continue;
 
-		// Create Update Parameters
-		FDeferredDecalUpdateParams	&updateParams = decalUpdates.AddDefaulted_GetRef();
-		if (activeDecalCounter < (u32)activeDecalProxies.Num())
-		{
-			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::Update;
-			updateParams.DecalProxy = activeDecalProxies[activeDecalCounter];
-		}
-		else
+		const FVector	position	= FVector(ToUE(ds.positions[parti] * globalScale));
+		const FVector	scale		= rotOffsetInv * (ds.isScaleFloat3 ? FVector(ToUE(ds.scalesF3[parti])) : FVector(ds.scalesF1[parti])) * globalScale;
+		const double	radius		= scale.GetAbsMax() * 2.0;
+
+		// Cull against views, importance is the decal size relative to its distance to the closest view
+		float			importance = float(radius);
+		if (viewCount > 0)
 		{
-			updateParams.OperationType = FDeferredDecalUpdateParams::EOperationType::AddToSceneAndUpdate;
-			updateParams.DecalProxy = new FDeferredDecalProxy(sceneComp, m_WeakMaterial.Get());
-			activeDecalProxies.Push(updateParams.DecalProxy);
+			double	minDistanceSq = TNumericLimits<double>::Max();
+			bool	visible = !culling.m_FrustumCulling;
+			for (u32 viewi = 0; viewi < viewCount; ++viewi)
+			{
+				minDistanceSq = FMath::Min(minDistanceSq, FVector::DistSquared(position, viewOrigins[viewi]));
+				if (!visible)
+					visible = frustums[viewi].IntersectSphere(position, radius);
+			}
+			const double	distance = FMath::Sqrt(minDistanceSq);
+			if (!visible || (culling.m_MaxDistance > 0.0 && distance - radius > culling.m_MaxDistance))
+			{
+				++outCulledCount;
+				continue;
+			}
+			importance = float(radius / FMath::Max(distance, radius));
 		}
-		++activeDecalCounter;
 
-		// Rotation has offset in Y because decals face up in PK and right in UE by default
-		const FQuat		rotOffset	= FQuat::MakeFromEuler({ 0, -90, 0 });
 		const FQuat		rotation	= FQuat(ToUE(ds.orientations[parti])) * rotOffset;
-		const FVector	position	= FVector(ToUE(ds.positions[parti] * globalScale));
-		const FVector	scale		= rotOffset.Inverse() * (ds.isScaleFloat3 ? FVector(ToUE(ds.scalesF3[parti])) : FVector(ds.scalesF1[parti])) * globalScale;
 		const CFloat4	diffuse		= !ds.colorsDiffuse.Empty() ? ds.colorsDiffuse[parti] : CFloat4::ZERO;
 		const CFloat3	emissive	= !ds.colorsEmissive.Empty() ? ds.colorsEmissive[parti].xyz() * ds.colorsEmissive[parti].w() // Bake emissive alpha into RGB values
 									: (!ds.colorsEmissiveLegacy.Empty() ? ds.colorsEmissiveLegacy[parti] : CFloat3::ZERO);
@@ -246,26 +257,29 @@ void CBatchDrawer_Decal_CPUBB::_BuildDecalUpdates(const SDecalStreams &ds, u32 p
 		const u32	packedEmissiveRG			= (emissiveRG.X.Encoded & 0xFFFFFFFF) | (emissiveRG.Y.Encoded << 16);
 		const u32	packedEmissiveB_AlphaRemap	= (emissiveB_AlphaRemap.X.Encoded & 0xFFFFFFFF) | (emissiveB_AlphaRemap.Y.Encoded << 16);
 
-		// Store all additionnal inputs in an UE color
-		FLinearColor colorStored = FLinearColor(FGenericPlatformMath::AsFloat(packedDiffuse),
-												FGenericPlatformMath::AsFloat(packedEmissiveRG),
-												FGenericPlatformMath::AsFloat(packedEmissiveB_AlphaRemap),
-												atlasTextureID);
-
 		// Set decal parameters, and send all additional inputs through DecalColor
-		updateParams.Transform = FTransform(rotation, position, scale);
-		updateParams.Bounds = FBoxSphereBounds(FSphere(position, scale.GetAbsMax() * 2.0));
-		updateParams.AbsSpawnTime = 0;
-		updateParams.FadeStartDelay = 0;
-		updateParams.FadeDuration = 0;
-		updateParams.FadeScreenSize = 0.01f;
-		updateParams.DecalColor = colorStored;
-		updateParams.SortOrder = 0;
+		CParticleScene::SDecalCandidate	&candidate = candidates.AddDefaulted_GetRef();
+		candidate.m_Drawer = this;
+		candidate.m_Importance = importance;
+		candidate.m_Transform = FTransform(rotation, position, scale);
+		candidate.m_Bounds = FBoxSphereBounds(FSphere(position, radius));
+		candidate.m_Color = FLinearColor(	FGenericPlatformMath::AsFloat(packedDiffuse),
+											FGenericPlatformMath::AsFloat(packedEmissiveRG),
+											FGenericPlatformMath::AsFloat(packedEmissiveB_AlphaRemap),
+											atlasTextureID);
 	}
 }
 
 //----------------------------------------------------------------------------
 
+FDeferredDecalProxy	*CBatchDrawer_Decal_CPUBB::NewDecalProxy() const
+{
+	PK_ASSERT(m_WeakSceneComp.IsValid());
+	return new FDeferredDecalProxy(m_WeakSceneComp.Get(), m_WeakMaterial.Get());
+}
+
+//----------------------------------------------------------------------------
+
 void	CBatchDrawer_Decal_CPUBB::_IssueDrawCall_Decal(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc)
 {
 	PK_NAMEDSCOPEDPROFILE("CRenderBatchPolicy::IssueDrawCall_Decal");
@@ -288,7 +302,13 @@ void	CBatchDrawer_Decal_CPUBB::_IssueDrawCall_Decal(const SUERenderContext &rend
 	if (!PK_VERIFY(m_WeakSceneComp.IsValid()))
 		return;
 
-	// Generate the list of decals to update
+	const FPopcornFXRenderSettings	&renderSettings = m_WeakSceneComp->ResolvedRenderSettings();
+	SDecalCulling					culling;
+	culling.m_FrustumCulling = renderSettings.bEnableDecalsCulling != 0;
+	culling.m_MaxDistance = FMath::Max(renderSettings.DecalsCullDistance, 0.0f);
+	u32								culledCount = 0;
+
+	// Generate the list of decals to submit, proxies are assigned by the scene once all decal drawers ran
 	const u32	drCount = desc.m_DrawRequests.Count();
 	for (u32 iDr = 0; iDr < drCount; ++iDr)
 	{
@@ -317,11 +337,12 @@ void	CBatchDrawer_Decal_CPUBB::_IssueDrawCall_Decal(const SUERenderContext &rend
 			// Get streams for the current page and create decal updates with per-particle values
 			SDecalStreams decalStreams;
 			_GetDecalStreams(decalStreams, bbRequest, page, pcount);
-			_BuildDecalUpdates(decalStreams, pcount, globalScale);
+			_BuildDecalCandidates(decalStreams, pcount, globalScale, culling, culledCount);
 		}
 	}
 
 	INC_DWORD_STAT_BY(STAT_PopcornFX_DrawCallsDecalCount, totalParticleCount);
+	INC_DWORD_STAT_BY(STAT_PopcornFX_CulledDecalCount, culledCount);
 }
 
 //----------------------------------------------------------------------------
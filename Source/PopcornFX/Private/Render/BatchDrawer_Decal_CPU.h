@@ -43,6 +43,9 @@ public:
 	virtual void	BeginFrame(PopcornFX::SRenderContext &ctx) override;
 	virtual bool	EmitDrawCall(PopcornFX::SRenderContext &ctx, const PopcornFX::SDrawCallDesc &toEmit) override;
 
+	// Called by the particle scene when this drawer's decal proxy pool needs to grow
+	FDeferredDecalProxy	*NewDecalProxy() const;
+
 private:
 	struct	SDecalStreams
 	{
@@ -69,7 +72,13 @@ private:
 	void	_GetDecalStreams(	SDecalStreams &outStreams, const PopcornFX::Drawers::SDecal_BillboardingRequest &bbRequest, 
 								const PopcornFX::CParticlePageToRender_MainMemory *page, u32 pcount);
 
-	void	_BuildDecalUpdates(const SDecalStreams &ds, u32 pcount, float globalScale);
+	struct	SDecalCulling
+	{
+		bool	m_FrustumCulling = true;
+		double	m_MaxDistance = 0.0; // UE units, 0: no distance culling
+	};
+
+	void	_BuildDecalCandidates(const SDecalStreams &ds, u32 pcount, float globalScale, const SDecalCulling &culling, u32 &outCulledCount);
 
 	void	_IssueDrawCall_Decal(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc);
 
@@ -5,6 +5,8 @@
 
 #include "BatchDrawer_Light.h"
 #include "RenderBatchManager.h"
+#include "Render/ViewCuller.h"
+#include "Render/SimulationCacheRecorder.h"
 #include "MaterialDesc.h"
 
 #include "Assets/PopcornFXRendererMaterial.h"
@@ -16,6 +18,38 @@
 
 //----------------------------------------------------------------------------
 
+namespace
+{
+	// Lights selected last frame found in the same cell get their importance scaled by this (UE units)
+	static const float	kSelectedLightCellSize = 100.0f;
+	static const float	kSelectedLightImportanceBonus = 1.5f;
+
+	u64		_LightCell(const FVector &position)
+	{
+		const u64	x = u64(FMath::FloorToInt64(position.X / kSelectedLightCellSize)) & 0x1FFFFF;
+		const u64	y = u64(FMath::FloorToInt64(position.Y / kSelectedLightCellSize)) & 0x1FFFFF;
+		const u64	z = u64(FMath::FloorToInt64(position.Z / kSelectedLightCellSize)) & 0x1FFFFF;
+		return (x << 42) | (y << 21) | z;
+	}
+
+	// radius x intensity, attenuated by the distance to the closest view (1 when the view is inside the light)
+	float	_LightImportance(const FVector &position, float radius, const FLinearColor &color, const FVector *viewOrigins, u32 viewCount)
+	{
+		double	minDistanceSq = 0.0;
+		if (viewCount > 0)
+		{
+			minDistanceSq = TNumericLimits<double>::Max();
+			for (u32 viewi = 0; viewi < viewCount; ++viewi)
+				minDistanceSq = FMath::Min(minDistanceSq, FVector::DistSquared(position, viewOrigins[viewi]));
+		}
+		const float	distance = float(FMath::Sqrt(minDistanceSq));
+		const float	attenuation = radius / FMath::Max(distance, radius);
+		return radius * color.GetLuminance() * attenuation;
+	}
+} // namespace
+
+//----------------------------------------------------------------------------
+
 CBatchDrawer_Light::CBatchDrawer_Light()
 {
 }
@@ -103,6 +137,36 @@ void	CBatchDrawer_Light::_IssueDrawCall_Light(const SUERenderContext &renderCont
 
 	const bool		forceLitTranslucentGeometry = renderContext.m_RenderBatchManager->ForceLightsTranslucent();
 
+	// Culling & budget
+	const CViewCuller	&viewCuller = renderContext.m_RenderBatchManager->RenderThread_ViewCuller();
+	const bool			cullLights = renderContext.m_RenderBatchManager->RenderThread_LightsCulling() && !viewCuller.Empty();
+	const u32			maxLightsPerRenderer = renderContext.m_RenderBatchManager->RenderThread_MaxLightsPerRenderer();
+	const bool			computeImportances = maxLightsPerRenderer > 0 || renderContext.m_RenderBatchManager->RenderThread_MaxLights() > 0;
+	const TSet<u64>		&selectedLightCells = renderContext.m_CollectedDrawCalls->m_SelectedLightCells;
+	PopcornFX::TArray<float>	&lightImportances = renderContext.m_CollectedDrawCalls->m_LightImportances;
+	PK_ASSERT(!computeImportances || lightImportances.Count() == lightPositions.Count());
+	if (computeImportances && !lightImportances.Reserve(lightImportances.Count() + totalParticleCount))
+	{
+		PK_ASSERT_NOT_REACHED();
+		return;
+	}
+
+	FVector			viewOrigins[CRendererSubView::kMaxViews];
+	u32				viewCount = 0;
+	if (computeImportances)
+	{
+		const auto	&sceneViews = view->SceneViews();
+		for (u32 viewi = 0; viewi < sceneViews.Count(); ++viewi)
+		{
+			if (sceneViews[viewi].m_ToRender && sceneViews[viewi].m_SceneView != null)
+				viewOrigins[viewCount++] = sceneViews[viewi].m_SceneView->ViewMatrices.GetViewOrigin();
+		}
+	}
+	const float		rcpGlobalScale = 1.0f / globalScale;
+	u32				culledLightCount = 0;
+
+	// All draw requests of the batch share the renderer budget
+	const u32	firstLight = lightPositions.Count();
 	const u32	drCount = desc.m_DrawRequests.Count();
 	for (u32 iDr = 0; iDr < drCount; ++iDr)
 	{
@@ -111,14 +175,12 @@ void	CBatchDrawer_Light::_IssueDrawCall_Light(const SUERenderContext &renderCont
 		if (drawRequest.StorageClass() != PopcornFX::CParticleStorageManager_MainMemory::DefaultStorageClass())
 		{
 			PK_ASSERT_NOT_REACHED();
-			return;
+			break;
 		}
 
-		PK_TODO("renderManager->CullTest");
-
 		const PopcornFX::CParticleStreamToRender_MainMemory	*lockedStream = drawRequest.StreamToRender_MainMemory();
 		if (!PK_VERIFY(lockedStream != null)) // Light particles shouldn't handle GPU streams for now
-			return;
+			break;
 
 		const PopcornFX::CGuid	volScatteringIntensityStreamId = bbRequest.StreamId(PopcornFX::CStringId("AffectsVolumetricFog.VolumetricScatteringIntensity")); // tmp
 
@@ -186,6 +248,14 @@ void	CBatchDrawer_Light::_IssueDrawCall_Light(const SUERenderContext &renderCont
 				const float					radius = sizes[parti] * globalScale * kLightRadiusMultiplier;
 				if (radius < kMinLightSize)
 					continue;
+
+				// Light does not reach any view: it can't lit anything visible
+				if (cullLights && viewCuller.ViewMask(positions[parti], radius * rcpGlobalScale) == 0)
+				{
+					++culledLightCount;
+					continue;
+				}
+
 				PopcornFX::CGuid			lposi = lightPositions.PushBack();
 				FSimpleLightPerViewEntry	&lightpos = lightPositions[lposi];
 				lightpos.Position = FVector(ToUE(positions[parti] * globalScale));
@@ -195,6 +265,15 @@ void	CBatchDrawer_Light::_IssueDrawCall_Light(const SUERenderContext &renderCont
 				lightdata.Color = ToUE(colors[parti] * kColorMultiplier);
 				lightdata.Radius = radius;
 
+				if (computeImportances)
+				{
+					const CFloat3	color = colors[parti];
+					float			importance = _LightImportance(lightpos.Position, radius, FLinearColor(color.x(), color.y(), color.z()), viewOrigins, viewCount);
+					if (selectedLightCells.Contains(_LightCell(lightpos.Position)))
+						importance *= kSelectedLightImportanceBonus;
+					lightImportances.PushBack(importance);
+				}
+
 				// Set the exponent to 0 if we want to enable inverse squared falloff
 				// Note:
 				//		- Radius will now represent the falloff's clamped area
@@ -207,7 +286,78 @@ void	CBatchDrawer_Light::_IssueDrawCall_Light(const SUERenderContext &renderCont
 			}
 		}
 	}
-	INC_DWORD_STAT_BY(STAT_PopcornFX_LightCount, totalParticleCount);
+
+	// Per renderer budget, the per scene budget is applied once all lights are collected
+	if (maxLightsPerRenderer > 0)
+		SelectLights(*renderContext.m_CollectedDrawCalls, firstLight, maxLightsPerRenderer, false);
+	INC_DWORD_STAT_BY(STAT_PopcornFX_CulledLightCount, culledLightCount);
+}
+
+//----------------------------------------------------------------------------
+
+void	CBatchDrawer_Light::SelectLights(SCollectedDrawCalls &lights, u32 first, u32 budget, bool rememberSelection)
+{
+	PK_NAMEDSCOPEDPROFILE("CBatchDrawer_Light::SelectLights");
+
+	PopcornFX::TArray<FSimpleLightPerViewEntry>	&lightPositions = lights.m_LightPositions;
+	PopcornFX::TArray<FSimpleLightEntry>		&lightDatas = lights.m_LightDatas;
+	PopcornFX::TArray<float>					&lightImportances = lights.m_LightImportances;
+	const u32									end = lightPositions.Count();
+	PK_ASSERT(lightDatas.Count() == end);
+	PK_ASSERT(first <= end);
+
+	const bool	hasImportances = lightImportances.Count() == end && end > 0;
+	if (budget > 0 && hasImportances && end - first > budget)
+	{
+		// Importance of the last kept light
+		::TArray<float>		sortedImportances;
+		sortedImportances.Append(&lightImportances[first], end - first);
+		sortedImportances.Sort(TGreater<float>());
+		const float			threshold = sortedImportances[budget - 1];
+		u32					aboveThresholdCount = 0;
+		while (aboveThresholdCount < budget && sortedImportances[aboveThresholdCount] > threshold)
+			++aboveThresholdCount;
+
+		// Compact in place, keeps the submission order stable. Ties are resolved by order.
+		u32		equalToThresholdBudget = budget - aboveThresholdCount;
+		u32		dsti = first;
+		for (u32 srci = first; srci < end; ++srci)
+		{
+			const float	importance = lightImportances[srci];
+			if (importance < threshold)
+				continue;
+			if (importance == threshold)
+			{
+				if (equalToThresholdBudget == 0)
+					continue;
+				--equalToThresholdBudget;
+			}
+			if (dsti != srci)
+			{
+				lightPositions[dsti] = lightPositions[srci];
+				lightDatas[dsti] = lightDatas[srci];
+				lightImportances[dsti] = lightImportances[srci];
+			}
+			++dsti;
+		}
+		PK_ASSERT(dsti == first + budget);
+		INC_DWORD_STAT_BY(STAT_PopcornFX_CulledLightCount, end - dsti);
+		lightPositions.Resize(dsti);
+		lightDatas.Resize(dsti);
+		lightImportances.Resize(dsti);
+	}
+
+	if (rememberSelection)
+	{
+		INC_DWORD_STAT_BY(STAT_PopcornFX_LightCount, lightPositions.Count());
+
+		lights.m_SelectedLightCells.Reset();
+		if (hasImportances)
+		{
+			for (u32 lighti = 0; lighti < lightPositions.Count(); ++lighti)
+				lights.m_SelectedLightCells.Add(_LightCell(lightPositions[lighti].Position));
+		}
+	}
 }
 
 //----------------------------------------------------------------------------
@@ -224,6 +374,29 @@ bool	CBatchDrawer_Light::EmitDrawCall(PopcornFX::SRenderContext &ctx, const Popc
 		return true;
 
 	_IssueDrawCall_Light(renderContext, toEmit);
+
+	if (FPopcornFXSimulationCacheRecorder::RenderThread_HasRecorders())
+	{
+		const CParticleScene	*scene = &renderContext.m_RenderBatchManager->ParticleScene();
+		const u32				drCount = toEmit.m_DrawRequests.Count();
+		const u32	rendererCacheCount = toEmit.m_RendererCaches.Count();
+		for (u32 iDr = 0; iDr < drCount; ++iDr)
+		{
+			const PopcornFX::Drawers::SLight_DrawRequest			&drawRequest = *static_cast<const PopcornFX::Drawers::SLight_DrawRequest*>(toEmit.m_DrawRequests[iDr]);
+			const PopcornFX::Drawers::SLight_BillboardingRequest	&bbRequest = static_cast<const PopcornFX::Drawers::SLight_BillboardingRequest&>(drawRequest.BaseBillboardingRequest());
+			const PopcornFX::CParticleStreamToRender_MainMemory		*lockedStream = drawRequest.StreamToRender_MainMemory();
+			const CRendererCache									*rendererCache = static_cast<const CRendererCache*>((iDr < rendererCacheCount ? toEmit.m_RendererCaches[iDr] : toEmit.m_RendererCaches.First()).Get());
+			if (lockedStream == null || rendererCache == null)
+				continue;
+
+			FPopcornFXSimulationCacheRecorder::SStreamIds	streamIds;
+			streamIds.m_Positions = bbRequest.m_PositionStreamId;
+			streamIds.m_Sizes = bbRequest.m_RangeStreamId;
+			streamIds.m_Colors = bbRequest.m_ColorStreamId;
+			streamIds.m_Enabled = bbRequest.m_EnabledStreamId;
+			FPopcornFXSimulationCacheRecorder::RenderThread_Capture(scene, rendererCache->RenderThread_Desc().m_Renderer.Get(), *lockedStream, streamIds);
+		}
+	}
 	return true;
 }
 
@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------------
 
 struct	SUERenderContext;
+struct	SCollectedDrawCalls;
 
 //----------------------------------------------------------------------------
 
@@ -29,6 +30,10 @@ public:
 	virtual void		BeginFrame(PopcornFX::SRenderContext &ctx) override;
 	virtual bool		EmitDrawCall(PopcornFX::SRenderContext &ctx, const PopcornFX::SDrawCallDesc &toEmit) override;
 
+	// Keeps the 'budget' most important collected lights in [first, end), in their original order (budget == 0: unlimited).
+	// 'rememberSelection' records the kept lights so they are favored next frame.
+	static void			SelectLights(SCollectedDrawCalls &lights, u32 first, u32 budget, bool rememberSelection);
+
 private:
 	void				_IssueDrawCall_Light(const SUERenderContext &renderContext, const PopcornFX::SDrawCallDesc &desc);
 };
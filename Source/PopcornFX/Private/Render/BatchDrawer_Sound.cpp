@@ -19,6 +19,8 @@
 #include "Engine/Engine.h"
 #include "Assets/PopcornFXRendererMaterial.h"
 #include "PopcornFXStats.h"
+#include "PopcornFXSceneComponent.h"
+#include "Internal/ParticleScene.h"
 
 #include <pk_render_helpers/include/render_features/rh_features_basic.h>
 #include <pk_render_helpers/include/render_features/rh_features_vat_static.h>
@@ -135,6 +137,10 @@ void	CBatchDrawer_Sound::_IssueDrawCall_Sound(const SUERenderContext &renderCont
 
 	sPoolCollection->BeginInsert(world);
 
+	// Voice priority: volume, attenuated by the distance to the closest player view
+	const TArray<FVector>	&viewOrigins = renderContext.m_RenderBatchManager->ParticleScene().UpdateViewOrigins();
+	const u32				maxVoices = (u32)FMath::Max(renderContext.m_RenderBatchManager->ParticleScene().SceneComponent()->ResolvedRenderSettings().MaxSoundVoices, 0);
+
 	const u32		soundPoolCount = sPoolCollection->m_Pools.Count();
 	const u32		maxSoundPoolID = soundPoolCount - 1;
 	const float		maxSoundPoolsFp = maxSoundPoolID;
@@ -220,6 +226,19 @@ void	CBatchDrawer_Sound::_IssueDrawCall_Sound(const SUERenderContext &renderCont
 				sDesc.m_DopplerLevel = dopplerFactor;
 				sDesc.m_Age = lifeRatios[iParticle] / invLives[iParticle];
 				sDesc.m_Audible = audible;
+				sDesc.m_Priority = 0.0f;
+				if (audible)
+				{
+					double	minDistanceSq = 0.0;
+					if (viewOrigins.Num() > 0)
+					{
+						minDistanceSq = TNumericLimits<double>::Max();
+						for (const FVector &viewOrigin : viewOrigins)
+							minDistanceSq = FMath::Min(minDistanceSq, FVector::DistSquared(pos, viewOrigin));
+					}
+					const float	distance = float(FMath::Sqrt(minDistanceSq));
+					sDesc.m_Priority = volume * (radius > 0.0f ? radius / FMath::Max(distance, radius) : 1.0f);
+				}
 
 				sDesc.m_Volume = volume * (1.0f - soundIdFrac);
 				sPoolCollection->m_Pools[soundId0].InsertSoundIFP(sDesc);
@@ -233,7 +252,7 @@ void	CBatchDrawer_Sound::_IssueDrawCall_Sound(const SUERenderContext &renderCont
 		}
 	}
 
-	sPoolCollection->EndInsert(world);
+	sPoolCollection->EndInsert(world, maxVoices);
 
 	INC_DWORD_STAT_BY(STAT_PopcornFX_SoundCount, totalParticleCount);
 }
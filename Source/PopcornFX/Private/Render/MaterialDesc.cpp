@@ -575,6 +575,7 @@ bool	CMaterialDesc_RenderThread::SetupFromGame(const CMaterialDesc_GameThread &g
 	m_MotionBlur = gameMat.m_MotionBlur;
 
 	m_BaseLODLevel = gameMat.m_BaseLODLevel;
+	m_Renderer = gameMat.m_Renderer; // Identifies the renderer for simulation cache recording
 
 #if WITH_EDITOR
 	const bool	meshChanged = m_StaticMesh != gameMat.m_StaticMesh;
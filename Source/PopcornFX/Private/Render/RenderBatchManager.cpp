@@ -49,57 +49,122 @@ DEFINE_LOG_CATEGORY_STATIC(LogRenderBatchManager, Log, All);
 
 //----------------------------------------------------------------------------
 
-bool	CUEFrameCollector::LateCull(const PopcornFX::CAABB &bbox) const
+void	CUEFrameCollector::SetupLateCull()
 {
-	PK_NAMEDSCOPEDPROFILE("CUEFrameCollector::Cull Page (RenderThread)");
+	PK_NAMEDSCOPEDPROFILE("CUEFrameCollector::SetupLateCull");
+
+	m_ViewCuller.Clear();
+	m_RTViewValid = false;
+	if (m_Views == null)
+		return;
+
+	const CRendererSubView::EPass	pass = m_Views->RenderPass();
+	if (pass == CRendererSubView::RenderPass_Main ||
+		(pass == CRendererSubView::RenderPass_Shadow && !m_DisableShadowCulling))
+		m_ViewCuller.Setup(*m_Views);
+#if RHI_RAYTRACING
+	else if (pass == CRendererSubView::RenderPass_RT_AccelStructs)
+	{
+		// Single reference view, see CRendererSubView::Setup_GetDynamicRayTracingInstances
+		const FSceneView	*view = m_Views->SceneViews().Count() > 0 ? m_Views->SceneViews()[0].m_SceneView : null;
+		if (view == null)
+			return;
+		m_RTViewValid = true;
+		const float		rcpScale = FPopcornFXPlugin::GlobalScaleRcp();
+		switch (m_RTCullMethod)
+		{
+		case	EPopcornFXRayTracingCullMethod::DistanceSphere:
+			m_RTViewOrigin = ToPk(view->ViewMatrices.GetViewOrigin()) * rcpScale;
+			m_RTCullRadius = m_RTCullDistance * rcpScale;
+			break;
+		case	EPopcornFXRayTracingCullMethod::ExpandedFrustum:
+			m_ViewCuller.Setup(*m_Views, m_RTCullDistance * rcpScale);
+			break;
+		case	EPopcornFXRayTracingCullMethod::ScreenSize:
+		{
+			// Same projection as ComputeBoundsScreenSize(), without the per-page matrix fetches
+			const FMatrix	&projMatrix = view->ViewMatrices.GetProjectionMatrix();
+			m_RTViewOrigin = ToPk(view->ViewMatrices.GetViewOrigin()) * rcpScale;
+			m_RTScreenMultiple = float(FMath::Max(0.5f * projMatrix.M[0][0], 0.5f * projMatrix.M[1][1]));
+			break;
+		}
+		case	EPopcornFXRayTracingCullMethod::None:
+		default:
+			break;
+		}
+	}
+#endif // RHI_RAYTRACING
+}
 
+//----------------------------------------------------------------------------
+
+bool	CUEFrameCollector::_LateCull_RT(const PopcornFX::CAABB &bbox) const
+{
+	if (!m_RTViewValid)
+		return false;
+	switch (m_RTCullMethod)
+	{
+	case	EPopcornFXRayTracingCullMethod::DistanceSphere:
+	{
+		const float	pageRadius = bbox.Extent().Length();
+		const float	maxDistance = m_RTCullRadius + pageRadius;
+		return (bbox.Center() - m_RTViewOrigin).LengthSquared() > maxDistance * maxDistance;
+	}
+	case	EPopcornFXRayTracingCullMethod::ExpandedFrustum:
+		return !m_ViewCuller.Empty() && m_ViewCuller.ViewMask(bbox) == 0;
+	case	EPopcornFXRayTracingCullMethod::ScreenSize:
+	{
+		// Inside the page: never culled
+		const float	pageRadius = bbox.Extent().Length();
+		const float	distance = (bbox.Center() - m_RTViewOrigin).Length();
+		if (distance <= pageRadius)
+			return false;
+		const float	screenSize = 2.0f * m_RTScreenMultiple * pageRadius / distance;
+		return screenSize < m_RTMinScreenSize;
+	}
+	case	EPopcornFXRayTracingCullMethod::None:
+	default:
+		return false;
+	}
+}
+
+//----------------------------------------------------------------------------
+
+u32	CUEFrameCollector::LateCullViewMask(const PopcornFX::CAABB &bbox) const
+{
 	if (m_Views == null ||
 		!bbox.IsFinite() ||
 		!bbox.Valid())
-		return false;
+		return CViewCuller::kAllViewsMask;
 
 #if RHI_RAYTRACING
-	// TODO: Nothing is culled here, do we really need to submit the entire particle scene? How to cull properly?
+	// Particles outside of the view can still be visible in ray traced reflections/shadows, see EPopcornFXRayTracingCullMethod
 	if (m_Views->RenderPass() == CRendererSubView::RenderPass_RT_AccelStructs)
-		return false;
+		return _LateCull_RT(bbox) ? 0 : CViewCuller::kAllViewsMask;
 #endif
 
 	PK_ASSERT(m_Views->RenderPass() == CRendererSubView::RenderPass_Main ||
 		m_Views->RenderPass() == CRendererSubView::RenderPass_Shadow);
 
-	const bool	mainPass = m_Views->RenderPass() == CRendererSubView::RenderPass_Main;
-	if (!mainPass)
+	if (m_Views->RenderPass() == CRendererSubView::RenderPass_Shadow)
 	{
 		// If we are here, it means this cull test is for a shadow casting renderer
 		if (m_DisableShadowCulling)
-			return false;
+			return CViewCuller::kAllViewsMask;
 	}
 
-	const CFloat3		origin = bbox.Center();
-	const CFloat3		extent = bbox.Extent();
-	const float			scale = FPopcornFXPlugin::GlobalScale();
-	const FVector		ueOrigin = FVector(_Reinterpret<FVector3f>(origin) * scale);
-	const FVector		ueExtent = FVector(_Reinterpret<FVector3f>(extent) * scale);
-	const auto			&sceneViews = m_Views->SceneViews();
-	for (u32 viewi = 0; viewi < sceneViews.Count(); ++viewi)
-	{
-		if (!sceneViews[viewi].m_ToRender)
-			continue;
-		const FSceneView		*view = sceneViews[viewi].m_SceneView;
-		bool					fullyContained;
+	// Planes of all views are tested 4 at a time, see SetupLateCull()
+	return m_ViewCuller.ViewMask(bbox);
+}
 
-		if (mainPass)
-		{
-			if (view->ViewFrustum.IntersectBox(ueOrigin, ueExtent, fullyContained))
-				return false;
-		}
-		else
-		{
-			PK_ASSERT(view->GetDynamicMeshElementsShadowCullFrustum());
-			if (view->GetDynamicMeshElementsShadowCullFrustum()->IntersectBox(ueOrigin + view->GetPreShadowTranslation(), ueExtent, fullyContained))
-				return false;
-		}
-	}
+//----------------------------------------------------------------------------
+
+bool	CUEFrameCollector::LateCull(const PopcornFX::CAABB &bbox) const
+{
+	PK_NAMEDSCOPEDPROFILE("CUEFrameCollector::Cull Page (RenderThread)");
+
+	if (LateCullViewMask(bbox) != 0)
+		return false;
 
 	INC_DWORD_STAT_BY(STAT_PopcornFX_CulledDrawReqCount, 1);
 	return true;
@@ -176,6 +241,15 @@ CRenderBatchManager::CRenderBatchManager()
 #if POPCORNFX_RENDER_DEBUG
 ,	m_DebugDrawMode(0)
 #endif // POPCORNFX_RENDER_DEBUG
+,	m_RTCullMethod(EPopcornFXRayTracingCullMethod::None)
+,	m_RTCullDistance(0.0f)
+,	m_RTMinScreenSize(0.0f)
+,	m_LightsCulling(true)
+,	m_MaxLights(0)
+,	m_MaxLightsPerRenderer(0)
+,	m_RenderThread_LightsCulling(true)
+,	m_RenderThread_MaxLights(0)
+,	m_RenderThread_MaxLightsPerRenderer(0)
 ,	m_DCSortMethod(PopcornFX::Sort_DrawCalls)
 ,	m_StatelessCollect(false)
 ,	m_BillboardingLocation(PopcornFX::Drawers::BillboardingLocation_CPU)
@@ -586,6 +660,14 @@ void	CRenderBatchManager::GameThread_PreUpdate(const FPopcornFXRenderSettings &r
 		m_FrameCollector_UE_Render.ReleaseRenderedFrameIFP();
 	}
 
+	m_RTCullMethod = renderSettings.RayTracingCullMethod;
+	m_RTCullDistance = renderSettings.RayTracingCullDistance;
+	m_RTMinScreenSize = renderSettings.RayTracingMinScreenSize;
+
+	m_LightsCulling = renderSettings.bEnableLightsCulling != 0;
+	m_MaxLights = (u32)FMath::Max(renderSettings.MaxLights, 0);
+	m_MaxLightsPerRenderer = (u32)FMath::Max(renderSettings.MaxLightsPerRenderer, 0);
+
 #if WITH_EDITOR
 	m_StatelessCollect = !renderSettings.bDisableStatelessCollecting;
 	switch (renderSettings.DrawCallSortMethod)
@@ -693,6 +775,14 @@ void	CRenderBatchManager::ConcurrentThread_SendRenderDynamicData()
 	const PopcornFX::Drawers::EBillboardingLocation		bbLocation = m_BillboardingLocation;
 	const bool											statelessCollect = m_StatelessCollect;
 
+	const EPopcornFXRayTracingCullMethod::Type			rtCullMethod = m_RTCullMethod;
+	const float											rtCullDistance = m_RTCullDistance;
+	const float											rtMinScreenSize = m_RTMinScreenSize;
+
+	const bool											lightsCulling = m_LightsCulling;
+	const u32											maxLights = m_MaxLights;
+	const u32											maxLightsPerRenderer = m_MaxLightsPerRenderer;
+
 	// /!\ ConcurrentThread_SendRenderDynamicData cannot be called while UpdateThread_Endupdate() gets called
 	if (newToRender != null || newToRender2 != null)
 	{
@@ -706,6 +796,8 @@ void	CRenderBatchManager::ConcurrentThread_SendRenderDynamicData()
 			, debugParticlePointSize, debugBoundsLinesThickness
 #endif // POPCORNFX_RENDER_DEBUG
 			, forceLightsTranslucent
+			, rtCullMethod, rtCullDistance, rtMinScreenSize
+			, lightsCulling, maxLights, maxLightsPerRenderer
 			](FRHICommandListImmediate &RHICmdList)
 		{
 			PK_NAMEDSCOPEDPROFILE_C("CParticleRenderManager::Pop Collected Frame", POPCORNFX_UE_PROFILER_COLOR);
@@ -723,6 +815,14 @@ void	CRenderBatchManager::ConcurrentThread_SendRenderDynamicData()
 #endif // POPCORNFX_RENDER_DEBUG
 			m_ForceLightsTranslucent = forceLightsTranslucent;
 
+			m_FrameCollector_UE_Render.m_RTCullMethod = rtCullMethod;
+			m_FrameCollector_UE_Render.m_RTCullDistance = rtCullDistance;
+			m_FrameCollector_UE_Render.m_RTMinScreenSize = rtMinScreenSize;
+
+			m_RenderThread_LightsCulling = lightsCulling;
+			m_RenderThread_MaxLights = maxLights;
+			m_RenderThread_MaxLightsPerRenderer = maxLightsPerRenderer;
+
 			PK_ASSERT(IsInRenderingThread());
 			m_CollectedDrawCalls.Clear();
 
@@ -847,6 +947,7 @@ void	CRenderBatchManager::RenderThread_DrawCalls(PopcornFX::CRendererSubView &vi
 
 	m_FrameCollector_UE_Render.m_Views = &view;
 	m_FrameCollector_UE_Render.m_DisableShadowCulling = false; // TODO
+	m_FrameCollector_UE_Render.SetupLateCull();
 
 	// Special rendering method in UE, in editor only: we want to debug render particles so need to keep the rendering locked until this is done.
 
@@ -866,7 +967,10 @@ void	CRenderBatchManager::RenderThread_DrawCalls(PopcornFX::CRendererSubView &vi
 #endif
 		m_FrameCollector_UE_Render.Render(m_UE_RenderThreadRenderContext, false /* release frame */, endCollectingDrawCallsMask);
 	}
+	if (view.RenderPass() == CRendererSubView::RenderPass_Main)
+		CBatchDrawer_Light::SelectLights(m_CollectedDrawCalls, 0, m_RenderThread_MaxLights, true);
 	m_FrameCollector_UE_Render.m_Views = null;
+	m_FrameCollector_UE_Render.m_ViewCuller.Clear();
 
 #if POPCORNFX_RENDER_DEBUG
 	if (view.RenderPass() == CRendererSubView::RenderPass_Main &&
@@ -12,6 +12,7 @@
 #include "Materials/MaterialInterface.h"
 
 #include "Render/PopcornFXVertexFactory.h"
+#include "Render/ViewCuller.h"
 #include "World/PopcornFXSceneProxy.h"
 
 #include <pk_particles/include/ps_mediums.h>
@@ -45,11 +46,31 @@ public:
 
 	void			ReleaseRenderedFrameIFP();
 
+	// Must be called before rendering m_Views: builds the culling planes of the views to render
+	void			SetupLateCull();
+	// One bit per m_Views->SceneViews() index, set if the page is visible in that view
+	u32				LateCullViewMask(const PopcornFX::CAABB &bbox) const;
+
 public:
 	PopcornFX::CRendererSubView	*m_Views = null;
 	CRenderBatchManager			*m_RenderBatchManager = null;
 	bool						m_DisableShadowCulling = false;
 	u32							m_LastFrameDrawCalledCount = 0;
+	CViewCuller					m_ViewCuller;
+
+	// Ray tracing passes culling policy, set on the render thread from the resolved render settings
+	EPopcornFXRayTracingCullMethod::Type	m_RTCullMethod = EPopcornFXRayTracingCullMethod::None;
+	float									m_RTCullDistance = 0.0f; // UE units
+	float									m_RTMinScreenSize = 0.0f;
+
+private:
+	bool			_LateCull_RT(const PopcornFX::CAABB &bbox) const;
+
+	// Computed by SetupLateCull() for ray tracing passes, PopcornFX space
+	bool			m_RTViewValid = false; // No reference view: nothing is culled
+	CFloat3			m_RTViewOrigin = CFloat3::ZERO;
+	float			m_RTCullRadius = 0.0f;
+	float			m_RTScreenMultiple = 0.0f;
 
 private:
 	virtual void	Walk(const PopcornFX::CParticleMedium *medium, const PopcornFX::CRendererDataBase *renderer) override;
@@ -128,6 +149,10 @@ public:
 	ERHIFeatureLevel::Type						GetFeatureLevel() const { return m_CurrentFeatureLevel; }
 public:
 	bool						ForceLightsTranslucent() { return m_ForceLightsTranslucent; }
+	bool						RenderThread_LightsCulling() const { return m_RenderThread_LightsCulling; }
+	u32							RenderThread_MaxLights() const { return m_RenderThread_MaxLights; }
+	u32							RenderThread_MaxLightsPerRenderer() const { return m_RenderThread_MaxLightsPerRenderer; }
+	const CViewCuller			&RenderThread_ViewCuller() const { return m_FrameCollector_UE_Render.m_ViewCuller; }
 
 	const CParticleScene		&ParticleScene() { return *m_ParticleScene; }
 
@@ -187,6 +212,17 @@ private:
 #endif // POPCORNFX_RENDER_DEBUG
 	bool		m_ForceLightsTranslucent;
 
+	EPopcornFXRayTracingCullMethod::Type	m_RTCullMethod;
+	float									m_RTCullDistance;
+	float									m_RTMinScreenSize;
+
+	bool		m_LightsCulling;
+	u32			m_MaxLights;
+	u32			m_MaxLightsPerRenderer;
+	bool		m_RenderThread_LightsCulling;
+	u32			m_RenderThread_MaxLights;
+	u32			m_RenderThread_MaxLightsPerRenderer;
+
 private:
 	float										m_LastBufferGCTime;
 
@@ -23,11 +23,16 @@ struct	SCollectedDrawCalls
 {
 	PopcornFX::TArray<FSimpleLightPerViewEntry>	m_LightPositions;
 	PopcornFX::TArray<FSimpleLightEntry>		m_LightDatas;
+	PopcornFX::TArray<float>					m_LightImportances; // Only filled when a light budget is set, see CBatchDrawer_Light
+
+	// Cells of the lights selected last frame (kept across frames): gives them priority to avoid popping
+	TSet<u64>									m_SelectedLightCells;
 
 	void	Clear()
 	{
 		m_LightPositions.Clear();
 		m_LightDatas.Clear();
+		m_LightImportances.Clear();
 	}
 };
 
@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#include "SimulationCacheRecorder.h"
+
+#include "PopcornFXPlugin.h"
+#include "PopcornFXEmitterComponent.h"
+#include "Assets/PopcornFXEffect.h"
+#include "Assets/PopcornFXEffectPriv.h"
+#include "Assets/PopcornFXRendererMaterial.h"
+
+#include "Engine/World.h"
+#include "Materials/MaterialInstanceConstant.h"
+
+#include "PopcornFXSDK.h"
+#include <pk_particles/include/ps_effect.h>
+#include <pk_particles/include/ps_event_map.h>
+#include <pk_particles/include/Renderers/ps_renderer_base.h>
+#include <pk_particles/include/Storage/MainMemory/storage_ram.h>
+
+//----------------------------------------------------------------------------
+
+DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXSimulationCacheRecorder, Log, All);
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	PopcornFX::Threads::CCriticalSection										g_RecordersLock;
+	TArray<TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe>>	g_Recorders;
+	PopcornFX::TAtomic<u32>														g_RecorderCount = 0; // Lock-free early out for the batch drawers
+}
+
+//----------------------------------------------------------------------------
+
+bool	FPopcornFXSimulationCacheRecorder::Setup(UPopcornFXEmitterComponent *emitter, float frameRate, float duration, TArray<FPopcornFXSimulationCacheTrack> &outTracks)
+{
+	PK_ASSERT(IsInGameThread());
+
+	outTracks.Empty();
+	if (!PK_VERIFY(emitter != null) || emitter->GetWorld() == null)
+		return false;
+	UPopcornFXEffect	*effect = emitter->Effect;
+	if (effect == null || !effect->LoadEffectIFN())
+	{
+		UE_LOG(LogPopcornFXSimulationCacheRecorder, Warning, TEXT("Couldn't record '%s': no valid effect"), *emitter->GetName());
+		return false;
+	}
+	if (emitter->_GetParticleScene() == null)
+	{
+		UE_LOG(LogPopcornFXSimulationCacheRecorder, Warning, TEXT("Couldn't record '%s': emitter is not registered in a PopcornFX scene"), *emitter->GetName());
+		return false;
+	}
+	PopcornFX::PCParticleEffect	particleEffect = effect->Effect()->ParticleEffect();
+	if (!PK_VERIFY(particleEffect != null))
+		return false;
+	const PopcornFX::PCEventConnectionMap	&ecMap = particleEffect->EventConnectionMap();
+	if (!PK_VERIFY(ecMap != null))
+		return false;
+
+	// Same renderer indexing as UPopcornFXEffect::ParticleRendererMaterials
+	s32			globalRendererIndex = -1;
+	const u32	layerCount = ecMap->m_LayerSlots.Count();
+	for (u32 iLayer = 0; iLayer < layerCount; ++iLayer)
+	{
+		const PopcornFX::PParticleDescriptor	&desc = ecMap->m_LayerSlots[iLayer].m_ParentDescriptor;
+		if (!PK_VERIFY(desc != null))
+			return false;
+
+		PopcornFX::TMemoryView<const PopcornFX::PRendererDataBase>	renderers = desc->Renderers();
+		for (u32 iRenderer = 0; iRenderer < renderers.Count(); ++iRenderer)
+		{
+			globalRendererIndex++;
+
+			const PopcornFX::CRendererDataBase	*rBase = renderers[iRenderer].Get();
+			if (!PK_VERIFY(rBase != null))
+				return false;
+			if (rBase->m_RendererType != PopcornFX::Renderer_Billboard &&
+				rBase->m_RendererType != PopcornFX::Renderer_Light)
+				continue; // Other renderers are not recorded
+
+			FPopcornFXSimulationCacheTrack	&track = outTracks.AddDefaulted_GetRef();
+			track.Type = rBase->m_RendererType == PopcornFX::Renderer_Light ? EPopcornFXSimulationCacheTrackType::Light : EPopcornFXSimulationCacheTrackType::Billboard;
+			track.RendererIndex = globalRendererIndex;
+			if (track.Type == EPopcornFXSimulationCacheTrackType::Billboard)
+			{
+				for (UPopcornFXRendererMaterial *rendererMat : effect->ParticleRendererMaterials)
+				{
+					if (rendererMat != null && rendererMat->Contains(globalRendererIndex))
+					{
+						track.Material = rendererMat->GetInstance(0, false);
+						break;
+					}
+				}
+			}
+			m_TrackIndices.Add(rBase, outTracks.Num() - 1);
+		}
+	}
+	if (outTracks.IsEmpty())
+	{
+		UE_LOG(LogPopcornFXSimulationCacheRecorder, Warning, TEXT("Couldn't record '%s': effect has no billboard or light renderer"), *emitter->GetName());
+		return false;
+	}
+
+	const FTransform	&emitterTransform = emitter->GetComponentTransform();
+	m_TrackCount = outTracks.Num();
+	m_World = emitter->GetWorld();
+	m_Scene = emitter->_GetParticleScene();
+	m_StartTime = m_World->GetTimeSeconds();
+	m_WorldToEmitter = emitterTransform.ToMatrixWithScale().Inverse();
+	m_SizeScale = FPopcornFXPlugin::GlobalScale() / FMath::Max(emitterTransform.GetMaximumAxisScale(), UE_KINDA_SMALL_NUMBER);
+	m_SampleInterval = frameRate > 0.0f ? 1.0f / frameRate : 0.0f;
+	m_Duration = duration;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::GameThread_SetTime(float time)
+{
+	PK_SCOPEDLOCK(m_Lock);
+	m_Time = time;
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::Stop(TArray<SRecordedFrame> &outFrames)
+{
+	PK_SCOPEDLOCK(m_Lock);
+	m_Stopped = true;
+	outFrames = MoveTemp(m_Frames);
+	m_Frames.Empty();
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::Register(const TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe> &recorder)
+{
+	PK_SCOPEDLOCK(g_RecordersLock);
+	g_Recorders.Add(recorder);
+	g_RecorderCount.Store(g_Recorders.Num());
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::Unregister(const FPopcornFXSimulationCacheRecorder *recorder)
+{
+	PK_SCOPEDLOCK(g_RecordersLock);
+	g_Recorders.RemoveAll([recorder](const TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe> &other) { return other.Get() == recorder; });
+	g_RecorderCount.Store(g_Recorders.Num());
+}
+
+//----------------------------------------------------------------------------
+
+bool	FPopcornFXSimulationCacheRecorder::RenderThread_HasRecorders()
+{
+	return g_RecorderCount.Load() != 0;
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::RenderThread_Capture(const CParticleScene *scene, const PopcornFX::CRendererDataBase *renderer, const PopcornFX::CParticleStreamToRender_MainMemory &stream, const SStreamIds &streamIds)
+{
+	PK_NAMEDSCOPEDPROFILE_C("FPopcornFXSimulationCacheRecorder::RenderThread_Capture", POPCORNFX_UE_PROFILER_COLOR);
+
+	TArray<TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe>, TInlineAllocator<2>>	recorders;
+	{
+		PK_SCOPEDLOCK(g_RecordersLock);
+		recorders = g_Recorders;
+	}
+	for (const TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe> &recorder : recorders)
+		recorder->_Capture(scene, renderer, stream, streamIds);
+}
+
+//----------------------------------------------------------------------------
+
+void	FPopcornFXSimulationCacheRecorder::_Capture(const CParticleScene *scene, const PopcornFX::CRendererDataBase *renderer, const PopcornFX::CParticleStreamToRender_MainMemory &stream, const SStreamIds &streamIds)
+{
+	PK_SCOPEDLOCK(m_Lock);
+	if (m_Stopped || scene != m_Scene) // Other worlds (PIE instances, editor viewports) render the same effects
+		return;
+	const int32	*trackIndex = m_TrackIndices.Find(renderer);
+	if (trackIndex == null)
+		return;
+
+	if (m_RenderFrame != GFrameCounterRenderThread)
+	{
+		// First capture of this frame: only keep it if enough time elapsed since the last recorded frame
+		m_RenderFrame = GFrameCounterRenderThread;
+		m_CapturedStreams.Reset();
+		m_CaptureRenderFrame = m_Time <= m_Duration &&
+							   (m_Frames.IsEmpty() || m_Time - m_Frames.Last().m_Time >= FMath::Max(m_SampleInterval, UE_KINDA_SMALL_NUMBER));
+		if (m_CaptureRenderFrame)
+		{
+			SRecordedFrame	&frame = m_Frames.AddDefaulted_GetRef();
+			frame.m_Time = m_Time;
+			frame.m_Tracks.SetNum(m_TrackCount);
+		}
+	}
+	if (!m_CaptureRenderFrame)
+		return;
+	// Several draw requests of a renderer accumulate into its track, each one is captured for a single view
+	bool	alreadyCaptured = false;
+	m_CapturedStreams.Add(&stream, &alreadyCaptured);
+	if (alreadyCaptured)
+		return;
+
+	FPopcornFXSimulationCacheDecodedTrack	&track = m_Frames.Last().m_Tracks[*trackIndex];
+	const float								globalScale = FPopcornFXPlugin::GlobalScale();
+
+	const u32	pageCount = stream.PageCount();
+	for (u32 pagei = 0; pagei < pageCount; ++pagei)
+	{
+		const PopcornFX::CParticlePageToRender_MainMemory	*page = stream.Page(pagei);
+		PK_ASSERT(page != null);
+		const u32	pcount = page == null ? 0 : page->InputParticleCount();
+		if (pcount == 0)
+			continue;
+
+		TStridedMemoryView<const CFloat3>	positions = page->StreamForReading<CFloat3>(streamIds.m_Positions);
+		if (!PK_VERIFY(positions.Count() == pcount))
+			continue;
+
+		const float							defaultZero = 0.0f;
+		TStridedMemoryView<const float>		sizes = streamIds.m_Sizes.Valid() ? page->StreamForReading<float>(streamIds.m_Sizes) : TStridedMemoryView<const float>(&defaultZero, pcount, 0);
+		TStridedMemoryView<const float>		rotations = streamIds.m_Rotations.Valid() ? page->StreamForReading<float>(streamIds.m_Rotations) : TStridedMemoryView<const float>(&defaultZero, pcount, 0);
+		TStridedMemoryView<const CFloat4>	colors = streamIds.m_Colors.Valid() ? page->StreamForReading<CFloat4>(streamIds.m_Colors) : TStridedMemoryView<const CFloat4>(&CFloat4::ONE, pcount, 0);
+
+		const u8						enabledTrue = u8(-1);
+		TStridedMemoryView<const u8>	enabledParticles = streamIds.m_Enabled.Valid() ? page->StreamForReading<bool>(streamIds.m_Enabled) : TStridedMemoryView<const u8>(&enabledTrue, pcount, 0);
+		if (sizes.Count() != pcount || rotations.Count() != pcount || colors.Count() != pcount || enabledParticles.Count() != pcount)
+			continue;
+
+		track.Positions.Reserve(track.Positions.Num() + pcount);
+		track.Sizes.Reserve(track.Sizes.Num() + pcount);
+		track.Rotations.Reserve(track.Rotations.Num() + pcount);
+		track.Colors.Reserve(track.Colors.Num() + pcount);
+		for (u32 parti = 0; parti < pcount; ++parti)
+		{
+			if (!enabledParticles[parti])
+				continue;
+			const FVector	worldPosition = FVector(ToUE(positions[parti] * globalScale));
+			const CFloat4	&color = colors[parti];
+
+			track.Positions.Add(FVector3f(m_WorldToEmitter.TransformPosition(worldPosition)));
+			track.Sizes.Add(sizes[parti] * m_SizeScale);
+			track.Rotations.Add(rotations[parti]);
+			track.Colors.Add(FLinearColor(color.x(), color.y(), color.z(), color.w()));
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
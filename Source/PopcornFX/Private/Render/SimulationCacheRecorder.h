@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+#pragma once
+
+#include "PopcornFXMinimal.h"
+#include "Assets/PopcornFXSimulationCache.h"
+
+#include "PopcornFXSDK.h"
+#include <pk_particles/include/ps_stream_to_render.h>
+
+FWD_PK_API_BEGIN
+class	CRendererDataBase;
+FWD_PK_API_END
+
+class	UPopcornFXEmitterComponent;
+class	CParticleScene;
+
+//----------------------------------------------------------------------------
+//
+//	Captures the particles rendered by the CPU batch drawers into frames for UPopcornFXSimulationCache.
+//	Setup and frame retrieval happen on the game thread, captures on the render thread.
+//
+//----------------------------------------------------------------------------
+
+class	FPopcornFXSimulationCacheRecorder
+{
+public:
+	struct	SStreamIds
+	{
+		PopcornFX::CGuid	m_Positions;
+		PopcornFX::CGuid	m_Sizes;
+		PopcornFX::CGuid	m_Rotations;
+		PopcornFX::CGuid	m_Colors; // Float4
+		PopcornFX::CGuid	m_Enabled;
+	};
+
+	struct	SRecordedFrame
+	{
+		float											m_Time = 0.0f;
+		TArray<FPopcornFXSimulationCacheDecodedTrack>	m_Tracks;
+	};
+
+public:
+	// Game thread: resolves the recorded renderers of the emitter's effect
+	bool			Setup(UPopcornFXEmitterComponent *emitter, float frameRate, float duration, TArray<FPopcornFXSimulationCacheTrack> &outTracks);
+
+	// Game thread
+	void			GameThread_SetTime(float time);
+	float			Duration() const { return m_Duration; }
+	UWorld			*World() const { return m_World.Get(); }
+	double			StartTime() const { return m_StartTime; }
+	void			Stop(TArray<SRecordedFrame> &outFrames);
+
+	// Registers/unregisters the recorder for render thread captures
+	static void		Register(const TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe> &recorder);
+	static void		Unregister(const FPopcornFXSimulationCacheRecorder *recorder);
+
+	// Render thread: called by the CPU batch drawers for each emitted draw request of 'scene'
+	static bool		RenderThread_HasRecorders();
+	static void		RenderThread_Capture(const CParticleScene *scene, const PopcornFX::CRendererDataBase *renderer, const PopcornFX::CParticleStreamToRender_MainMemory &stream, const SStreamIds &streamIds);
+
+private:
+	void			_Capture(const CParticleScene *scene, const PopcornFX::CRendererDataBase *renderer, const PopcornFX::CParticleStreamToRender_MainMemory &stream, const SStreamIds &streamIds);
+
+private:
+	PopcornFX::Threads::CCriticalSection		m_Lock;
+
+	TMap<const PopcornFX::CRendererDataBase*, int32>	m_TrackIndices;
+	int32										m_TrackCount = 0;
+	TWeakObjectPtr<UWorld>						m_World;
+	const CParticleScene						*m_Scene = null; // Only compared against, never dereferenced
+	double										m_StartTime = 0.0;
+	FMatrix										m_WorldToEmitter = FMatrix::Identity;
+	float										m_SizeScale = 1.0f;
+	float										m_SampleInterval = 0.0f;
+	float										m_Duration = 0.0f;
+
+	float										m_Time = 0.0f;
+	bool										m_Stopped = false;
+	uint64										m_RenderFrame = ~0ULL;
+	bool										m_CaptureRenderFrame = false;
+	TSet<const PopcornFX::CParticleStreamToRender_MainMemory*>	m_CapturedStreams; // Draw requests are emitted once per view, pass and slice
+	TArray<SRecordedFrame>						m_Frames;
+};
+
+//----------------------------------------------------------------------------
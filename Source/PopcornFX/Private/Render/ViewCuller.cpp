@@ -0,0 +1,149 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#include "ViewCuller.h"
+
+#include "PopcornFXPlugin.h"
+
+#include "SceneView.h"
+#include "ConvexVolume.h"
+
+//----------------------------------------------------------------------------
+
+namespace
+{
+	CFloat4		_PlaneLanes(const FPlane &plane)
+	{
+		return CFloat4(float(plane.X), float(plane.Y), float(plane.Z), float(plane.W));
+	}
+} // namespace
+
+//----------------------------------------------------------------------------
+
+bool	CViewCuller::Setup(const CRendererSubView &view, float planesPushOut)
+{
+	Clear();
+
+	const bool	shadowPass = view.RenderPass() == CRendererSubView::RenderPass_Shadow;
+	const float	rcpScale = FPopcornFXPlugin::GlobalScaleRcp();
+	const auto	&sceneViews = view.SceneViews();
+	for (u32 viewi = 0; viewi < sceneViews.Count(); ++viewi)
+	{
+		if (!sceneViews[viewi].m_ToRender)
+			continue;
+		const FSceneView	*sceneView = sceneViews[viewi].m_SceneView;
+		if (!PK_VERIFY(sceneView != null))
+			continue;
+
+		// A view without planes sees everything: keep its bit set, it will never be culled
+		m_ViewsMask |= (1U << viewi);
+
+		const FConvexVolume	*frustum = shadowPass ? sceneView->GetDynamicMeshElementsShadowCullFrustum() : &sceneView->ViewFrustum;
+		PK_ASSERT(frustum != null);
+		if (frustum == null)
+			continue;
+
+		// Shadow frustums are expressed relative to the pre-shadow translation:
+		// n.(o + t) - w == n.o - (w - n.t), bake the translation in the planes distance.
+		const FVector	translation = shadowPass ? sceneView->GetPreShadowTranslation() : FVector::ZeroVector;
+
+		const u32		permutedPlaneCount = frustum->PermutedPlanes.Num();
+		PK_ASSERT(permutedPlaneCount % 4 == 0);
+		for (u32 planei = 0; planei + 3 < permutedPlaneCount; planei += 4)
+		{
+			const FPlane	&x = frustum->PermutedPlanes[planei + 0];
+			const FPlane	&y = frustum->PermutedPlanes[planei + 1];
+			const FPlane	&z = frustum->PermutedPlanes[planei + 2];
+			const FPlane	&w = frustum->PermutedPlanes[planei + 3];
+
+			SPlaneGroup		group;
+			group.m_X = _PlaneLanes(x);
+			group.m_Y = _PlaneLanes(y);
+			group.m_Z = _PlaneLanes(z);
+			// UE -> PopcornFX space: n.(o * scale) - w == scale * (n.o - w / scale)
+			group.m_W = CFloat4(float((w.X - (x.X * translation.X + y.X * translation.Y + z.X * translation.Z)) * rcpScale) + planesPushOut,
+								float((w.Y - (x.Y * translation.X + y.Y * translation.Y + z.Y * translation.Z)) * rcpScale) + planesPushOut,
+								float((w.Z - (x.Z * translation.X + y.Z * translation.Y + z.Z * translation.Z)) * rcpScale) + planesPushOut,
+								float((w.W - (x.W * translation.X + y.W * translation.Y + z.W * translation.Z)) * rcpScale) + planesPushOut);
+
+			if (!PK_VERIFY(m_PlaneGroups.PushBack(group).Valid()) ||
+				!PK_VERIFY(m_GroupViewIndices.PushBack(u8(viewi)).Valid()))
+			{
+				// Never cull rather than cull wrongly
+				Clear();
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	CViewCuller::Clear()
+{
+	m_PlaneGroups.Clear();
+	m_GroupViewIndices.Clear();
+	m_ViewsMask = 0;
+}
+
+//----------------------------------------------------------------------------
+
+u32	CViewCuller::ViewMask(const PopcornFX::CAABB &bbox) const
+{
+	return _ViewMask(bbox.Center(), bbox.Extent(), 0.0f);
+}
+
+//----------------------------------------------------------------------------
+
+u32	CViewCuller::ViewMask(const CFloat3 &center, float radius) const
+{
+	return _ViewMask(center, CFloat3::ZERO, radius);
+}
+
+//----------------------------------------------------------------------------
+
+u32	CViewCuller::_ViewMask(const CFloat3 &center, const CFloat3 &extent, float radius) const
+{
+	u32		mask = m_ViewsMask;
+
+	const VectorRegister4f	ox = VectorSetFloat1(center.x());
+	const VectorRegister4f	oy = VectorSetFloat1(center.y());
+	const VectorRegister4f	oz = VectorSetFloat1(center.z());
+	const VectorRegister4f	ex = VectorSetFloat1(extent.x());
+	const VectorRegister4f	ey = VectorSetFloat1(extent.y());
+	const VectorRegister4f	ez = VectorSetFloat1(extent.z());
+	const VectorRegister4f	r = VectorSetFloat1(radius);
+
+	const u32				groupCount = m_PlaneGroups.Count();
+	for (u32 groupi = 0; groupi < groupCount; ++groupi)
+	{
+		const u32	viewBit = 1U << m_GroupViewIndices[groupi];
+		if ((mask & viewBit) == 0) // Already outside of that view
+			continue;
+
+		const SPlaneGroup		&group = m_PlaneGroups[groupi];
+		const VectorRegister4f	px = VectorLoad(reinterpret_cast<const float*>(&group.m_X));
+		const VectorRegister4f	py = VectorLoad(reinterpret_cast<const float*>(&group.m_Y));
+		const VectorRegister4f	pz = VectorLoad(reinterpret_cast<const float*>(&group.m_Z));
+		const VectorRegister4f	pw = VectorLoad(reinterpret_cast<const float*>(&group.m_W));
+
+		// Same test as FConvexVolume::IntersectBox, 4 planes at a time
+		VectorRegister4f	distance = VectorMultiply(ox, px);
+		distance = VectorMultiplyAdd(oy, py, distance);
+		distance = VectorMultiplyAdd(oz, pz, distance);
+		distance = VectorSubtract(distance, pw);
+
+		VectorRegister4f	pushOut = VectorMultiplyAdd(ex, VectorAbs(px), r);
+		pushOut = VectorMultiplyAdd(ey, VectorAbs(py), pushOut);
+		pushOut = VectorMultiplyAdd(ez, VectorAbs(pz), pushOut);
+
+		if (VectorAnyGreaterThan(distance, pushOut))
+			mask &= ~viewBit;
+	}
+	return mask;
+}
+
+//----------------------------------------------------------------------------
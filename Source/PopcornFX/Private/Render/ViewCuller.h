@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#pragma once
+
+#include "PopcornFXMinimal.h"
+#include "Render/RendererSubView.h"
+
+#include "PopcornFXSDK.h"
+#include <pk_maths/include/pk_maths_primitives.h>
+
+//----------------------------------------------------------------------------
+//
+//	Frustum planes of all rendered views of a CRendererSubView, laid out for SIMD tests.
+//	Planes are stored in PopcornFX space (translation divided by the global scale),
+//	so boxes and spheres coming from PopcornFX can be tested without conversion.
+//
+//----------------------------------------------------------------------------
+
+class	CViewCuller
+{
+public:
+	enum : u32 { kAllViewsMask = (1U << CRendererSubView::kMaxViews) - 1 };
+
+	CViewCuller() { }
+
+	// Builds the planes of every SSceneView::m_ToRender view.
+	// RenderPass_Shadow uses the views' shadow cull frustums, RenderPass_Main and RenderPass_RT_AccelStructs the view frustums.
+	// 'planesPushOut' (PopcornFX units) moves all planes outwards: used to expand frustums.
+	bool		Setup(const CRendererSubView &view, float planesPushOut = 0.0f);
+	void		Clear();
+
+	bool		Empty() const { return m_ViewsMask == 0; }
+	u32			ViewsMask() const { return m_ViewsMask; }
+
+	// Returns one bit per SceneViews() index, set if the box/sphere intersects that view
+	u32			ViewMask(const PopcornFX::CAABB &bbox) const;
+	u32			ViewMask(const CFloat3 &center, float radius) const;
+
+private:
+	u32			_ViewMask(const CFloat3 &center, const CFloat3 &extent, float radius) const;
+
+private:
+	// 4 planes per group, as FConvexVolume::PermutedPlanes: XXXX YYYY ZZZZ WWWW
+	struct	SPlaneGroup
+	{
+		CFloat4		m_X;
+		CFloat4		m_Y;
+		CFloat4		m_Z;
+		CFloat4		m_W;
+	};
+
+	PopcornFX::TArray<SPlaneGroup>	m_PlaneGroups;
+	PopcornFX::TArray<u8>			m_GroupViewIndices;	// Index in CRendererSubView::SceneViews() of each plane group, groups of a view are contiguous
+	u32								m_ViewsMask = 0;
+};
+
+//----------------------------------------------------------------------------
@@ -5,8 +5,8 @@
 
 #pragma once
 
-#include "GCObject.h"
-#include "SharedPointer.h"
+#include "UObject/GCObject.h"
+#include "Templates/SharedPointer.h"
 
 /**
  * Like TStrongObjectPtr, but TStrongObjectPtrViaShared pass themselves a TSharedPtr instead of reallocating new TUniquePtr.
@@ -126,6 +126,11 @@ private:
 			Collector.AddReferencedObject(Object);
 		}
 
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("TStrongObjectPtrViaShared");
+		}
+
 	private:
 		ObjectType* Object;
 	};
@@ -12,6 +12,8 @@
 #include "PopcornFXEmitter.h"
 #include "Internal/ParticleScene.h"
 #include "PopcornFXAttributeList.h"
+#include "PopcornFXFunctions.h"
+#include "PopcornFXEmitterPool.h"
 #include "Render/RendererSubView.h"
 #include "World/PopcornFXWaitForSceneActor.h"
 #include "Assets/PopcornFXEffectPriv.h"
@@ -78,6 +80,20 @@ UPopcornFXEmitterComponent	*UPopcornFXEmitterComponent::CreateStandaloneEmitterC
 
 //----------------------------------------------------------------------------
 
+// static
+UPopcornFXEmitterComponent	*UPopcornFXEmitterComponent::AcquireStandaloneEmitterComponent(UPopcornFXEffect* effect, APopcornFXSceneActor *scene, UWorld* world, bool bAutoDestroy)
+{
+	if (bAutoDestroy && FPopcornFXPlugin::Get().Settings()->bEnableEmitterPool)
+	{
+		UPopcornFXEmitterPool	*pool = UPopcornFXEmitterPool::Get(world);
+		if (pool != null)
+			return pool->Acquire(effect, scene);
+	}
+	return CreateStandaloneEmitterComponent(effect, scene, world, null, bAutoDestroy);
+}
+
+//----------------------------------------------------------------------------
+
 UPopcornFXEmitterComponent::UPopcornFXEmitterComponent(const FObjectInitializer& PCIP)
 	: Super(PCIP)
 	, m_CurrentScene(null)
@@ -138,6 +154,7 @@ UPopcornFXEmitterComponent::UPopcornFXEmitterComponent(const FObjectInitializer&
 	AttributeList->CheckEmitter(this);
 
 	bAutoDestroy = false;
+	bReturnToPool = false;
 	bHasAlreadyPlayOnLoad = false;
 
 	SetFlags(RF_Transactional);
@@ -461,7 +478,7 @@ UPopcornFXEmitterComponent	*UPopcornFXEmitterComponent::CopyAndStartEmitterAtLoc
 	UPopcornFXEmitterComponent	*psc = null;
 	if (FApp::CanEverRender() && world != null && !world->IsNetMode(NM_DedicatedServer))
 	{
-		psc = CreateStandaloneEmitterComponent(Effect, Scene, world, null, pbAutoDestroy);
+		psc = AcquireStandaloneEmitterComponent(Effect, Scene, world, pbAutoDestroy);
 		if (psc != null)
 		{
 			psc->SetAbsolute(true, true, true);
@@ -513,7 +530,7 @@ UPopcornFXEmitterComponent	*UPopcornFXEmitterComponent::CopyAndStartEmitterAttac
 	UPopcornFXEmitterComponent	*psc = null;
 	if (FApp::CanEverRender() && world != null && !world->IsNetMode(NM_DedicatedServer))
 	{
-		psc = CreateStandaloneEmitterComponent(Effect, Scene, world, null, pbAutoDestroy);
+		psc = AcquireStandaloneEmitterComponent(Effect, Scene, world, pbAutoDestroy);
 		if (psc != null)
 		{
 			psc->AttachToComponent(attachToComponent, FAttachmentTransformRules::KeepRelativeTransform, attachPointName);
@@ -1120,17 +1137,47 @@ UPopcornFXAttributeList	*UPopcornFXEmitterComponent::GetAttributeListIFP() const
 //----------------------------------------------------------------------------
 
 bool	UPopcornFXEmitterComponent::GetPayloadValue(const FString &payloadName, EPopcornFXPayloadType::Type expectedFieldType, void *outValue) const
+{
+	return GetPayloadValue(UPopcornFXFunctions::MakeEventPayloadHandle(payloadName), expectedFieldType, outValue);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterComponent::GetPayloadValue(const FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedFieldType, void *outValue) const
+{
+	if (!PK_VERIFY(m_CurrentScene != null))
+		return false;
+
+	if (!payloadHandle.Valid())
+	{
+		UE_LOG(LogPopcornFXEmitterComponent, Warning, TEXT("Get Payload Value: empty PayloadName for effect '%s'"), *Effect->GetName());
+		return false;
+	}
+
+	return m_CurrentScene->GetPayloadValue(payloadHandle, expectedFieldType, outValue);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterComponent::GetPayloadView(const FString &payloadName, EPopcornFXPayloadType::Type expectedFieldType, FPopcornFXPayloadView &outView) const
+{
+	return GetPayloadView(UPopcornFXFunctions::MakeEventPayloadHandle(payloadName), expectedFieldType, outView);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterComponent::GetPayloadView(const FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedFieldType, FPopcornFXPayloadView &outView) const
 {
 	if (!PK_VERIFY(m_CurrentScene != null))
 		return false;
 
-	if (payloadName.IsEmpty())
+	if (!payloadHandle.Valid())
 	{
-		UE_LOG(LogPopcornFXEmitterComponent, Warning, TEXT("Get Payload Value: empty PayloadName for effect"), *Effect->GetName());
+		UE_LOG(LogPopcornFXEmitterComponent, Warning, TEXT("Get Payload View: empty PayloadName for effect '%s'"), *Effect->GetName());
 		return false;
 	}
 
-	return m_CurrentScene->GetPayloadValue(payloadName, expectedFieldType, outValue);
+	return m_CurrentScene->GetPayloadView(payloadHandle, expectedFieldType, outView);
 }
 
 //----------------------------------------------------------------------------
@@ -1334,12 +1381,8 @@ void	UPopcornFXEmitterComponent::ApplyWorldOffset(const FVector &inOffset, bool
 
 //----------------------------------------------------------------------------
 
-void	UPopcornFXEmitterComponent::Scene_PreUpdate(CParticleScene *scene, float deltaTime)
+bool	UPopcornFXEmitterComponent::Scene_PreUpdate_Gather(CParticleScene *scene, SPopcornFXEmitterUpdateBatch &batch)
 {
-	using namespace PopcornFX;
-	PK_CALL_CONTEXT("Emitter", PopcornFX::CStringView(Effect->Effect()->ParticleEffectIFP()->File()->Path()));
-	PK_SCOPEDPROFILE();
-	LLM_SCOPE(ELLMTag::Particles);
 	PK_ASSERT(!IsTemplate());
 
 	PK_ASSERT(scene != null);
@@ -1347,62 +1390,27 @@ void	UPopcornFXEmitterComponent::Scene_PreUpdate(CParticleScene *scene, float de
 	PK_ASSERT(m_CurrentScene == scene);
 
 	if (!IsValid(this))
-		return;
+		return false;
 	if (m_DiedThisFrame)
-		return;
+		return false;
 	// we should be ticking only if alive (kind-of optim purpose only)
 	PK_ASSERT(IsEmitterAlive());
-
-	const float				scale = FPopcornFXPlugin::GlobalScale();
-	const float				rcpscale = 1.f / scale;
+	if (!PK_VERIFY(m_EffectInstancePtr != null))
+		return false;
 
 	// Scene_PreUpdate is executed once per Update, so Prev Curr should always be processed
 	PK_ASSERT_MESSAGE(m_LastFrameUpdate != GFrameCounter, "Should not happen");
 	m_LastFrameUpdate = GFrameCounter;
 
-	CFloat4x4			&currentTr = ToPkRef(m_CurrentWorldTransforms);
-	CFloat4x4			&previousTr = ToPkRef(m_PreviousWorldTransforms);
-	CFloat3				&prevPrevPos = ToPkRef(m_PreviousWorldPosition); // 2 frames of lag
-	CFloat3				&currentVel = ToPkRef(m_CurrentWorldVelocity);
-	CFloat3				&previousVel = ToPkRef(m_PreviousWorldVelocity);
+	const s32	batchIndex = batch.Add(this);
+	if (!PK_VERIFY(batchIndex >= 0))
+		return false;
 
-	const bool			teleport = bAllowTeleport && m_TeleportThisFrame;
+	const bool	teleport = bAllowTeleport && m_TeleportThisFrame;
 	// Always reset m_TeleportThisFrame
 	if (m_TeleportThisFrame)
 		m_TeleportThisFrame = false;
 
-	if (!teleport)
-	{
-		// Prev = Curr
-		prevPrevPos = previousTr.StrippedTranslations();
-		previousTr = currentTr;
-		previousVel = currentVel;
-	}
-
-	// Update Position
-	currentTr = ToPk(GetComponentTransform().ToMatrixWithScale());
-	currentTr.StrippedTranslations() *= rcpscale;
-
-	// Update Velocity
-	if (!teleport && deltaTime > 0)
-		currentVel = PopcornFX::ParticleToolbox::PredictCurrentVelocity(currentTr.StrippedTranslations(), previousTr.StrippedTranslations(), prevPrevPos, deltaTime);
-	else
-		currentVel = CFloat3::ZERO;
-
-	if (teleport)
-	{
-		// Make previous frame same as current
-		prevPrevPos = currentTr.StrippedTranslations();
-		previousTr = currentTr;
-		previousVel = currentVel;
-	}
-
-	if (IsValid(AttributeList))// && AttributeList->bNeedTick)
-	{
-		AttributeList->CheckEmitter(this);
-		AttributeList->Scene_PreUpdate(this, deltaTime);
-	}
-
 	AActor	*owner = GetOwner();
 	bool	isVisible = IsVisible();
 	float	timeScale = 1.0f;
@@ -1414,10 +1422,44 @@ void	UPopcornFXEmitterComponent::Scene_PreUpdate(CParticleScene *scene, float de
 			isVisible = false;
 #endif
 	}
-	if (PK_VERIFY(m_EffectInstancePtr != null))
+
+	batch.m_EffectInstances[batchIndex] = m_EffectInstancePtr.Get();
+	batch.m_ComponentTransforms[batchIndex] = GetComponentTransform();
+	batch.m_CurrentTransforms[batchIndex] = ToPk(m_CurrentWorldTransforms);
+	batch.m_PreviousTransforms[batchIndex] = ToPk(m_PreviousWorldTransforms);
+	batch.m_PreviousPositions[batchIndex] = ToPk(m_PreviousWorldPosition);
+	batch.m_CurrentVelocities[batchIndex] = ToPk(m_CurrentWorldVelocity);
+	batch.m_PreviousVelocities[batchIndex] = ToPk(m_PreviousWorldVelocity);
+	batch.m_TimeScales[batchIndex] = timeScale * TimeScale;
+	batch.m_Flags[batchIndex] = u8(	(teleport ? SPopcornFXEmitterUpdateBatch::Flag_Teleport : 0) |
+									(isVisible ? SPopcornFXEmitterUpdateBatch::Flag_Visible : 0));
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXEmitterComponent::Scene_PreUpdate_Apply(CParticleScene *scene, const SPopcornFXEmitterUpdateBatch &batch, uint32 batchIndex, float deltaTime)
+{
+	using namespace PopcornFX;
+	PK_CALL_CONTEXT("Emitter", PopcornFX::CStringView(Effect->Effect()->ParticleEffectIFP()->File()->Path()));
+	PK_SCOPEDPROFILE();
+	LLM_SCOPE(ELLMTag::Particles);
+
+	PK_ASSERT(scene != null);
+	PK_ASSERT(m_CurrentScene == scene);
+	PK_ASSERT(batch.m_Emitters[batchIndex] == this);
+
+	// Write back what the batch computed, the effect instance already received its transforms
+	ToPkRef(m_CurrentWorldTransforms) = batch.m_CurrentTransforms[batchIndex];
+	ToPkRef(m_PreviousWorldTransforms) = batch.m_PreviousTransforms[batchIndex];
+	ToPkRef(m_PreviousWorldPosition) = batch.m_PreviousPositions[batchIndex];
+	ToPkRef(m_CurrentWorldVelocity) = batch.m_CurrentVelocities[batchIndex];
+	ToPkRef(m_PreviousWorldVelocity) = batch.m_PreviousVelocities[batchIndex];
+
+	if (IsValid(AttributeList))// && AttributeList->bNeedTick)
 	{
-		m_EffectInstancePtr->SetVisible(isVisible);
-		m_EffectInstancePtr->SetTimeScale(timeScale * TimeScale);
+		AttributeList->CheckEmitter(this);
+		AttributeList->Scene_PreUpdate(this, deltaTime);
 	}
 
 #if WITH_EDITOR
@@ -1840,7 +1882,18 @@ void	UPopcornFXEmitterComponent::CheckForDead()
 		// if effect dies, need to unregister all events listeners
 		UnregisterAllEventsListeners();
 
-		if (bAutoDestroy != 0)
+		if (bReturnToPool != 0)
+		{
+			UPopcornFXEmitterPool	*pool = UPopcornFXEmitterPool::Get(GetWorld());
+			if (pool == null || !pool->Release(this))
+			{
+				bReturnToPool = false;
+				// Avoids nested DestroyComponent()
+				if (IsRegistered())
+					DestroyComponent();
+			}
+		}
+		else if (bAutoDestroy != 0)
 		{
 			// Avoids nested DestroyComponent()
 			if (IsRegistered())
@@ -0,0 +1,191 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#include "PopcornFXEmitterPool.h"
+
+#include "PopcornFXPlugin.h"
+#include "PopcornFXSettings.h"
+#include "PopcornFXEmitterComponent.h"
+#include "PopcornFXSceneActor.h"
+#include "Assets/PopcornFXEffect.h"
+#include "PopcornFXStats.h"
+
+#include "Engine/World.h"
+#include "Misc/App.h"
+
+//----------------------------------------------------------------------------
+
+DEFINE_LOG_CATEGORY_STATIC(LogPopcornFXEmitterPool, Log, All);
+
+//----------------------------------------------------------------------------
+
+// static
+UPopcornFXEmitterPool	*UPopcornFXEmitterPool::Get(const UWorld *world)
+{
+	return world != null ? world->GetSubsystem<UPopcornFXEmitterPool>() : null;
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterPool::ShouldCreateSubsystem(UObject *outer) const
+{
+	// Emitters are never created when the app cannot render (see UPopcornFXFunctions::SpawnEmitterAtLocation)
+	return FApp::CanEverRender() && Super::ShouldCreateSubsystem(outer);
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterPool::DoesSupportWorldType(const EWorldType::Type worldType) const
+{
+	return worldType == EWorldType::Game || worldType == EWorldType::PIE;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXEmitterPool::OnWorldBeginPlay(UWorld &inWorld)
+{
+	Super::OnWorldBeginPlay(inWorld);
+
+	const UPopcornFXSettings	*settings = FPopcornFXPlugin::Get().Settings();
+	if (!settings->bEnableEmitterPool || inWorld.IsNetMode(NM_DedicatedServer))
+		return;
+
+	for (const auto &prewarm : settings->EmitterPoolPrewarmCounts)
+	{
+		if (prewarm.Value <= 0)
+			continue;
+		UPopcornFXEffect	*effect = prewarm.Key.LoadSynchronous();
+		if (effect == null)
+		{
+			UE_LOG(LogPopcornFXEmitterPool, Warning, TEXT("Emitter pool prewarm: couldn't load effect '%s'"), *prewarm.Key.ToString());
+			continue;
+		}
+		Prewarm(effect, prewarm.Value);
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXEmitterPool::Deinitialize()
+{
+	// Pooled emitters are outered to the world, they go away with it
+	m_Pools.Empty();
+	m_Stats = FPopcornFXEmitterPoolStats();
+
+	Super::Deinitialize();
+}
+
+//----------------------------------------------------------------------------
+
+UPopcornFXEmitterComponent	*UPopcornFXEmitterPool::Acquire(UPopcornFXEffect *effect, APopcornFXSceneActor *scene)
+{
+	PK_ASSERT(IsInGameThread());
+
+	UWorld						*world = GetWorld();
+	const UPopcornFXSettings	*settings = FPopcornFXPlugin::Get().Settings();
+	if (settings->bEnableEmitterPool && effect != null)
+	{
+		FPopcornFXEmitterPoolEntry	*entry = m_Pools.Find(effect);
+		while (entry != null && entry->Emitters.Num() > 0)
+		{
+			UPopcornFXEmitterComponent	*emitter = entry->Emitters.Pop();
+			--m_Stats.PooledCount;
+
+			// Could have been destroyed while idle (level streaming, explicit DestroyComponent, ..)
+			if (!IsValid(emitter) || !emitter->IsRegistered() || emitter->GetWorld() != world)
+				continue;
+
+			++m_Stats.HitCount;
+			INC_DWORD_STAT(STAT_PopcornFX_EmitterPoolHitCount);
+
+			// Same state as a fresh CreateStandaloneEmitterComponent()
+			emitter->bEnableUpdates = false;
+			emitter->bPlayOnLoad = false;
+			emitter->bKillParticlesOnDestroy = false;
+			emitter->bAutoDestroy = true;
+			emitter->bAutoActivate = false;
+			emitter->bReturnToPool = true;
+			if (scene != null)
+			{
+				emitter->SceneName = scene->GetSceneName();
+				emitter->Scene = scene;
+			}
+			else
+			{
+				emitter->SceneName = GetDefault<UPopcornFXEmitterComponent>()->SceneName;
+				emitter->Scene = null;
+			}
+			return emitter;
+		}
+	}
+
+	++m_Stats.MissCount;
+	INC_DWORD_STAT(STAT_PopcornFX_EmitterPoolMissCount);
+
+	UPopcornFXEmitterComponent	*emitter = UPopcornFXEmitterComponent::CreateStandaloneEmitterComponent(effect, scene, world, null, true);
+	if (emitter != null)
+		emitter->bReturnToPool = settings->bEnableEmitterPool;
+	return emitter;
+}
+
+//----------------------------------------------------------------------------
+
+bool	UPopcornFXEmitterPool::Release(UPopcornFXEmitterComponent *emitter)
+{
+	PK_ASSERT(IsInGameThread());
+
+	const UPopcornFXSettings	*settings = FPopcornFXPlugin::Get().Settings();
+	if (!settings->bEnableEmitterPool ||
+		!IsValid(emitter) ||
+		!IsValid(emitter->Effect) ||
+		emitter->GetWorld() != GetWorld())
+		return false;
+
+	FPopcornFXEmitterPoolEntry	&entry = m_Pools.FindOrAdd(emitter->Effect);
+	if (entry.Emitters.Num() >= settings->MaxPooledEmittersPerEffect)
+		return false;
+
+	// Don't leak the previous spawn's state to the next one
+	if (emitter->GetAttachParent() != null)
+		emitter->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	emitter->SetAbsolute(false, false, false);
+	emitter->SetRelativeScale3D(FVector(1.f));
+	emitter->OnEmitterStart.Clear();
+	emitter->OnEmitterStop.Clear();
+	emitter->OnEmitterTerminate.Clear();
+	emitter->OnEmitterKillParticles.Clear();
+	emitter->OnEmissionStops.Clear();
+	emitter->ResetAttributesToDefault();
+
+	entry.Emitters.Add(emitter);
+	++m_Stats.PooledCount;
+	return true;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXEmitterPool::Prewarm(UPopcornFXEffect *effect, int32 count)
+{
+	PK_ASSERT(IsInGameThread());
+
+	const UPopcornFXSettings	*settings = FPopcornFXPlugin::Get().Settings();
+	if (!settings->bEnableEmitterPool || effect == null)
+		return;
+
+	UWorld						*world = GetWorld();
+	FPopcornFXEmitterPoolEntry	&entry = m_Pools.FindOrAdd(effect);
+	const int32					targetCount = FMath::Min(count, settings->MaxPooledEmittersPerEffect);
+	while (entry.Emitters.Num() < targetCount)
+	{
+		UPopcornFXEmitterComponent	*emitter = UPopcornFXEmitterComponent::CreateStandaloneEmitterComponent(effect, null, world, null, true);
+		if (emitter == null)
+			break;
+		emitter->bReturnToPool = true;
+		entry.Emitters.Add(emitter);
+		++m_Stats.PooledCount;
+	}
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,389 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#include "PopcornFXSimulationCacheComponent.h"
+
+#include "PopcornFXStats.h"
+
+#include "DynamicMeshBuilder.h"
+#include "PrimitiveSceneProxy.h"
+#include "SceneInterface.h"
+#include "SceneManagement.h"
+#include "Engine/CollisionProfile.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+
+#include "PopcornFXSDK.h"
+
+//----------------------------------------------------------------------------
+//
+// FPopcornFXSimulationCacheSceneProxy
+//
+//----------------------------------------------------------------------------
+
+namespace
+{
+	// Same conversion as CBatchDrawer_Light, with a default attenuation steepness of 1
+	const float		kLightRadiusMultiplier = 3.0f;
+	const float		kLightColorMultiplier = 4.32f + 1.07f;
+	const float		kLightExponent = 16.0f;
+
+	class	FPopcornFXSimulationCacheSceneProxy : public FPrimitiveSceneProxy
+	{
+	public:
+		typedef TSharedPtr<const FPopcornFXSimulationCacheDecodedFrame, ESPMode::ThreadSafe>	FDecodedFramePtr;
+
+		FPopcornFXSimulationCacheSceneProxy(const UPopcornFXSimulationCacheComponent *component, const FDecodedFramePtr &frame)
+		:	FPrimitiveSceneProxy(component)
+		,	m_Frame(frame)
+		{
+			const ERHIFeatureLevel::Type	featureLevel = GetScene().GetFeatureLevel();
+			if (component->SimulationCache != null)
+			{
+				for (const FPopcornFXSimulationCacheTrack &track : component->SimulationCache->Tracks)
+				{
+					SMaterialTrack	&materialTrack = m_Tracks.AddDefaulted_GetRef();
+					materialTrack.m_IsLight = track.Type == EPopcornFXSimulationCacheTrackType::Light;
+					if (materialTrack.m_IsLight)
+						continue;
+					materialTrack.m_Material = track.Material != null ? track.Material : UMaterial::GetDefaultMaterial(MD_Surface);
+					m_MaterialRelevance |= materialTrack.m_Material->GetRelevance_Concurrent(featureLevel);
+				}
+			}
+		}
+
+		virtual SIZE_T	GetTypeHash() const override
+		{
+			static size_t UniquePointer;
+			return reinterpret_cast<size_t>(&UniquePointer);
+		}
+
+		virtual uint32	GetMemoryFootprint() const override
+		{
+			return sizeof(*this) + GetAllocatedSize();
+		}
+
+		void	RenderThread_SetFrame(const FDecodedFramePtr &frame)
+		{
+			check(IsInRenderingThread());
+			m_Frame = frame;
+		}
+
+		virtual FPrimitiveViewRelevance	GetViewRelevance(const FSceneView *view) const override
+		{
+			FPrimitiveViewRelevance	viewRelevance;
+			viewRelevance.bDrawRelevance = IsShown(view) && view->Family->EngineShowFlags.Particles;
+			viewRelevance.bDynamicRelevance = true;
+			viewRelevance.bHasSimpleLights = true;
+			viewRelevance.bShadowRelevance = IsShadowCast(view);
+			viewRelevance.bRenderInMainPass = ShouldRenderInMainPass();
+			viewRelevance.bRenderCustomDepth = ShouldRenderCustomDepth();
+			m_MaterialRelevance.SetPrimitiveViewRelevance(viewRelevance);
+			return viewRelevance;
+		}
+
+		virtual void	GetDynamicMeshElements(const TArray<const FSceneView*> &views, const FSceneViewFamily &viewFamily, uint32 visibilityMap, FMeshElementCollector &collector) const override
+		{
+			PK_NAMEDSCOPEDPROFILE_C("FPopcornFXSimulationCacheSceneProxy::GetDynamicMeshElements", POPCORNFX_UE_PROFILER_COLOR);
+
+			const FDecodedFramePtr	frame = m_Frame;
+			if (!frame.IsValid() || frame->Tracks.Num() != m_Tracks.Num())
+				return;
+
+			const FMatrix	&localToWorld = GetLocalToWorld();
+			const FMatrix	worldToLocal = localToWorld.InverseFast();
+			for (int32 viewi = 0; viewi < views.Num(); ++viewi)
+			{
+				if ((visibilityMap & (1 << viewi)) == 0)
+					continue;
+				const FSceneView	*view = views[viewi];
+
+				// Billboard axes in component space, sizes are already relative to the component scale
+				const FVector3f	viewRight = FVector3f(worldToLocal.TransformVector(view->GetViewRight()).GetSafeNormal());
+				const FVector3f	viewUp = FVector3f(worldToLocal.TransformVector(view->GetViewUp()).GetSafeNormal());
+				const FVector3f	viewNormal = FVector3f(worldToLocal.TransformVector(-view->GetViewDirection()).GetSafeNormal());
+
+				for (int32 tracki = 0; tracki < m_Tracks.Num(); ++tracki)
+				{
+					const SMaterialTrack							&materialTrack = m_Tracks[tracki];
+					const FPopcornFXSimulationCacheDecodedTrack	&track = frame->Tracks[tracki];
+					const int32										pcount = track.Positions.Num();
+					if (materialTrack.m_IsLight || pcount == 0)
+						continue;
+
+					FDynamicMeshBuilder	meshBuilder(view->GetFeatureLevel());
+					meshBuilder.ReserveVertices(pcount * 4);
+					meshBuilder.ReserveTriangles(pcount * 2);
+					for (int32 parti = 0; parti < pcount; ++parti)
+					{
+						const FVector3f	&center = track.Positions[parti];
+						const float		size = track.Sizes[parti];
+						float			s, c;
+						FMath::SinCos(&s, &c, track.Rotations[parti]);
+						const FVector3f	right = (viewRight * c + viewUp * s) * size;
+						const FVector3f	up = (viewUp * c - viewRight * s) * size;
+						const FColor	color = track.Colors[parti].ToFColor(false);
+
+						const int32		first = meshBuilder.AddVertex(center - right - up, FVector2f(0.0f, 1.0f), right.GetSafeNormal(), up.GetSafeNormal(), viewNormal, color);
+						meshBuilder.AddVertex(center + right - up, FVector2f(1.0f, 1.0f), right.GetSafeNormal(), up.GetSafeNormal(), viewNormal, color);
+						meshBuilder.AddVertex(center + right + up, FVector2f(1.0f, 0.0f), right.GetSafeNormal(), up.GetSafeNormal(), viewNormal, color);
+						meshBuilder.AddVertex(center - right + up, FVector2f(0.0f, 0.0f), right.GetSafeNormal(), up.GetSafeNormal(), viewNormal, color);
+						meshBuilder.AddTriangle(first, first + 1, first + 2);
+						meshBuilder.AddTriangle(first, first + 2, first + 3);
+					}
+					FMaterialRenderProxy	*materialProxy = materialTrack.m_Material->GetRenderProxy();
+					meshBuilder.GetMesh(localToWorld, materialProxy, SDPG_World, true, false, viewi, collector);
+				}
+			}
+		}
+
+		virtual void	GatherSimpleLights(const FSceneViewFamily &viewFamily, FSimpleLightArray &outParticleLights) const override
+		{
+			const FDecodedFramePtr	frame = m_Frame;
+			if (!frame.IsValid() || frame->Tracks.Num() != m_Tracks.Num())
+				return;
+
+			const FMatrix	&localToWorld = GetLocalToWorld();
+			const float		radiusScale = localToWorld.GetMaximumAxisScale() * kLightRadiusMultiplier;
+			for (int32 tracki = 0; tracki < m_Tracks.Num(); ++tracki)
+			{
+				if (!m_Tracks[tracki].m_IsLight)
+					continue;
+				const FPopcornFXSimulationCacheDecodedTrack	&track = frame->Tracks[tracki];
+				const int32										pcount = track.Positions.Num();
+				outParticleLights.InstanceData.Reserve(outParticleLights.InstanceData.Num() + pcount);
+				outParticleLights.PerViewData.Reserve(outParticleLights.PerViewData.Num() + pcount);
+				for (int32 parti = 0; parti < pcount; ++parti)
+				{
+					FSimpleLightEntry	&lightData = outParticleLights.InstanceData.AddDefaulted_GetRef();
+					const FLinearColor	&color = track.Colors[parti];
+					lightData.Color = FVector3f(color.R, color.G, color.B) * kLightColorMultiplier;
+					lightData.Radius = track.Sizes[parti] * radiusScale;
+					lightData.Exponent = kLightExponent;
+					lightData.bAffectTranslucency = true;
+
+					FSimpleLightPerViewEntry	&lightPosition = outParticleLights.PerViewData.AddDefaulted_GetRef();
+					lightPosition.Position = localToWorld.TransformPosition(FVector(track.Positions[parti]));
+				}
+			}
+		}
+
+	private:
+		struct	SMaterialTrack
+		{
+			bool				m_IsLight = false;
+			UMaterialInterface	*m_Material = null;
+		};
+
+		TArray<SMaterialTrack>	m_Tracks;
+		FMaterialRelevance		m_MaterialRelevance;
+		FDecodedFramePtr		m_Frame;
+	};
+}
+
+//----------------------------------------------------------------------------
+//
+// UPopcornFXSimulationCacheComponent
+//
+//----------------------------------------------------------------------------
+
+UPopcornFXSimulationCacheComponent::UPopcornFXSimulationCacheComponent(const FObjectInitializer& PCIP)
+	: Super(PCIP)
+	, SimulationCache(null)
+	, bLooping(true)
+	, PlayRate(1.0f)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	PrimaryComponentTick.bAllowTickOnDedicatedServer = false;
+	bTickInEditor = true;
+	bAutoActivate = true;
+
+	SetGenerateOverlapEvents(false);
+	SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+	CastShadow = false;
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::SetSimulationCache(UPopcornFXSimulationCache *InSimulationCache)
+{
+	if (SimulationCache == InSimulationCache)
+		return;
+	_WaitPendingDecode();
+	SimulationCache = InSimulationCache;
+	_ResetPlayback();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::SetPlaybackTime(float Time)
+{
+	m_PlaybackTime = FMath::Max(Time, 0.0f);
+}
+
+//----------------------------------------------------------------------------
+
+#if WITH_EDITOR
+void	UPopcornFXSimulationCacheComponent::PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent)
+{
+	if (propertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UPopcornFXSimulationCacheComponent, SimulationCache))
+	{
+		_WaitPendingDecode();
+		_ResetPlayback();
+	}
+	Super::PostEditChangeProperty(propertyChangedEvent);
+}
+#endif // WITH_EDITOR
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::_ResetPlayback()
+{
+	m_PlaybackTime = 0.0f;
+	_ResetFrames();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::_ResetFrames()
+{
+	m_CacheLayoutRevision = SimulationCache != null ? SimulationCache->GetLayoutRevision() : 0;
+	m_RequestedFrame = -1;
+	m_CurrentFrame = null;
+	m_FrameDirty = false;
+	MarkRenderStateDirty(); // Tracks and materials changed
+	UpdateBounds();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::_WaitPendingDecode()
+{
+	if (m_PendingDecode.IsValid())
+	{
+		m_PendingDecode.Wait();
+		m_PendingDecode = UE::Tasks::TTask<FDecodedFramePtr>();
+	}
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::OnUnregister()
+{
+	_WaitPendingDecode();
+	Super::OnUnregister();
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::TickComponent(float deltaTime, enum ELevelTick tickType, FActorComponentTickFunction *thisTickFunction)
+{
+	LLM_SCOPE(ELLMTag::Particles);
+	PK_NAMEDSCOPEDPROFILE_C("UPopcornFXSimulationCacheComponent::TickComponent", POPCORNFX_UE_PROFILER_COLOR);
+
+	Super::TickComponent(deltaTime, tickType, thisTickFunction);
+
+	// The asset was re-recorded or edited: decoded frames and the scene proxy's tracks are stale
+	if (SimulationCache != null && SimulationCache->GetLayoutRevision() != m_CacheLayoutRevision)
+	{
+		_WaitPendingDecode();
+		_ResetFrames();
+	}
+
+	// Pick up the frame decoded since last tick
+	if (m_PendingDecode.IsValid() && m_PendingDecode.IsCompleted())
+	{
+		FDecodedFramePtr	frame = m_PendingDecode.GetResult();
+		m_PendingDecode = UE::Tasks::TTask<FDecodedFramePtr>();
+		if (frame.IsValid())
+		{
+			m_CurrentFrame = frame;
+			m_FrameDirty = true;
+			UpdateBounds();
+			MarkRenderDynamicDataDirty();
+		}
+	}
+
+	if (SimulationCache == null || SimulationCache->IsRecording() || SimulationCache->GetFrameCount() == 0)
+		return;
+
+	const float	duration = SimulationCache->GetDuration();
+	m_PlaybackTime += deltaTime * PlayRate;
+	if (m_PlaybackTime > duration)
+		m_PlaybackTime = (bLooping && duration > 0.0f) ? FMath::Fmod(m_PlaybackTime, duration) : duration;
+
+	const int32	frameIndex = SimulationCache->FindFrame(m_PlaybackTime);
+	if (frameIndex == m_RequestedFrame || m_PendingDecode.IsValid())
+		return; // Up to date, or decoding: requests the new frame next tick
+
+	// Decode off the game thread from a copy of the frame data, the asset can be re-recorded meanwhile
+	TArray<uint8>	frameData(SimulationCache->GetFrameData(frameIndex));
+	const int32		trackCount = SimulationCache->Tracks.Num();
+	const FBox		bounds = SimulationCache->Frames[frameIndex].Bounds;
+	m_RequestedFrame = frameIndex;
+	m_PendingDecode = UE::Tasks::Launch(UE_SOURCE_LOCATION, [frameData = MoveTemp(frameData), trackCount, frameIndex, bounds]() -> FDecodedFramePtr
+	{
+		TSharedPtr<FPopcornFXSimulationCacheDecodedFrame, ESPMode::ThreadSafe>	frame = MakeShared<FPopcornFXSimulationCacheDecodedFrame, ESPMode::ThreadSafe>();
+		if (!UPopcornFXSimulationCache::DecodeFrameData(frameData, trackCount, *frame))
+			return null;
+		frame->FrameIndex = frameIndex;
+		frame->Bounds = bounds;
+		return frame;
+	});
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::SendRenderDynamicData_Concurrent()
+{
+	Super::SendRenderDynamicData_Concurrent();
+
+	if (!m_FrameDirty || SceneProxy == null)
+		return;
+	m_FrameDirty = false;
+
+	FPopcornFXSimulationCacheSceneProxy	*sceneProxy = static_cast<FPopcornFXSimulationCacheSceneProxy*>(SceneProxy);
+	ENQUEUE_RENDER_COMMAND(PopcornFXSimulationCacheSetFrame)(
+		[sceneProxy, frame = m_CurrentFrame](FRHICommandListImmediate &RHICmdList)
+		{
+			sceneProxy->RenderThread_SetFrame(frame);
+		});
+}
+
+//----------------------------------------------------------------------------
+
+FBoxSphereBounds	UPopcornFXSimulationCacheComponent::CalcBounds(const FTransform &LocalToWorld) const
+{
+	if (m_CurrentFrame.IsValid() && m_CurrentFrame->Bounds.IsValid)
+		return FBoxSphereBounds(m_CurrentFrame->Bounds.TransformBy(LocalToWorld));
+	return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.0f);
+}
+
+//----------------------------------------------------------------------------
+
+FPrimitiveSceneProxy	*UPopcornFXSimulationCacheComponent::CreateSceneProxy()
+{
+	if (SimulationCache == null || SimulationCache->Tracks.IsEmpty())
+		return null;
+	m_FrameDirty = false;
+	return new FPopcornFXSimulationCacheSceneProxy(this, m_CurrentFrame);
+}
+
+//----------------------------------------------------------------------------
+
+void	UPopcornFXSimulationCacheComponent::GetUsedMaterials(TArray<UMaterialInterface*>& OutMaterials, bool bGetDebugMaterials) const
+{
+	Super::GetUsedMaterials(OutMaterials, bGetDebugMaterials);
+	if (SimulationCache == null)
+		return;
+	for (const FPopcornFXSimulationCacheTrack &track : SimulationCache->Tracks)
+	{
+		if (track.Type == EPopcornFXSimulationCacheTrackType::Billboard)
+			OutMaterials.AddUnique(track.Material != null ? track.Material : UMaterial::GetDefaultMaterial(MD_Surface));
+	}
+}
+
+//----------------------------------------------------------------------------
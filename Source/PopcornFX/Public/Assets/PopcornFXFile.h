@@ -108,6 +108,10 @@ public:
 	virtual void				PostInitProperties() override;
 	virtual void				PostRename(UObject* OldOuter, const FName OldName) override;
 	virtual void				BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void				PreEditUndo() override;
+	virtual void				PostEditUndo() override;
+#endif // WITH_EDITOR
 
 	// overrides IInterface_AssetUserData
 	virtual void							AddAssetUserData(UAssetUserData* inUserData) override;
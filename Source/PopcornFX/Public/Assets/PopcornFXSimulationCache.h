@@ -8,11 +8,160 @@
 #include "Assets/PopcornFXFile.h"
 #include "PopcornFXSimulationCache.generated.h"
 
-/** PopcornFX Simulation Cache asset imported from a .pksc file. */
+class	UPopcornFXEmitterComponent;
+class	UMaterialInterface;
+class	FPopcornFXSimulationCacheRecorder;
+
+UENUM()
+namespace EPopcornFXSimulationCacheTrackType
+{
+	enum	Type
+	{
+		Billboard,
+		Light,
+	};
+}
+
+/** A recorded renderer of the source effect */
+USTRUCT()
+struct POPCORNFX_API FPopcornFXSimulationCacheTrack
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(Category="PopcornFX SimulationCache", VisibleAnywhere)
+	TEnumAsByte<EPopcornFXSimulationCacheTrackType::Type>	Type;
+
+	/** Index of the recorded renderer in the source effect */
+	UPROPERTY(Category="PopcornFX SimulationCache", VisibleAnywhere)
+	int32					RendererIndex;
+
+	/** Material the billboards of this track are rendered with */
+	UPROPERTY(Category="PopcornFX SimulationCache", EditAnywhere)
+	UMaterialInterface		*Material;
+
+	FPopcornFXSimulationCacheTrack()
+	:	Type(EPopcornFXSimulationCacheTrackType::Billboard)
+	,	RendererIndex(-1)
+	,	Material(nullptr)
+	{ }
+};
+
+/** A recorded frame: the quantized particles of all tracks are stored in UPopcornFXSimulationCache::FrameData */
+USTRUCT()
+struct POPCORNFX_API FPopcornFXSimulationCacheFrame
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Time since the start of the recording, in seconds */
+	UPROPERTY()
+	float		Time;
+
+	UPROPERTY()
+	uint32		DataOffset;
+
+	UPROPERTY()
+	uint32		DataSize;
+
+	/** Particle bounds, in emitter space */
+	UPROPERTY()
+	FBox		Bounds;
+
+	FPopcornFXSimulationCacheFrame()
+	:	Time(0.0f)
+	,	DataOffset(0)
+	,	DataSize(0)
+	,	Bounds(ForceInit)
+	{ }
+};
+
+/** Decoded particles of a track, in emitter space */
+struct POPCORNFX_API FPopcornFXSimulationCacheDecodedTrack
+{
+	TArray<FVector3f>		Positions;
+	TArray<float>			Sizes; // Radius for lights
+	TArray<float>			Rotations; // Radians
+	TArray<FLinearColor>	Colors;
+};
+
+/** Decoded frame, one entry per UPopcornFXSimulationCache::Tracks */
+struct POPCORNFX_API FPopcornFXSimulationCacheDecodedFrame
+{
+	int32											FrameIndex = -1;
+	FBox											Bounds = FBox(ForceInit);
+	TArray<FPopcornFXSimulationCacheDecodedTrack>	Tracks;
+};
+
+/**
+*	PopcornFX Simulation Cache asset imported from a .pksc file.
+*	Can also hold frames recorded from an emitter with StartRecording(): the rendered particles are quantized and
+*	played back by UPopcornFXSimulationCacheComponent without running the simulation.
+*/
 UCLASS(MinimalAPI)
 class UPopcornFXSimulationCache : public UPopcornFXFile
 {
 	GENERATED_UCLASS_BODY()
 public:
+	/** Recorded tracks, one per CPU billboard or light renderer of the source effect */
+	UPROPERTY(Category="PopcornFX SimulationCache", EditAnywhere, EditFixedSize)
+	TArray<FPopcornFXSimulationCacheTrack>	Tracks;
+
+	UPROPERTY()
+	TArray<FPopcornFXSimulationCacheFrame>	Frames;
+
+	/** Quantized particles of all frames */
+	UPROPERTY()
+	TArray<uint8>							FrameData;
+
+	/**
+	*	Starts recording the particles rendered by 'Emitter' (CPU billboard and light renderers), clearing any previously recorded frame.
+	*	Particles are stored relative to the emitter transform at the time the recording starts.
+	*	Every instance of the emitter's effect in the scene is recorded: record the effect in isolation.
+	*	@param FrameRate Maximum number of frames recorded per second
+	*	@param Duration Recording automatically stops after this many seconds
+	*/
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|SimulationCache")
+	bool					StartRecording(UPopcornFXEmitterComponent *Emitter, float FrameRate = 30.0f, float Duration = 5.0f);
+
+	/** Stops the current recording and stores the recorded frames in this asset. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|SimulationCache")
+	bool					StopRecording();
+
+	UFUNCTION(BlueprintPure, Category="PopcornFX|SimulationCache")
+	bool					IsRecording() const { return m_Recorder.IsValid(); }
+
+	/** Duration of the recorded frames, in seconds */
+	UFUNCTION(BlueprintPure, Category="PopcornFX|SimulationCache")
+	float					GetDuration() const { return Frames.Num() > 0 ? Frames.Last().Time : 0.0f; }
+
+	UFUNCTION(BlueprintPure, Category="PopcornFX|SimulationCache")
+	int32					GetFrameCount() const { return Frames.Num(); }
+
+	/** Index of the last frame recorded at or before 'time', -1 if there are no frames */
+	int32					FindFrame(float time) const;
+
+	/** Decodes a recorded frame. Game thread, or any thread as long as the asset isn't recording. */
+	bool					DecodeFrame(int32 frameIndex, FPopcornFXSimulationCacheDecodedFrame &outFrame) const;
+
+	/** Encoded data of a recorded frame, empty if 'frameIndex' is invalid */
+	TConstArrayView<uint8>	GetFrameData(int32 frameIndex) const;
+
+	/** Decodes frame data copied from GetFrameData(): does not touch the asset, safe to call from worker threads */
+	static bool				DecodeFrameData(TConstArrayView<uint8> frameData, int32 trackCount, FPopcornFXSimulationCacheDecodedFrame &outFrame);
+
+	/** Incremented each time Tracks or the recorded frames change: render states built from the previous ones are stale */
+	uint32					GetLayoutRevision() const { return m_LayoutRevision; }
+
+	// overrides UObject
+	virtual void			BeginDestroy() override;
+#if WITH_EDITOR
+	virtual void			PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent) override;
+#endif // WITH_EDITOR
+
+private:
+	void					_StoreRecordedFrames();
 
+private:
+	TSharedPtr<FPopcornFXSimulationCacheRecorder, ESPMode::ThreadSafe>	m_Recorder;
+	FDelegateHandle														m_RecorderTickHandle;
+	uint32																m_LayoutRevision = 0;
 };
@@ -12,6 +12,21 @@
 
 class UPopcornFXEmitterComponent;
 
+/** One value of UPopcornFXAttributeFunctions::SetAttributesBatched */
+USTRUCT(BlueprintType)
+struct FPopcornFXAttributeBatchValue
+{
+	GENERATED_BODY()
+
+	/** Index of the Attribute, see FindAttributeIndex */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PopcornFX|Attributes")
+	int32		AttributeIndex = -1;
+
+	/** Converted to the Attribute type: truncated for int Attributes, true if non zero for bool Attributes. Components past the Attribute dimension are ignored */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="PopcornFX|Attributes")
+	FVector4	Value = FVector4(0.0f, 0.0f, 0.0f, 0.0f);
+};
+
 UCLASS()
 class POPCORNFX_API UPopcornFXAttributeFunctions : public UBlueprintFunctionLibrary
 {
@@ -23,6 +38,15 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="PopcornFX|Attributes", meta=(DefaultToSelf="Emitter"))
 	static int32			FindAttributeIndex(const UPopcornFXEmitterComponent *Emitter, FString InAttributeName);
 
+	/// Returns the index of each Attribute, -1 for unknown names. Resolve once, then use the indices with SetAttributesBatched
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="PopcornFX|Attributes", meta=(DefaultToSelf="Emitter"))
+	static void				FindAttributeIndices(const UPopcornFXEmitterComponent *Emitter, const TArray<FString> &InAttributeNames, TArray<int32> &OutAttributeIndices);
+
+	/// Sets several Attributes at once. Values are staged and sent to the effect instance in a single pass before the next simulation update
+	/// Returns the number of values that were staged
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|Attributes", meta=(DefaultToSelf="Emitter"))
+	static int32			SetAttributesBatched(UPopcornFXEmitterComponent *Emitter, const TArray<FPopcornFXAttributeBatchValue> &InValues, bool InApplyGlobalScale = false);
+
 	/// Reset Attribute values to default
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="PopcornFX|Attributes", meta=(DefaultToSelf="Emitter"))
 	static bool				ResetToDefaultValue(UPopcornFXEmitterComponent *Emitter, int32 InAttributeIndex);
@@ -269,6 +269,11 @@ public:
 	void												GetAttribute(uint32 attributeId, FPopcornFXAttributeValue &outValue) const;
 	void												SetAttribute(uint32 attributeId, const FPopcornFXAttributeValue &value, bool fromUI = false);
 
+	// Writes the value in the raw data only: the effect instance receives all staged values at once during the next Scene_PreUpdate
+	void												StageAttribute(uint32 attributeId, const FPopcornFXAttributeValue &value);
+	bool												HasStagedAttributes() const { return m_HasStagedAttributes; }
+	void												FlushStagedAttributes();
+
 	bool												SetAttributeSampler(const FString &samplerName, AActor *actor, const FString &propertyName);
 
 #if WITH_EDITOR
@@ -303,6 +308,18 @@ private:
 	void			_RefreshAttributes(const UPopcornFXEmitterComponent *emitter);
 	void			_RefreshAttributeSamplers(UPopcornFXEmitterComponent *emitter, bool reload);
 
+	const UPopcornFXAttributeList	*_NameIndicesSource() const;
+	void			_BuildNameIndicesIFN() const;
+	void			_OnLayoutChanged();
+
+	// Name -> index lookups, built on first use. Emitter lists use the ones of their effect's default attribute list while its layout matches
+	mutable TMap<FString, int32>		m_AttributeIndices;
+	mutable TMap<FString, int32>		m_SamplerIndices;
+	mutable bool						m_NameIndicesBuilt = false;
+
+	TBitArray<>							m_StagedAttributes;
+	bool								m_HasStagedAttributes = false;
+
 public:
 	UPROPERTY()
 	UPopcornFXEffect					*m_Effect;
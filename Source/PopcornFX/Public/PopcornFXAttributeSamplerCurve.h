@@ -126,6 +126,7 @@ private:
 	bool			RebuildCurvesData();
 	void			FetchCurveData(const FRichCurve *curve, PopcornFX::CCurveDescriptor *curveSampler, uint32 axis);
 	bool			SetupCurve(PopcornFX::CCurveDescriptor *curveSampler, UCurveBase *curve);
+	bool			BakeCurve(PopcornFX::CCurveDescriptor *curveSampler, const TArray<struct FRichCurveEditInfo> &curves);
 	void			GetAssociatedCurves(UCurveBase *&curve0, UCurveBase *&curve1);
 
 private:
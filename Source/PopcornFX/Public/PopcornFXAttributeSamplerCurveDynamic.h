@@ -77,6 +77,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
 	bool	SetTangents4D(const TArray<FLinearColor> &ArriveTangents, const TArray<FLinearColor> &LeaveTangents);
 
+	/**
+	*	Overrides the times of the keys at KeyIndices. Times must be in the 0-1 range, and must have been set with SetTimes first.
+	*	Only the modified keys are patched into the curve.
+	*/
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetKeyTimes(const TArray<int32> &KeyIndices, const TArray<float> &Times);
+
+	/** Overrides the values of the keys at KeyIndices from a float array. Only the modified keys are patched into the curve. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetKeys1D(const TArray<int32> &KeyIndices, const TArray<float> &Values);
+
+	/** Overrides the values of the keys at KeyIndices from a vector array. Only the modified keys are patched into the curve. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetKeys3D(const TArray<int32> &KeyIndices, const TArray<FVector> &Values);
+
+	/** Overrides the values of the keys at KeyIndices from a color array. Only the modified keys are patched into the curve. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetKeys4D(const TArray<int32> &KeyIndices, const TArray<FLinearColor> &Values);
+
+	/** Overrides the values and tangents of the keys at KeyIndices from float arrays. Tangents must have been set with SetTangents1D first. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetSplineKeys1D(const TArray<int32> &KeyIndices, const TArray<float> &Values, const TArray<float> &ArriveTangents, const TArray<float> &LeaveTangents);
+
+	/** Overrides the values and tangents of the keys at KeyIndices from vector arrays. Tangents must have been set with SetTangents3D first. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetSplineKeys3D(const TArray<int32> &KeyIndices, const TArray<FVector> &Values, const TArray<FVector> &ArriveTangents, const TArray<FVector> &LeaveTangents);
+
+	/** Overrides the values and tangents of the keys at KeyIndices from color arrays. Tangents must have been set with SetTangents4D first. */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX AttributeSampler")
+	bool	SetSplineKeys4D(const TArray<int32> &KeyIndices, const TArray<FLinearColor> &Values, const TArray<FLinearColor> &ArriveTangents, const TArray<FLinearColor> &LeaveTangents);
+
 private:
 	void	BeginDestroy() override;
 	bool	CreateCurveIFN();
@@ -87,6 +118,9 @@ private:
 	template <class _Type>
 	bool	SetTangentsGeneric(const TArray<_Type> &arriveTangents, const TArray<_Type> &leaveTangents);
 
+	template <class _Type>
+	bool	SetKeysGeneric(const TArray<int32> &keyIndices, const TArray<_Type> &values, const TArray<_Type> *arriveTangents, const TArray<_Type> *leaveTangents);
+
 	// PopcornFX Internal
 	virtual PopcornFX::CParticleSamplerDescriptor	*_AttribSampler_SetupSamplerDescriptor(UPopcornFXEmitterComponent *emitter, FPopcornFXSamplerDesc &desc, const PopcornFX::CResourceDescriptor *defaultSampler) override;
 	virtual void									_AttribSampler_PreUpdate(float deltaTime) override;
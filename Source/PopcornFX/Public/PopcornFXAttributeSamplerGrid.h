@@ -41,6 +41,17 @@ namespace	EPopcornFXGridDataType
 	};
 }
 
+/** Grid data type matching a grid cell type, for UPopcornFXAttributeSamplerGrid::GetCellsView() */
+template <typename CellType> struct	TPopcornFXGridCellDataType;
+template <> struct	TPopcornFXGridCellDataType<float>		{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Float; };
+template <> struct	TPopcornFXGridCellDataType<FVector2f>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Float2; };
+template <> struct	TPopcornFXGridCellDataType<FVector3f>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Float3; };
+template <> struct	TPopcornFXGridCellDataType<FVector4f>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Float4; };
+template <> struct	TPopcornFXGridCellDataType<int32>		{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Int; };
+template <> struct	TPopcornFXGridCellDataType<FIntPoint>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Int2; };
+template <> struct	TPopcornFXGridCellDataType<FIntVector>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Int3; };
+template <> struct	TPopcornFXGridCellDataType<FIntVector4>	{ static constexpr EPopcornFXGridDataType::Type	Value = EPopcornFXGridDataType::Int4; };
+
 UENUM(BlueprintType)
 enum	EPopcornFXGridOrder
 {
@@ -182,6 +193,81 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "WriteGridValues", BlueprintInternalUseOnly = "true", DefaultToSelf = "InGrid"))
 	static bool	WriteGridInt4Values(UPopcornFXAttributeSamplerGrid *InGrid, const TArray<FIntVector4> &InValues);
 
+	/**
+		Reads the cells of the box starting at RegionMin, of RegionSize cells, X first, then Y, then Z.
+		Only works with CPU simulated particles.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Float)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridFloatRegion(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<float> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Float2)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridFloat2Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector2D> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Float3)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridFloat3Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Float4)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridFloat4Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FVector4> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Int)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridIntRegion(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<int> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Int2)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridInt2Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntPoint> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Int3)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridInt3Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntVector> &OutValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Read Grid Region (Int4)", DefaultToSelf = "InGrid"))
+	static bool	ReadGridInt4Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, TArray<FIntVector4> &OutValues);
+
+	/**
+		Writes the cells of the box starting at RegionMin, of RegionSize cells, X first, then Y, then Z.
+		Only the written region is uploaded to GPU grids.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Float)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridFloatRegion(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<float> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Float2)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridFloat2Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector2D> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Float3)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridFloat3Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Float4)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridFloat4Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FVector4> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Int)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridIntRegion(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<int> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Int2)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridInt2Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntPoint> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Int3)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridInt3Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntVector> &InValues);
+
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler", meta = (DisplayName = "Write Grid Region (Int4)", DefaultToSelf = "InGrid"))
+	static bool	WriteGridInt4Region(UPopcornFXAttributeSamplerGrid *InGrid, FIntVector RegionMin, FIntVector RegionSize, const TArray<FIntVector4> &InValues);
+
+	/** Flags the cells of the box starting at RegionMin, of RegionSize cells, as modified: call it after writing cells through GetCellsView() */
+	UFUNCTION(BlueprintCallable, Category = "PopcornFX AttributeSampler")
+	void		MarkRegionDirty(FIntVector RegionMin, FIntVector RegionSize);
+
+	/**
+		Direct access to the grid cells, X first, then Y, then Z, without any copy.
+		CellType must match the grid data type (float, FVector2f, FVector3f, FVector4f, int32, FIntPoint, FIntVector or FIntVector4).
+		Empty if the grid isn't built yet or if CellType doesn't match. Call MarkRegionDirty() with the modified cells.
+	*/
+	template <typename CellType>
+	TArrayView<CellType>	GetCellsView()
+	{
+		int32	cellCount = 0;
+		void	*cells = GetRawCells(TPopcornFXGridCellDataType<CellType>::Value, sizeof(CellType), cellCount);
+		return TArrayView<CellType>(static_cast<CellType*>(cells), cellCount);
+	}
+
+	void		*GetRawCells(EPopcornFXGridDataType::Type dataType, uint32 cellSizeInBytes, int32 &outCellCount);
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="PopcornFX AttributeSampler")
 	FPopcornFXAttributeSamplerPropertiesGrid	Properties;
 
@@ -204,6 +290,7 @@ public:
 	virtual bool									ArePropertiesSupported() override;
 	virtual bool									ArePropertiesCompatible(UPopcornFXEmitterComponent *emitter, const PopcornFX::CResourceDescriptor *defaultSampler) override;
 	virtual PopcornFX::CParticleSamplerDescriptor	*_AttribSampler_SetupSamplerDescriptor(UPopcornFXEmitterComponent *emitter, FPopcornFXSamplerDesc &desc, const PopcornFX::CResourceDescriptor *defaultSampler) override;
+	virtual void									_AttribSampler_PreUpdate(float deltaTime) override;
 
 private:
 	bool						RebuildGridSampler(UPopcornFXEmitterComponent *emitter, const PopcornFX::CResourceDescriptor *defaultSampler);
@@ -212,7 +299,13 @@ private:
 	bool						IsRenderTargetCompatible(const UTextureRenderTarget *texture, UPopcornFXEmitterComponent *emitter, const PopcornFX::CResourceDescriptor *defaultSampler);
 	bool						HasRenderTargetChanged() const;
 	static bool					CanReadFromGrid(UPopcornFXAttributeSamplerGrid *Grid, EPopcornFXGridDataType::Type WantedType);
-	static bool					CanWriteToGrid(UPopcornFXAttributeSamplerGrid *Grid, EPopcornFXGridDataType::Type WantedType, const int32 InValuesCount);
+	static bool					CanWriteToGrid(UPopcornFXAttributeSamplerGrid *Grid, EPopcornFXGridDataType::Type WantedType, const int32 InValuesCount, const int32 ExpectedCount = -1);
+	static bool					IsRegionInGrid(UPopcornFXAttributeSamplerGrid *Grid, const FIntVector &RegionMin, const FIntVector &RegionSize);
+	template <typename _UEType, typename _PkType>
+	void						_ReadRegion(const FIntVector &regionMin, const FIntVector &regionSize, TArray<_UEType> &outValues) const;
+	template <typename _UEType, typename _PkType>
+	void						_WriteRegion(const FIntVector &regionMin, const FIntVector &regionSize, const TArray<_UEType> &inValues);
+	void						_UploadDirtyRegion();
 
 	/** Texture only used by the D3D12 GPU sim and to set as a material texture */
 	UPROPERTY(Transient)
@@ -77,6 +77,13 @@ public:
 	UPROPERTY(EditAnywhere, meta = (ClampMin = 0.01f, ClampMax = 100.0f), Category = "PopcornFX AttributeSampler")
 	float											DensityPower;
 
+	/** Texture mip read by CPU simulated particles and used to build the density, 0 being the full resolution mip.
+	* Clamped to the last mip available. Lower resolution mips reduce the CPU memory used by the sampled texture.
+	* GPU simulated particles sample the texture directly.
+	*/
+	UPROPERTY(EditAnywhere, AdvancedDisplay, meta = (ClampMin = 0), Category = "PopcornFX AttributeSampler")
+	int32											CPUMipIndex;
+
 public:
 
 	FPopcornFXAttributeSamplerPropertiesImage()
@@ -86,6 +93,7 @@ public:
 	,	SamplingMode(EPopcornFXImageSamplingMode::Regular)
 	,	DensitySource(EPopcornFXImageDensitySource::RGBA_Average)
 	,	DensityPower(1.0f)
+	,	CPUMipIndex(0)
 	{ }
 };
 
@@ -104,6 +112,7 @@ public:
 
 
 	// overrides
+	void			OnRegister() override;
 	void			OnUnregister() override;
 	void			BeginDestroy() override;
 
@@ -14,7 +14,6 @@
 struct FAttributeSamplerShapeData;
 
 FWD_PK_API_BEGIN
-struct  SSkinContext;
 class	CShapeDescriptor;
 class	CParticleNodeSamplerData_Shape;
 class	CParticleSamplerDescriptor;
@@ -74,6 +73,20 @@ namespace	EPopcornFXSkinnedTransforms
 	};
 }
 
+UENUM()
+namespace	EPopcornFXSkinningLOD
+{
+	enum	Type
+	{
+		/** Always skin the full resolution mesh (LOD 0) */
+		FullResolution = 0,
+		/** Skin the skinned mesh component's current render LOD (driven by its screen size), offset by SkinningLODBias */
+		RenderLOD,
+		/** Always skin SkinningLOD */
+		Fixed,
+	};
+}
+
 UENUM()
 namespace EPopcornFXMeshSamplingMode
 {
@@ -209,6 +222,25 @@ struct POPCORNFX_API FPopcornFXAttributeSamplerPropertiesShape : public FPopcorn
 	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere)
 	uint32					bApplyScale : 1;
 
+	/** Determines which skeletal mesh LOD is skinned and sampled. LODs other than 0 are built at runtime and require 'Allow CPU Access' on the skeletal mesh LOD in cooked builds */
+	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere, BlueprintReadOnly)
+	TEnumAsByte<EPopcornFXSkinningLOD::Type>	SkinningLODMode;
+
+	/** LOD skinned when SkinningLODMode is Fixed (clamped to the available LODs) */
+	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "0", UIMin = "0"))
+	int32					SkinningLOD;
+
+	/** Added to the render LOD when SkinningLODMode is RenderLOD (clamped to the available LODs) */
+	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere, BlueprintReadOnly)
+	int32					SkinningLODBias;
+
+	/**
+		Emission only: keep one triangle out of N, and only skin the vertices they reference. 1 skins the whole mesh.
+		The kept triangles only depend on the LOD and N. Cloth data is unavailable when subsampling.
+	*/
+	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "1", UIMin = "1", UIMax = "16"))
+	int32					SkinningSubsampling;
+
 #if WITH_EDITORONLY_DATA
 	UPROPERTY(Category = "PopcornFX AttributeSampler", EditAnywhere)
 	uint32					bEditorBuildInitialPose : 1;
@@ -252,6 +284,10 @@ struct POPCORNFX_API FPopcornFXAttributeSamplerPropertiesShape : public FPopcorn
 	,	bComputeVelocities(false)
 	,	bBuildClothData(false)
 	,	bApplyScale(false)
+	,	SkinningLODMode(EPopcornFXSkinningLOD::FullResolution)
+	,	SkinningLOD(0)
+	,	SkinningLODBias(0)
+	,	SkinningSubsampling(1)
 #if WITH_EDITORONLY_DATA
 	,	bEditorBuildInitialPose(false)
 #endif // WITH_EDITORONLY_DATA
@@ -336,16 +372,12 @@ private:
 
 	bool											SetComponentTickingGroup(USkinnedMeshComponent *skinnedMesh);
 	bool											BuildInitialPose();
+	void											UpdateSkinningLOD();
 	bool											UpdateSkinning();
 	void											UpdateTransforms();
-	void											FetchClothData(uint32 vertexStart, uint32 vertexCount);
+	void											UpdateSamplingAccelStructs();
 	void											Clear();
 
-	// (cannot use u32 here, use uint32)
-	void											Skin_PreProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx);
-	void											Skin_PostProcess(uint32 vertexStart, uint32 vertexCount, const PopcornFX::SSkinContext &ctx);
-	void											Skin_Finish(const PopcornFX::SSkinContext &ctx);
-
 public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "PopcornFX AttributeSampler")
 	FPopcornFXAttributeSamplerPropertiesShape	Properties;
@@ -26,6 +26,7 @@ FWD_PK_API_END
 class	FPopcornFXPlugin;
 
 class	CParticleScene;
+struct	SPopcornFXEmitterUpdateBatch;
 class	UPopcornFXEffect;
 class	UPopcornFXAttributeList;
 class	UPopcornFXAttributeSampler;
@@ -129,6 +130,7 @@ public:
 	TArray<UPopcornFXAttributeSampler*>		Samplers;
 
 	uint32									bAutoDestroy : 1;
+	uint32									bReturnToPool : 1; // Acquired from UPopcornFXEmitterPool, given back instead of destroyed (implies bAutoDestroy)
 	uint32									bHasAlreadyPlayOnLoad : 1;
 
 	~UPopcornFXEmitterComponent();
@@ -304,6 +306,8 @@ public:
 
 public:
 	static UPopcornFXEmitterComponent	*CreateStandaloneEmitterComponent(UPopcornFXEffect* effect, APopcornFXSceneActor *scene, UWorld* world, AActor* actor, bool bAutoDestroy);
+	// Same as CreateStandaloneEmitterComponent, but auto destroyed emitters are taken from the world's UPopcornFXEmitterPool when enabled
+	static UPopcornFXEmitterComponent	*AcquireStandaloneEmitterComponent(UPopcornFXEffect* effect, APopcornFXSceneActor *scene, UWorld* world, bool bAutoDestroy);
 
 	class UPopcornFXAttributeList	*GetAttributeList(); // Updates attribute list ifn
 	class UPopcornFXAttributeList	*GetAttributeListIFP() const;
@@ -312,6 +316,10 @@ public:
 	UPopcornFXAttributeSampler		*GetAttributeSampler(const FString &InAttributeSamplerName);
 
 	bool							GetPayloadValue(const FString &payloadName, EPopcornFXPayloadType::Type expectedFieldType, void *outValue) const;
+	bool							GetPayloadValue(const struct FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedFieldType, void *outValue) const;
+	/** Read-only view of an event payload for all particles of the event being dispatched. Only valid during the event callback. */
+	bool							GetPayloadView(const FString &payloadName, EPopcornFXPayloadType::Type expectedFieldType, FPopcornFXPayloadView &outView) const;
+	bool							GetPayloadView(const struct FPopcornFXPayloadHandle &payloadHandle, EPopcornFXPayloadType::Type expectedFieldType, FPopcornFXPayloadView &outView) const;
 
 	bool							ResolveScene(bool warnIFN);
 	bool							SceneValid() const { return m_CurrentScene != nullptr; }
@@ -356,7 +364,8 @@ public:
 	void								Scene_OnRegistered(CParticleScene *scene, uint32 selfIdInScene);
 	void								Scene_OnUnregistered(CParticleScene *scene);
 	void								Scene_InitForUpdate(CParticleScene *scene);
-	void								Scene_PreUpdate(CParticleScene *scene, float deltaTime);
+	bool								Scene_PreUpdate_Gather(CParticleScene *scene, SPopcornFXEmitterUpdateBatch &batch);
+	void								Scene_PreUpdate_Apply(CParticleScene *scene, const SPopcornFXEmitterUpdateBatch &batch, uint32 batchIndex, float deltaTime);
 	void								Scene_PostUpdate(CParticleScene *scene, float deltaTime);
 	uint32								Scene_PreInitEmitterId() const { return m_Scene_PreInitEmitterId; };
 	uint32								Scene_EmitterId() const { return m_Scene_EmitterId; };
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#pragma once
+
+#include "PopcornFXPublic.h"
+
+#include "Subsystems/WorldSubsystem.h"
+
+#include "PopcornFXEmitterPool.generated.h"
+
+class UPopcornFXEffect;
+class UPopcornFXEmitterComponent;
+class APopcornFXSceneActor;
+
+USTRUCT()
+struct FPopcornFXEmitterPoolEntry
+{
+	GENERATED_BODY()
+
+	/** Idle emitter components, registered to the world and ready to be restarted */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UPopcornFXEmitterComponent>>	Emitters;
+};
+
+/** Hit/miss counters of a world's emitter pool, since the world began play */
+USTRUCT(BlueprintType)
+struct FPopcornFXEmitterPoolStats
+{
+	GENERATED_BODY()
+
+	/** Spawns that reused a pooled emitter component */
+	UPROPERTY(Category="PopcornFX Emitter Pool", BlueprintReadOnly)
+	int32		HitCount = 0;
+
+	/** Spawns that had to create a new emitter component */
+	UPROPERTY(Category="PopcornFX Emitter Pool", BlueprintReadOnly)
+	int32		MissCount = 0;
+
+	/** Emitter components currently idle in the pool */
+	UPROPERTY(Category="PopcornFX Emitter Pool", BlueprintReadOnly)
+	int32		PooledCount = 0;
+};
+
+/**
+* Per world pool of standalone emitter components, see UPopcornFXSettings::bEnableEmitterPool.
+* Fire-and-forget spawns (bAutoDestroy) take their component here, and give it back when their effect terminates.
+*/
+UCLASS()
+class POPCORNFX_API UPopcornFXEmitterPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UPopcornFXEmitterPool	*Get(const UWorld *world);
+
+	/** Returns a standalone emitter component: a pooled one if available, otherwise a new one (see UPopcornFXEmitterComponent::CreateStandaloneEmitterComponent) */
+	UPopcornFXEmitterComponent		*Acquire(UPopcornFXEffect *effect, APopcornFXSceneActor *scene);
+
+	/** Called by emitters acquired from this pool when their effect terminates. Returns false if the emitter must be destroyed instead. */
+	bool							Release(UPopcornFXEmitterComponent *emitter);
+
+	/** Creates idle emitter components for @effect, up to @count (and UPopcornFXSettings::MaxPooledEmittersPerEffect) */
+	void							Prewarm(UPopcornFXEffect *effect, int32 count);
+
+	const FPopcornFXEmitterPoolStats	&Stats() const { return m_Stats; }
+
+	// UWorldSubsystem
+	virtual bool					ShouldCreateSubsystem(UObject *outer) const override;
+	virtual void					OnWorldBeginPlay(UWorld &inWorld) override;
+	virtual void					Deinitialize() override;
+
+protected:
+	virtual bool					DoesSupportWorldType(const EWorldType::Type worldType) const override;
+
+private:
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UPopcornFXEffect>, FPopcornFXEmitterPoolEntry>	m_Pools;
+
+	FPopcornFXEmitterPoolStats		m_Stats;
+};
@@ -9,11 +9,29 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Engine/EngineTypes.h"
+#include "PopcornFXEmitterPool.h"
 
 #include "PopcornFXFunctions.generated.h"
 
 class UPopcornFXEmitterComponent;
 
+/** Event payload name resolved once by UPopcornFXFunctions::MakeEventPayloadHandle, for fast repeated payload queries */
+USTRUCT(BlueprintType)
+struct POPCORNFX_API FPopcornFXPayloadHandle
+{
+	GENERATED_BODY()
+
+	/** Only used for logging */
+	UPROPERTY()
+	FString		PayloadName;
+
+	/** Runtime string id, only valid for the current session: never serialized, handles must be made at runtime */
+	UPROPERTY(Transient)
+	uint32		PayloadNameId = 0;
+
+	bool		Valid() const { return PayloadNameId != 0; }
+};
+
 UCLASS()
 class POPCORNFX_API UPopcornFXFunctions : public UBlueprintFunctionLibrary
 {
@@ -78,6 +96,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category="PopcornFX|Emitter", meta=(Keywords="popcornfx particle emitter effect system", WorldContext="WorldContextObject", UnsafeDuringActorConstruction="true"))
 	static class UPopcornFXEmitterComponent* SpawnEmitterAttached(class UPopcornFXEffect* Effect, class USceneComponent* AttachToComponent, FName SceneName = TEXT("PopcornFX_DefaultScene"), FName AttachPointName = NAME_None, FVector Location = FVector(ForceInit), FRotator Rotation = FRotator::ZeroRotator, EAttachLocation::Type LocationType = EAttachLocation::KeepRelativeOffset, bool bStartEmitter = true, bool bAutoDestroy = true);
 
+	/** Creates idle emitter components for the specified effect, so that the next auto destroyed spawns reuse them (requires "Enable Emitter Pool" in the PopcornFX project settings)
+	* @param Effect - Effect to create emitters for
+	* @param Count - Idle emitters the pool should hold for that effect (clamped to "Max Pooled Emitters Per Effect")
+	*/
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|Emitter", meta=(Keywords="popcornfx particle emitter pool", WorldContext="WorldContextObject"))
+	static void		PrewarmEmitterPool(UObject* WorldContextObject, class UPopcornFXEffect* Effect, int32 Count);
+
+	/** Returns the hit/miss counters of the world's emitter pool */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="PopcornFX|Emitter", meta=(Keywords="popcornfx particle emitter pool stats", WorldContext="WorldContextObject"))
+	static FPopcornFXEmitterPoolStats	GetEmitterPoolStats(UObject* WorldContextObject);
+
 	/** Notify PopcornFX that an UObject has changed and must be reloaded.
 	* For example: use this to get PopcornFX reload a dynamic UTexture that changed
 	*/
@@ -173,4 +202,57 @@ public:
 
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload", BlueprintInternalUseOnly="true"), Category="PopcornFX|Events")
 	static bool		GetEventPayloadAsRotator(const UPopcornFXEmitterComponent *Emitter, FString PayloadName, FRotator &OutValue, bool InApplyGlobalScale);
+
+
+	/** Resolves an event payload name once. The returned handle makes the "Get Event Payload From Handle" functions skip the name lookup. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="PopcornFX|Events", meta=(Keywords="popcornfx event payload"))
+	static FPopcornFXPayloadHandle	MakeEventPayloadHandle(const FString &PayloadName);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Float)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsFloatFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValue, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Float2)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsFloat2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Vector2D)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsVector2DFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FVector2D &OutValue, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Float3)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsFloat3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, float &OutValueZ, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Vector)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsVectorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FVector &OutValue, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Float4)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsFloat4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, float &OutValueX, float &OutValueY, float &OutValueZ, float &OutValueW, bool InApplyGlobalScale);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (LinearColor)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsLinearColorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FLinearColor &OutValue);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Int)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsIntFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValue);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Int2)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsInt2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Int3)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsInt3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Int4)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsInt4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, int32 &OutValueX, int32 &OutValueY, int32 &OutValueZ, int32 &OutValueW);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Bool)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsBoolFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValue);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Bool2)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsBool2FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Bool3)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsBool3FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY, bool &OutValueZ);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Bool4)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsBool4FromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, bool &OutValueX, bool &OutValueY, bool &OutValueZ, bool &OutValueW);
+
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Get Event Payload From Handle (Rotator)"), Category="PopcornFX|Events")
+	static bool		GetEventPayloadAsRotatorFromHandle(const UPopcornFXEmitterComponent *Emitter, const FPopcornFXPayloadHandle &PayloadHandle, FRotator &OutValue, bool InApplyGlobalScale);
 };
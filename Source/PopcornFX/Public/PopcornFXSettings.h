@@ -88,6 +88,26 @@ namespace EPopcornFXRenderCullMethod
 	};
 }
 
+/** How to cull PopcornFX Particle Pages for Ray Tracing passes. */
+UENUM()
+namespace EPopcornFXRayTracingCullMethod
+{
+	enum	Type
+	{
+		/** Do NOT cull: all particle pages are built for ray tracing. */
+		None,
+
+		/** Cull pages further than RayTracingCullDistance from the view. */
+		DistanceSphere,
+
+		/** Cull pages outside of the view frustum, expanded by RayTracingCullDistance. */
+		ExpandedFrustum,
+
+		/** Cull pages whose projected size is below RayTracingMinScreenSize. */
+		ScreenSize,
+	};
+}
+
 /** PopcornFX Localized page mode */
 UENUM()
 namespace EPopcornFXLocalizedPagesMode
@@ -148,6 +168,31 @@ struct FPopcornFXSimulationSettings
 	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings", meta=(EditCondition="bOverride_bEnablePhysicalMaterials"))
 	uint32 bEnablePhysicalMaterials : 1;
 
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings")
+	uint32 bOverride_bDeterministicCollisionQueries : 1;
+
+	/** Trace particle collision rays serially, in ray order, instead of splitting ray packets across worker tasks.
+	Results are the same in both modes: use this to compare against the parallel path, or when debugging collisions.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings", meta=(EditCondition="bOverride_bDeterministicCollisionQueries"))
+	uint32 bDeterministicCollisionQueries : 1;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings")
+	uint32 bOverride_bEnableCollisionTemporalCache : 1;
+
+	/** Particles whose collision ray barely moved since last frame reuse the previous contact plane and material instead of querying physics.
+	Cuts physics queries for settled particles (debris resting on the ground, ..), at the cost of approximate contacts on moving geometry.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings", meta=(EditCondition="bOverride_bEnableCollisionTemporalCache"))
+	uint32 bEnableCollisionTemporalCache : 1;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings")
+	uint32 bOverride_CollisionTemporalCacheTolerance : 1;
+
+	/** Maximum ray origin and length change (in UE units) for a cached contact to be reused */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings", meta=(EditCondition="bOverride_CollisionTemporalCacheTolerance", ClampMin="0"))
+	float CollisionTemporalCacheTolerance;
+
 	UPROPERTY(EditAnywhere, Category="PopcornFX Simulation Settings")
 	uint32 bOverride_LocalizedPagesMode : 1;
 
@@ -220,6 +265,84 @@ struct FPopcornFXRenderSettings
 	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_bForceLightsLitTranslucent"))
 	uint32 bForceLightsLitTranslucent : 1;
 
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_bEnableLightsCulling : 1;
+
+	/** Do not submit Particle Lights whose radius does not reach any view frustum */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_bEnableLightsCulling"))
+	uint32 bEnableLightsCulling : 1;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_MaxLights : 1;
+
+	/** Maximum Particle Lights submitted per scene and frame (0 = unlimited).
+	* Most important lights are kept: radius x intensity, attenuated with the distance to the view.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_MaxLights", ClampMin="0"))
+	int32 MaxLights;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_MaxLightsPerRenderer : 1;
+
+	/** Maximum Particle Lights submitted per light renderer and frame (0 = unlimited). */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_MaxLightsPerRenderer", ClampMin="0"))
+	int32 MaxLightsPerRenderer;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_bEnableDecalsCulling : 1;
+
+	/** Do not submit Particle Decals outside of the view frustums */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_bEnableDecalsCulling"))
+	uint32 bEnableDecalsCulling : 1;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_DecalsCullDistance : 1;
+
+	/** Particle Decals further than this distance from every view are not submitted (0 = no distance culling) */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_DecalsCullDistance", ClampMin="0"))
+	float DecalsCullDistance;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_MaxDecals : 1;
+
+	/** Maximum Particle Decals submitted per scene and frame (0 = unlimited).
+	* Largest decals relative to their distance to the view are kept.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_MaxDecals", ClampMin="0"))
+	int32 MaxDecals;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_MaxSoundVoices : 1;
+
+	/** Maximum sounds playing per Sound renderer (0 = unlimited).
+	* Loudest and closest sounds are kept, others are virtualized and their voices reused.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_MaxSoundVoices", ClampMin="0"))
+	int32 MaxSoundVoices;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_RayTracingCullMethod : 1;
+
+	/** How to cull particle pages for ray tracing passes (reflections, shadows, ..).
+	* Off-screen particles can still contribute to ray traced effects: prefer DistanceSphere or ExpandedFrustum with a large enough distance.
+	*/
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_RayTracingCullMethod"))
+	TEnumAsByte<EPopcornFXRayTracingCullMethod::Type> RayTracingCullMethod;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_RayTracingCullDistance : 1;
+
+	/** DistanceSphere: radius around the view, ExpandedFrustum: distance the frustum planes are pushed out. */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_RayTracingCullDistance", ClampMin="0.0", UIMin="0.0"))
+	float RayTracingCullDistance;
+
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings")
+	uint32 bOverride_RayTracingMinScreenSize : 1;
+
+	/** ScreenSize: pages whose bounding sphere covers less than this screen ratio are culled. */
+	UPROPERTY(EditAnywhere, Category="PopcornFX Render Settings", meta=(EditCondition="bOverride_RayTracingMinScreenSize", ClampMin="0.0", UIMin="0.0", UIMax="1.0"))
+	float RayTracingMinScreenSize;
+
 	FPopcornFXRenderSettings();
 
 	void		ResolveSettingsTo(FPopcornFXRenderSettings &outSettings) const;
@@ -304,6 +427,37 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Budget")
 	uint32						GPUParticleCountLimitTotal;
 
+	/**
+	* Recycle the emitter components spawned with bAutoDestroy (SpawnEmitterAtLocation, SpawnEmitterAttached, CopyAndStartEmitterAt*)
+	* instead of destroying them when their effect terminates.
+	* /!\ References kept on those components after their effect terminates can point to a reused emitter.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Emitter Pool")
+	uint32						bEnableEmitterPool : 1;
+
+	/** Max idle emitter components kept per effect and per world, extra ones are destroyed */
+	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Emitter Pool", meta=(EditCondition="bEnableEmitterPool", ClampMin="0"))
+	int32						MaxPooledEmittersPerEffect;
+
+	/** Emitter components created for each effect when a game world begins play */
+	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Emitter Pool", meta=(EditCondition="bEnableEmitterPool"))
+	TMap<TSoftObjectPtr<class UPopcornFXEffect>, int32>	EmitterPoolPrewarmCounts;
+
+	/**
+	* Max image sampler density tables kept in memory once no sampler references them anymore.
+	* Image samplers using the same texture and density settings share their density table, keeping unreferenced ones around avoids rebuilding them when effects respawn or levels reload.
+	* 0 releases density tables as soon as their last sampler is destroyed.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Samplers", meta=(ClampMin="0"))
+	int32						MaxCachedImageDensityTables;
+
+	/**
+	* Max worker tasks converting textures to CPU images in parallel.
+	* Image samplers start loading their texture when registered, so effects referencing many textures don't stall the game thread when first instantiated.
+	*/
+	UPROPERTY(Config, EditAnywhere, Category="PopcornFX Samplers", meta=(ClampMin="1"))
+	int32						MaxConcurrentImageLoads;
+
 	/** Debug draw bounds lines thickness */
 	UPROPERTY(Config, EditAnywhere, Category="Debug", meta=(ClampMin="0.1", ClampMax="100000.0", UIMin="0.1", UIMax="100000.0"))
 	float						DebugBoundsLinesThickness;
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------
+// Copyright Persistant Studios, SARL.
+// https://popcornfx.com/popcornfx-community-license/
+//----------------------------------------------------------------------------
+
+#pragma once
+
+#include "PopcornFXPublic.h"
+#include "Assets/PopcornFXSimulationCache.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Tasks/Task.h"
+
+#include "PopcornFXSimulationCacheComponent.generated.h"
+
+/**
+*	Plays back the frames recorded in a UPopcornFXSimulationCache without running any simulation:
+*	only decoding the current frame and rendering its billboards and lights cost anything at runtime.
+*	Particles are rendered relative to this component's transform.
+*/
+UCLASS(HideCategories=(Input, Collision, Replication), ClassGroup=PopcornFX, meta=(BlueprintSpawnableComponent))
+class POPCORNFX_API UPopcornFXSimulationCacheComponent : public UPrimitiveComponent
+{
+	GENERATED_UCLASS_BODY()
+
+	UPROPERTY(Category="PopcornFX SimulationCache", EditAnywhere, BlueprintReadOnly)
+	UPopcornFXSimulationCache				*SimulationCache;
+
+	/** Restarts the playback once the last frame is reached */
+	UPROPERTY(Category="PopcornFX SimulationCache", EditAnywhere, BlueprintReadWrite)
+	uint32									bLooping : 1;
+
+	UPROPERTY(Category="PopcornFX SimulationCache", EditAnywhere, BlueprintReadWrite, meta=(ClampMin="0.0"))
+	float									PlayRate;
+
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|SimulationCache")
+	void									SetSimulationCache(UPopcornFXSimulationCache *InSimulationCache);
+
+	/** Jumps to 'Time' seconds in the recording */
+	UFUNCTION(BlueprintCallable, Category="PopcornFX|SimulationCache")
+	void									SetPlaybackTime(float Time);
+
+	UFUNCTION(BlueprintPure, Category="PopcornFX|SimulationCache")
+	float									GetPlaybackTime() const { return m_PlaybackTime; }
+
+	// overrides UObject
+#if WITH_EDITOR
+	virtual void							PostEditChangeProperty(FPropertyChangedEvent& propertyChangedEvent) override;
+#endif // WITH_EDITOR
+
+	// overrides UActorComponent
+	virtual void							OnUnregister() override;
+	virtual void							TickComponent(float deltaTime, enum ELevelTick tickType, FActorComponentTickFunction *thisTickFunction) override;
+	virtual void							SendRenderDynamicData_Concurrent() override;
+
+	// overrides USceneComponent
+	virtual FBoxSphereBounds				CalcBounds(const FTransform &LocalToWorld) const override;
+
+	// overrides UPrimitiveComponent
+	virtual FPrimitiveSceneProxy			*CreateSceneProxy() override;
+	virtual void							GetUsedMaterials(TArray<UMaterialInterface*>& OutMaterials, bool bGetDebugMaterials = false) const override;
+
+private:
+	void									_ResetPlayback();
+	void									_ResetFrames();
+	void									_WaitPendingDecode();
+
+private:
+	typedef TSharedPtr<const FPopcornFXSimulationCacheDecodedFrame, ESPMode::ThreadSafe>	FDecodedFramePtr;
+
+	float									m_PlaybackTime = 0.0f;
+	int32									m_RequestedFrame = -1;
+	UE::Tasks::TTask<FDecodedFramePtr>		m_PendingDecode;
+	FDecodedFramePtr						m_CurrentFrame; // Last decoded frame, sent to the scene proxy
+	bool									m_FrameDirty = false;
+	uint32									m_CacheLayoutRevision = 0; // SimulationCache->GetLayoutRevision() the frames and scene proxy were built from
+};
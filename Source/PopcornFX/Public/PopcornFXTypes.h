@@ -49,6 +49,29 @@ namespace	EPopcornFXPayloadType
 		Invalid
 	};
 }
+namespace	EPopcornFXPayloadType
+{
+	inline uint32		Dim(Type type) { return (uint32(type) % 4) + 1; }
+}
+
+// Read-only view of one payload of the event being dispatched, one value per particle which raised the event.
+// Values are 'Dim' 32 bits components (bools are stored as uint32, 0 being false).
+// Only valid during the event callback, see UPopcornFXEmitterComponent::GetPayloadView.
+struct	FPopcornFXPayloadView
+{
+	EPopcornFXPayloadType::Type	Type = EPopcornFXPayloadType::Invalid;
+	const uint8					*Data = nullptr;
+	uint32						Stride = 0;			// Bytes between two consecutive values
+	uint32						Count = 0;
+	uint32						CurrentIndex = 0;	// Value of the particle the callback is executed for
+
+	bool			Valid() const { return Data != nullptr; }
+
+	template <typename _Type>
+	const _Type		&Get(uint32 index) const { check(index < Count && sizeof(_Type) <= Stride); return *reinterpret_cast<const _Type*>(Data + index * Stride); }
+	template <typename _Type>
+	const _Type		&Current() const { return Get<_Type>(CurrentIndex); }
+};
 
 UENUM(BlueprintType)
 namespace	EPopcornFXPinDataType